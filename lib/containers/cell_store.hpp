@@ -0,0 +1,336 @@
+/**
+ * @file cell_store.hpp
+ * @date 17.10.2026
+ * @author RMSHE
+ *
+ * < GasSensorOS >
+ * Copyright(C) 2026 RMSHE. All rights reserved.
+ *
+ * This program is free software : you can redistribute it and /or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.If not, see < https://www.gnu.org/licenses/>.
+ *
+ * Electronic Mail : asdfghjkl851@outlook.com
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief 带引用计数的字符串驻留池
+ *
+ * 每个不同的字符串只保存一份，以 32 位 ID 引用。ID 0 固定表示空字符串，不占用池空间。
+ * 引用计数降为 0 的字符串立即释放，其 ID 进入空闲链表供之后复用。
+ *
+ * @note 非线程安全。
+ */
+class StringPool {
+   public:
+    using Id = uint32_t;
+    static constexpr Id kEmpty = 0;                // 空字符串的 ID
+    static constexpr Id kNotFound = UINT32_MAX;  // find() 未找到时的返回值
+
+    StringPool() : entries_(1) { entries_[kEmpty].value = &emptyString(); }
+    StringPool(const StringPool& other) { *this = other; }
+    StringPool(StringPool&&) = default;
+    StringPool& operator=(StringPool&&) = default;
+
+    // 复制时重建查找表, 使各条目指向本池中的字符串
+    StringPool& operator=(const StringPool& other) {
+        if (this == &other) return *this;
+        entries_ = other.entries_;
+        free_ = other.free_;
+        acquires_ = other.acquires_;
+        hits_ = other.hits_;
+        lookup_.clear();
+        lookup_.reserve(other.lookup_.size());
+        for (const auto& item : other.lookup_) entries_[item.second].value = &lookup_.emplace(item).first->first;
+        return *this;
+    }
+
+    /**
+     * @brief 获取字符串的 ID 并增加其引用计数(不存在时加入池中)
+     * @param value 字符串
+     * @return 字符串的 ID
+     */
+    Id acquire(const std::string& value) {
+        ++acquires_;
+        if (value.empty()) {
+            ++hits_;
+            return kEmpty;
+        }
+
+        auto it = lookup_.find(value);
+        if (it != lookup_.end()) {
+            ++hits_;
+            ++entries_[it->second].refs;
+            return it->second;
+        }
+
+        Id id;
+        if (!free_.empty()) {
+            id = free_.back();
+            free_.pop_back();
+        } else {
+            id = static_cast<Id>(entries_.size());
+            entries_.emplace_back();
+        }
+        it = lookup_.emplace(value, id).first;
+        entries_[id] = Entry{&it->first, 1};
+        return id;
+    }
+
+    // 增加引用计数(复制单元格时使用)
+    Id retain(Id id) {
+        if (id != kEmpty) ++entries_[id].refs;
+        return id;
+    }
+
+    // 减少引用计数, 降为 0 时释放字符串
+    void release(Id id) {
+        if (id == kEmpty || --entries_[id].refs > 0) return;
+        lookup_.erase(*entries_[id].value);
+        entries_[id].value = nullptr;
+        free_.push_back(id);
+    }
+
+    // 获取 ID 对应的字符串
+    const std::string& get(Id id) const { return *entries_[id].value; }
+
+    // 查找字符串的 ID(不改变引用计数), 不存在时返回 kNotFound
+    Id find(const std::string& value) const {
+        if (value.empty()) return kEmpty;
+        auto it = lookup_.find(value);
+        return it == lookup_.end() ? kNotFound : it->second;
+    }
+
+    size_t size() const { return lookup_.size(); }      // 池中的字符串数(不含空字符串)
+    size_t idBound() const { return entries_.size(); }  // 所有 ID 都小于该值, 可用作按 ID 索引的数组长度
+    size_t acquires() const { return acquires_; }       // acquire() 调用次数
+    size_t hits() const { return hits_; }               // acquire() 命中已有字符串的次数
+
+    /**
+     * @brief 估算池占用的堆内存(字节)
+     * 包括条目数组、哈希表桶与节点，以及超出短字符串优化(SSO)容量的字符串缓冲区。
+     */
+    size_t memoryUsage() const {
+        const size_t nodeBytes = sizeof(std::pair<const std::string, Id>) + 2 * sizeof(void*);  // 节点: 键值对 + 链表指针 + 缓存的哈希值
+        size_t bytes = entries_.capacity() * sizeof(Entry) + free_.capacity() * sizeof(Id);
+        bytes += lookup_.bucket_count() * sizeof(void*) + lookup_.size() * nodeBytes;
+        for (const auto& item : lookup_)
+            if (item.first.capacity() > emptyString().capacity()) bytes += item.first.capacity() + 1;
+        return bytes;
+    }
+
+   private:
+    struct Entry {
+        const std::string* value = nullptr;  // 指向查找表中的键, 空闲时为 nullptr
+        uint32_t refs = 0;                   // 引用计数
+    };
+
+    static const std::string& emptyString() {
+        static const std::string empty;
+        return empty;
+    }
+
+    std::vector<Entry> entries_;                  // ID -> 字符串
+    std::vector<Id> free_;                        // 可复用的 ID
+    std::unordered_map<std::string, Id> lookup_;  // 字符串 -> ID(节点地址稳定, 字符串只保存在这里)
+    size_t acquires_ = 0;
+    size_t hits_ = 0;
+};
+
+/**
+ * @brief 以驻留字符串 ID 存储的二维单元格数组
+ *
+ * 所有单元格按行优先顺序保存在一段连续的 `StringPool::Id` 数组中，一行就是其中连续的 `cols()` 个元素；
+ * 单元格的字符串内容保存在表格私有的 `StringPool` 中，相同的值只保存一份。
+ * 清空单元格只是写入 ID 0，不分配任何内存。
+ *
+ * @note 非线程安全。
+ */
+class CellStore {
+   public:
+    using Id = StringPool::Id;
+    using Row = std::vector<std::string>;
+
+    CellStore() = default;
+    CellStore(size_t rows, size_t cols, const std::string& value = "") : rows_(rows), cols_(cols), cells_(rows * cols, StringPool::kEmpty) {
+        if (value.empty()) return;
+        for (auto& id : cells_) id = pool_.acquire(value);
+    }
+
+    size_t rows() const { return rows_; }
+    size_t cols() const { return cols_; }
+    bool empty() const { return rows_ == 0; }
+
+    // 读取单元格
+    const std::string& get(size_t row, size_t col) const { return pool_.get(cells_[row * cols_ + col]); }
+    Id id(size_t row, size_t col) const { return cells_[row * cols_ + col]; }
+
+    // 写入单元格
+    void set(size_t row, size_t col, const std::string& value) {
+        Id& cell = cells_[row * cols_ + col];
+        Id id = pool_.acquire(value);
+        pool_.release(cell);
+        cell = id;
+    }
+
+    // 读取整行
+    Row row(size_t row) const {
+        Row values;
+        values.reserve(cols_);
+        for (size_t col = 0; col < cols_; ++col) values.push_back(get(row, col));
+        return values;
+    }
+
+    /**
+     * @brief 在 pos 处插入一行
+     * @param values 行数据, 多余部分截断, 缺失部分为空字符串
+     */
+    void insertRow(size_t pos, const Row& values) {
+        std::vector<Id> ids(cols_, StringPool::kEmpty);
+        for (size_t col = 0; col < std::min(cols_, values.size()); ++col) ids[col] = pool_.acquire(values[col]);
+        cells_.insert(cells_.begin() + pos * cols_, ids.begin(), ids.end());
+        ++rows_;
+    }
+
+    // 删除一行
+    void eraseRow(size_t pos) {
+        auto first = cells_.begin() + pos * cols_;
+        for (auto it = first; it != first + cols_; ++it) pool_.release(*it);
+        cells_.erase(first, first + cols_);
+        --rows_;
+    }
+
+    void swapRows(size_t row1, size_t row2) { std::swap_ranges(cells_.begin() + row1 * cols_, cells_.begin() + (row1 + 1) * cols_, cells_.begin() + row2 * cols_); }
+
+    /**
+     * @brief 按新顺序重排所有行
+     * @param order 新表格的第 i 行取自原表格的第 order[i] 行(必须是 0..rows()-1 的一个排列)
+     */
+    void permuteRows(const std::vector<size_t>& order) {
+        std::vector<Id> cells(cells_.size());
+        for (size_t row = 0; row < order.size(); ++row) std::copy_n(cells_.begin() + order[row] * cols_, cols_, cells.begin() + row * cols_);
+        cells_ = std::move(cells);
+    }
+
+    /**
+     * @brief 在 pos 处插入一列
+     * @param values 列数据, 多余部分截断, 缺失部分为空字符串
+     */
+    void insertCol(size_t pos, const std::vector<std::string>& values) {
+        std::vector<Id> cells;
+        cells.reserve(rows_ * (cols_ + 1));
+        for (size_t row = 0; row < rows_; ++row) {
+            auto first = cells_.begin() + row * cols_;
+            cells.insert(cells.end(), first, first + pos);
+            cells.push_back(row < values.size() ? pool_.acquire(values[row]) : StringPool::kEmpty);
+            cells.insert(cells.end(), first + pos, first + cols_);
+        }
+        cells_ = std::move(cells);
+        ++cols_;
+    }
+
+    // 删除一列
+    void eraseCol(size_t pos) {
+        size_t out = 0;
+        for (size_t i = 0; i < cells_.size(); ++i) {
+            if (i % cols_ == pos) {
+                pool_.release(cells_[i]);
+            } else {
+                cells_[out++] = cells_[i];
+            }
+        }
+        cells_.resize(out);
+        --cols_;
+    }
+
+    void swapCols(size_t col1, size_t col2) {
+        for (size_t row = 0; row < rows_; ++row) std::swap(cells_[row * cols_ + col1], cells_[row * cols_ + col2]);
+    }
+
+    // 将一行的所有单元格置为空字符串
+    void clearRow(size_t row) {
+        for (size_t col = 0; col < cols_; ++col) set(row, col, std::string());
+    }
+
+    // 将所有单元格置为空字符串(不释放单元格数组)
+    void clearCells() {
+        for (auto& id : cells_) pool_.release(id);
+        std::fill(cells_.begin(), cells_.end(), StringPool::kEmpty);
+    }
+
+    /**
+     * @brief 调整行列数; 被裁剪的单元格释放, 新增的单元格为空字符串
+     */
+    void resize(size_t rows, size_t cols) {
+        if (cols == cols_) {
+            for (size_t i = rows * cols_; i < cells_.size(); ++i) pool_.release(cells_[i]);
+            cells_.resize(rows * cols, StringPool::kEmpty);
+        } else {
+            std::vector<Id> cells(rows * cols, StringPool::kEmpty);
+            for (size_t row = 0; row < rows_; ++row) {
+                for (size_t col = 0; col < cols_; ++col) {
+                    Id id = cells_[row * cols_ + col];
+                    if (row < rows && col < cols) {
+                        cells[row * cols + col] = id;
+                    } else {
+                        pool_.release(id);
+                    }
+                }
+            }
+            cells_ = std::move(cells);
+        }
+        rows_ = rows;
+        cols_ = cols;
+    }
+
+    /**
+     * @brief 用 rows 替换全部内容
+     * @param rows 行数据, 每行补齐或截断到 cols 列
+     * @param cols 列数
+     */
+    void assign(const std::vector<Row>& rows, size_t cols) {
+        clear();
+        cols_ = cols;
+        cells_.reserve(rows.size() * cols);
+        for (const auto& values : rows) insertRow(rows_, values);
+    }
+
+    // 删除所有单元格并释放内存
+    void clear() {
+        for (auto& id : cells_) pool_.release(id);
+        cells_.clear();
+        rows_ = 0;
+        cols_ = 0;
+    }
+
+    void shrinkToFit() { cells_.shrink_to_fit(); }
+
+    const StringPool& pool() const { return pool_; }
+
+    // 单元格数组占用的堆内存(字节)
+    size_t cellMemoryUsage() const { return cells_.capacity() * sizeof(Id); }
+
+   private:
+    size_t rows_ = 0;
+    size_t cols_ = 0;
+    std::vector<Id> cells_;  // 行优先的单元格 ID
+    StringPool pool_;        // 单元格字符串
+};
@@ -0,0 +1,670 @@
+/**
+ * @file column_table.hpp
+ * @date 17.10.2026
+ * @author RMSHE
+ *
+ * < GasSensorOS >
+ * Copyright(C) 2026 RMSHE. All rights reserved.
+ *
+ * This program is free software : you can redistribute it and /or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.If not, see < https://www.gnu.org/licenses/>.
+ *
+ * Electronic Mail : asdfghjkl851@outlook.com
+ */
+
+#pragma once
+
+#include <data_table.hpp>
+#include <file_explorer.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <serial_warning.hpp>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// 列的数据类型
+enum class ColumnType : uint8_t {
+    Int32 = 1,   // 32 位有符号整数
+    Float = 2,   // 单精度浮点数
+    String = 3,  // 字符串(字典编码)
+};
+
+/**
+ * @class ColumnTable
+ * @brief 按列存储的类型化数据表
+ *
+ * @details
+ * - 每列在内存中是一段连续数组: Int32 列为 `int32_t[]`, Float 列为 `float[]`,
+ *   String 列为字典编码 `uint32_t[]` 加一份去重后的字符串字典;
+ * - 数值查询直接扫描连续数组, 不解析字符串; 字符串等值查询只比较字典编码;
+ * - 二进制文件格式与内存布局一致, 加载时每列只需一次 read 拷贝进数组, 不逐格解析.
+ *
+ * 二进制文件布局(小端, 各数据块按 4 字节对齐):
+ * @code
+ * FileHeader                        "GSCT", 版本, 字节序标记, 行数, 列数
+ * ColumnDesc[cols]                  每列的类型、列名长度、数据块偏移与大小、字典条目数与大小
+ * 列名                              所有列名依次拼接
+ * 列 0 数据块 [列 0 字典]            字典 = uint32_t 偏移表[条目数 + 1] + 字符数据
+ * 列 1 数据块 [列 1 字典]
+ * ...
+ * @endcode
+ *
+ * @note 非线程安全.
+ */
+class ColumnTable {
+   public:
+    // 一列数据
+    struct Column {
+        ColumnType type = ColumnType::String;
+        std::string name;
+        std::vector<int32_t> ints;      // Int32 列的数据
+        std::vector<float> floats;      // Float 列的数据
+        std::vector<uint32_t> codes;    // String 列的字典编码
+        std::vector<std::string> dict;  // String 列的字典(编码 -> 字符串)
+        std::unordered_map<std::string, uint32_t> lookup;  // String 列的反查表(字符串 -> 编码), 按需建立
+    };
+
+    ColumnTable() = default;
+
+    /**
+     * @brief 按列名与类型创建空表
+     * @param names 列名
+     * @param types 每列的类型, 数量必须与列名一致
+     */
+    ColumnTable(const std::vector<std::string>& names, const std::vector<ColumnType>& types) {
+        for (size_t col = 0; col < names.size() && col < types.size(); ++col) addColumn(names[col], types[col]);
+    }
+
+    size_t getRowSize() const { return rows; }           // 行数
+    size_t getColSize() const { return columns.size(); }  // 列数
+
+    ColumnType getColType(size_t col) const { return columns[col].type; }
+    const std::string& getColName(size_t col) const { return columns[col].name; }
+
+    /**
+     * @brief 按名称查找列
+     * @return 列索引, 不存在时返回 npos
+     */
+    size_t findCol(const std::string& name) const {
+        for (size_t col = 0; col < columns.size(); ++col)
+            if (columns[col].name == name) return col;
+        return npos;
+    }
+
+    /**
+     * @brief 在表格末尾添加一列, 已有行用 0 或空字符串填充
+     * @param name 列名
+     * @param type 列类型
+     */
+    void addColumn(const std::string& name, ColumnType type) {
+        Column column;
+        column.name = name;
+        column.type = type;
+        switch (type) {
+            case ColumnType::Int32: column.ints.assign(rows, 0); break;
+            case ColumnType::Float: column.floats.assign(rows, 0.0f); break;
+            case ColumnType::String:
+                column.dict.emplace_back();  // 编码 0 固定为空字符串
+                column.codes.assign(rows, 0);
+                break;
+        }
+        columns.push_back(std::move(column));
+    }
+
+    // 预留行容量, 避免追加时反复扩容
+    void reserve(size_t rowCount) {
+        for (auto& column : columns) {
+            switch (column.type) {
+                case ColumnType::Int32: column.ints.reserve(rowCount); break;
+                case ColumnType::Float: column.floats.reserve(rowCount); break;
+                case ColumnType::String: column.codes.reserve(rowCount); break;
+            }
+        }
+    }
+
+    /**
+     * @brief 以字符串形式追加一行, 按列类型解析
+     *
+     * 字符串只在写入时解析一次; 缺失的单元格按 0 或空字符串处理, 多余的单元格被忽略.
+     * @param cells 单元格的字符串值
+     * @return 所有数值单元格都能解析时追加并返回 true; 否则不追加并返回 false
+     */
+    bool appendRow(const std::vector<std::string>& cells) {
+        std::vector<int32_t> ints(columns.size(), 0);
+        std::vector<float> floats(columns.size(), 0.0f);
+
+        // 先解析整行, 全部成功后再写入, 保证各列行数一致
+        for (size_t col = 0; col < columns.size() && col < cells.size(); ++col) {
+            bool ok = true;
+            if (columns[col].type == ColumnType::Int32) ok = parseInt(cells[col], ints[col]);
+            if (columns[col].type == ColumnType::Float) ok = parseFloat(cells[col], floats[col]);
+            if (!ok) {
+                WARN(WarningLevel::ERROR, "ColumnTable 第 %u 列无法解析为数值: %s", static_cast<unsigned>(col), cells[col].c_str());
+                return false;
+            }
+        }
+
+        for (size_t col = 0; col < columns.size(); ++col) {
+            Column& column = columns[col];
+            switch (column.type) {
+                case ColumnType::Int32: column.ints.push_back(ints[col]); break;
+                case ColumnType::Float: column.floats.push_back(floats[col]); break;
+                case ColumnType::String: column.codes.push_back(col < cells.size() ? encode(column, cells[col]) : 0); break;
+            }
+        }
+        ++rows;
+        return true;
+    }
+
+    // 清空所有行, 保留列定义
+    void clearRows() {
+        for (auto& column : columns) {
+            column.ints.clear();
+            column.floats.clear();
+            column.codes.clear();
+            column.dict.assign(1, std::string());
+            column.lookup.clear();
+        }
+        rows = 0;
+    }
+
+   public:
+    // ---- 单元格访问 ----
+
+    int32_t getInt(size_t row, size_t col) const { return columns[col].ints[row]; }
+    float getFloat(size_t row, size_t col) const { return columns[col].floats[row]; }
+    const std::string& getString(size_t row, size_t col) const { return columns[col].dict[columns[col].codes[row]]; }
+
+    void setInt(int32_t value, size_t row, size_t col) { columns[col].ints[row] = value; }
+    void setFloat(float value, size_t row, size_t col) { columns[col].floats[row] = value; }
+    void setString(const std::string& value, size_t row, size_t col) {
+        Column& column = columns[col];
+        column.codes[row] = encode(column, value);
+        // 覆写会在字典中留下不再被引用的条目; 孤立条目超过行数时整理一次, 摊还开销为 O(1)
+        if (column.dict.size() > 2 * rows + 16) compactDictionary(column);
+    }
+
+    // 以字符串形式获取单元格(数值按类型格式化)
+    std::string getCell(size_t row, size_t col) const {
+        if (row >= rows || col >= columns.size()) return "";
+        const Column& column = columns[col];
+        char buffer[24];
+        switch (column.type) {
+            case ColumnType::Int32: snprintf(buffer, sizeof(buffer), "%ld", static_cast<long>(column.ints[row])); return buffer;
+            case ColumnType::Float: snprintf(buffer, sizeof(buffer), "%.7g", static_cast<double>(column.floats[row])); return buffer;
+            case ColumnType::String: return column.dict[column.codes[row]];
+        }
+        return "";
+    }
+
+    // 整列的连续数组(类型不符时返回空指针)
+    const int32_t* intData(size_t col) const { return columns[col].type == ColumnType::Int32 ? columns[col].ints.data() : nullptr; }
+    const float* floatData(size_t col) const { return columns[col].type == ColumnType::Float ? columns[col].floats.data() : nullptr; }
+
+   public:
+    // ---- 查询 ----
+
+    /**
+     * @brief 查找数值列中等于 value 的所有行
+     * @return 匹配的行索引(升序)
+     */
+    std::vector<size_t> findEqual(size_t col, double value) const {
+        return scan(col, [value](double cell) { return cell == value; });
+    }
+
+    /**
+     * @brief 查找字符串列中等于 value 的所有行
+     * 只需在字典中查找一次编码, 之后比较整数编码.
+     * @return 匹配的行索引(升序)
+     */
+    std::vector<size_t> findEqual(size_t col, const std::string& value) const {
+        std::vector<size_t> result;
+        if (col >= columns.size() || columns[col].type != ColumnType::String) return result;
+
+        const Column& column = columns[col];
+        uint32_t code = 0;
+        if (!findCode(column, value, code)) return result;
+        for (size_t row = 0; row < rows; ++row)
+            if (column.codes[row] == code) result.push_back(row);
+        return result;
+    }
+
+    /**
+     * @brief 查找数值列中位于 [low, high] 区间内的所有行
+     * @return 匹配的行索引(升序)
+     */
+    std::vector<size_t> findRange(size_t col, double low, double high) const {
+        return scan(col, [low, high](double cell) { return cell >= low && cell <= high; });
+    }
+
+    // 数值列求和(非数值列返回 0)
+    double sum(size_t col) const {
+        double total = 0.0;
+        if (col >= columns.size()) return total;
+        const Column& column = columns[col];
+        if (column.type == ColumnType::Int32)
+            for (int32_t cell : column.ints) total += cell;
+        if (column.type == ColumnType::Float)
+            for (float cell : column.floats) total += cell;
+        return total;
+    }
+
+    // 移除所有 String 列字典中不再被任何行引用的条目(saveBinary 前自动执行)
+    void compact() {
+        for (auto& column : columns)
+            if (column.type == ColumnType::String) compactDictionary(column);
+    }
+
+    // 表格数据占用的堆内存(字节, 不含容器自身与字符串对象的固定开销)
+    size_t memoryUsage() const {
+        size_t bytes = 0;
+        for (const auto& column : columns) {
+            bytes += column.ints.capacity() * sizeof(int32_t) + column.floats.capacity() * sizeof(float) + column.codes.capacity() * sizeof(uint32_t);
+            for (const auto& text : column.dict) bytes += text.capacity();
+        }
+        return bytes;
+    }
+
+   public:
+    // ---- 与 DataTable 互相转换 ----
+
+    /**
+     * @brief 从字符串表格构建类型化表格
+     * @param table 源表格
+     * @param types 每列的类型, 数量必须与源表格列数一致
+     * @param hasHeader 源表格首行是否为列名
+     * @return 转换后的表格; 类型数量不符时返回空表; 遇到无法解析数值的行时停止转换, 返回该行之前的部分
+     */
+    static ColumnTable fromDataTable(DataTable& table, const std::vector<ColumnType>& types, bool hasHeader = true) {
+        ColumnTable result;
+        size_t rowCount = table.getRowSize();
+        size_t colCount = rowCount > 0 ? table.getColSize() : 0;
+        if (types.size() != colCount) {
+            WARN(WarningLevel::ERROR, "ColumnTable 列类型数量(%u)与表格列数(%u)不一致", static_cast<unsigned>(types.size()), static_cast<unsigned>(colCount));
+            return result;
+        }
+
+        for (size_t col = 0; col < colCount; ++col) result.addColumn(hasHeader ? table.getCell(0, col) : "", types[col]);
+        result.reserve(rowCount);
+        for (size_t row = hasHeader ? 1 : 0; row < rowCount; ++row) {
+            if (!result.appendRow(table.getRow(row))) {
+                WARN(WarningLevel::ERROR, "ColumnTable 转换在第 %u 行停止", static_cast<unsigned>(row));
+                break;
+            }
+        }
+        return result;
+    }
+
+    /**
+     * @brief 转换为字符串表格
+     * @param hasHeader 是否将列名作为首行输出
+     */
+    DataTable toDataTable(bool hasHeader = true) const {
+        size_t offset = hasHeader ? 1 : 0;
+        DataTable table(rows + offset, columns.size());
+        for (size_t col = 0; col < columns.size(); ++col) {
+            if (hasHeader) table.replaceCell(columns[col].name, 0, col);
+            for (size_t row = 0; row < rows; ++row) table.replaceCell(getCell(row, col), row + offset, col);
+        }
+        return table;
+    }
+
+   public:
+    // ---- 二进制文件 ----
+
+    /**
+     * @brief 以二进制列式格式保存表格(覆写)
+     * @param filePath 文件路径
+     * @return 成功返回 true
+     */
+    bool saveBinary(const std::string& filePath) {
+        compact();  // 孤立的字典条目不写入文件
+
+        std::vector<ColumnDesc> descs(columns.size());
+        std::vector<std::vector<uint32_t>> dictOffsets(columns.size());
+        std::string names;
+
+        // 1. 计算各列数据块在文件中的偏移(紧跟在文件头、列描述与列名之后)
+        for (const auto& column : columns) names += column.name;
+        uint32_t offset = align4(sizeof(FileHeader) + sizeof(ColumnDesc) * columns.size() + names.size());
+
+        for (size_t col = 0; col < columns.size(); ++col) {
+            const Column& column = columns[col];
+            ColumnDesc& desc = descs[col];
+            desc.type = static_cast<uint8_t>(column.type);
+            desc.name_size = static_cast<uint32_t>(column.name.size());
+            desc.data_offset = offset;
+            desc.data_size = static_cast<uint32_t>(rows * 4);  // 三种列的元素都是 4 字节
+            offset = align4(offset + desc.data_size);
+
+            if (column.type == ColumnType::String) {
+                std::vector<uint32_t>& offsets = dictOffsets[col];
+                offsets.reserve(column.dict.size() + 1);
+                uint32_t chars = 0;
+                for (const auto& text : column.dict) {
+                    offsets.push_back(chars);
+                    chars += static_cast<uint32_t>(text.size());
+                }
+                offsets.push_back(chars);
+                desc.dict_count = static_cast<uint32_t>(column.dict.size());
+                desc.dict_size = static_cast<uint32_t>(offsets.size() * sizeof(uint32_t) + chars);
+                offset = align4(offset + desc.dict_size);
+            }
+        }
+
+        FileHeader header;
+        header.rows = static_cast<uint32_t>(rows);
+        header.cols = static_cast<uint32_t>(columns.size());
+
+        // 2. 按文件顺序列出所有数据段, 由写入回调依次拷贝进写缓冲区
+        static const uint8_t padding[4] = {0, 0, 0, 0};
+        std::vector<std::pair<const void*, size_t>> segments;
+        size_t position = 0;
+        auto push = [&](const void* data, size_t size) {
+            if (size > 0) segments.emplace_back(data, size);
+            position += size;
+        };
+        auto pad = [&]() { push(padding, align4(position) - position); };
+
+        push(&header, sizeof(header));
+        push(descs.data(), sizeof(ColumnDesc) * descs.size());
+        push(names.data(), names.size());
+        pad();
+        for (size_t col = 0; col < columns.size(); ++col) {
+            const Column& column = columns[col];
+            switch (column.type) {
+                case ColumnType::Int32: push(column.ints.data(), rows * sizeof(int32_t)); break;
+                case ColumnType::Float: push(column.floats.data(), rows * sizeof(float)); break;
+                case ColumnType::String: push(column.codes.data(), rows * sizeof(uint32_t)); break;
+            }
+            pad();
+            if (column.type == ColumnType::String) {
+                push(dictOffsets[col].data(), dictOffsets[col].size() * sizeof(uint32_t));
+                for (const auto& text : column.dict) push(text.data(), text.size());
+                pad();
+            }
+        }
+
+        size_t segment = 0, segmentPos = 0;
+        bool success = file.writeFileChunks(
+            filePath,
+            [&](uint8_t* buffer, size_t capacity) -> size_t {
+                size_t filled = 0;
+                while (filled < capacity && segment < segments.size()) {
+                    size_t count = std::min(capacity - filled, segments[segment].second - segmentPos);
+                    std::memcpy(buffer + filled, static_cast<const uint8_t*>(segments[segment].first) + segmentPos, count);
+                    filled += count;
+                    segmentPos += count;
+                    if (segmentPos == segments[segment].second) {
+                        ++segment;
+                        segmentPos = 0;
+                    }
+                }
+                return filled;
+            },
+            "w", position);
+
+        if (!success) WARN(WarningLevel::ERROR, "ColumnTable 文件写入失败: %s", filePath.c_str());
+        return success;
+    }
+
+    /**
+     * @brief 从二进制列式文件加载表格(覆盖当前内容)
+     *
+     * 每列数据块直接读入列数组, 不做逐格解析.
+     * @param filePath 文件路径
+     * @return 成功返回 true; 文件不存在或格式错误时返回 false 且表格为空
+     */
+    bool loadBinary(const std::string& filePath) {
+        columns.clear();
+        rows = 0;
+
+        FileExplorer::writeCache().flush(filePath);  // 先写回缓冲数据
+        FSInterface fs;
+        if (!fs.exists(filePath) || !fs.open(filePath, "r")) {
+            WARN(WarningLevel::ERROR, "ColumnTable 文件无法打开: %s", filePath.c_str());
+            return false;
+        }
+
+        BinaryReader reader{fs, fs.getSize()};
+        bool success = readBinary(reader);
+        fs.close();
+
+        if (!success) {
+            columns.clear();
+            rows = 0;
+            WARN(WarningLevel::ERROR, "ColumnTable 文件格式错误: %s", filePath.c_str());
+        }
+        return success;
+    }
+
+   public:
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
+   private:
+    // 文件头(16 字节)
+    struct FileHeader {
+        char magic[4] = {'G', 'S', 'C', 'T'};
+        uint16_t version = 1;
+        uint16_t byte_order = 0x0102;  // 以本机字节序写入, 读取时用于识别字节序
+        uint32_t rows = 0;
+        uint32_t cols = 0;
+    };
+
+    // 列描述(24 字节)
+    struct ColumnDesc {
+        uint8_t type = 0;
+        uint8_t reserved[3] = {0, 0, 0};
+        uint32_t name_size = 0;    // 列名长度
+        uint32_t data_offset = 0;  // 数据块在文件中的偏移
+        uint32_t data_size = 0;    // 数据块大小
+        uint32_t dict_count = 0;   // 字典条目数(仅 String 列)
+        uint32_t dict_size = 0;    // 字典大小(仅 String 列, 紧跟在对齐后的数据块之后)
+    };
+
+    static_assert(sizeof(FileHeader) == 16, "FileHeader layout must be 16 bytes");
+    static_assert(sizeof(ColumnDesc) == 24, "ColumnDesc layout must be 24 bytes");
+
+    // 顺序读取器: 记录当前位置, 支持跳过对齐填充
+    struct BinaryReader {
+        FSInterface& fs;
+        uint64_t size = 0;  // 文件大小, 用于在分配内存前校验文件头中的长度字段
+        size_t position = 0;
+
+        bool read(void* buffer, size_t size) {
+            if (size == 0) return true;
+            size_t count = fs.read(buffer, size);
+            position += count;
+            return count == size;
+        }
+        bool skipTo(size_t offset) {
+            uint8_t scratch[4];
+            while (position < offset)
+                if (!read(scratch, std::min(sizeof(scratch), offset - position))) return false;
+            return position == offset;
+        }
+    };
+
+    bool readBinary(BinaryReader& reader) {
+        FileHeader header;
+        if (!reader.read(&header, sizeof(header)) || std::memcmp(header.magic, "GSCT", 4) != 0) return false;
+        if (header.version != 1 || header.byte_order != 0x0102) return false;
+
+        // 行数与列数来自文件, 分配前先确认文件足够容纳对应的列描述与数据块(以 64 位计算, 避免溢出)
+        const uint64_t dataSize = static_cast<uint64_t>(header.rows) * 4;
+        if (sizeof(FileHeader) + static_cast<uint64_t>(header.cols) * sizeof(ColumnDesc) > reader.size || dataSize > reader.size) return false;
+
+        std::vector<ColumnDesc> descs(header.cols);
+        if (!reader.read(descs.data(), sizeof(ColumnDesc) * descs.size())) return false;
+
+        for (const ColumnDesc& desc : descs) {
+            if (desc.data_size != dataSize || static_cast<uint64_t>(desc.data_offset) + desc.data_size > reader.size) return false;
+            if (desc.name_size > reader.size || desc.dict_size > reader.size) return false;
+            if (desc.type == static_cast<uint8_t>(ColumnType::String) && (static_cast<uint64_t>(desc.dict_count) + 1) * sizeof(uint32_t) > desc.dict_size) return false;
+        }
+
+        rows = header.rows;
+        columns.resize(header.cols);
+        for (size_t col = 0; col < columns.size(); ++col) {
+            if (static_cast<uint64_t>(reader.position) + descs[col].name_size > reader.size) return false;
+            columns[col].type = static_cast<ColumnType>(descs[col].type);
+            columns[col].name.resize(descs[col].name_size);
+            if (!reader.read(&columns[col].name[0], descs[col].name_size)) return false;
+        }
+
+        for (size_t col = 0; col < columns.size(); ++col) {
+            Column& column = columns[col];
+            const ColumnDesc& desc = descs[col];
+            if (!reader.skipTo(desc.data_offset)) return false;
+
+            switch (column.type) {
+                case ColumnType::Int32:
+                    column.ints.resize(rows);
+                    if (!reader.read(column.ints.data(), desc.data_size)) return false;
+                    break;
+                case ColumnType::Float:
+                    column.floats.resize(rows);
+                    if (!reader.read(column.floats.data(), desc.data_size)) return false;
+                    break;
+                case ColumnType::String: {
+                    column.codes.resize(rows);
+                    if (!reader.read(column.codes.data(), desc.data_size)) return false;
+                    if (!reader.skipTo(align4(desc.data_offset + desc.data_size))) return false;
+
+                    // 字典: 偏移表 + 字符数据
+                    std::vector<uint32_t> offsets(desc.dict_count + 1);
+                    if (desc.dict_count == 0 || !reader.read(offsets.data(), offsets.size() * sizeof(uint32_t))) return false;
+                    if (offsets.size() * sizeof(uint32_t) + static_cast<uint64_t>(offsets.back()) != desc.dict_size) return false;
+                    std::string chars(offsets.back(), '\0');
+                    if (!reader.read(&chars[0], chars.size())) return false;
+
+                    column.dict.reserve(desc.dict_count);
+                    for (size_t i = 0; i < desc.dict_count; ++i) {
+                        if (offsets[i] > offsets[i + 1] || offsets[i + 1] > chars.size()) return false;
+                        column.dict.emplace_back(chars, offsets[i], offsets[i + 1] - offsets[i]);
+                    }
+                    for (uint32_t code : column.codes)
+                        if (code >= column.dict.size()) return false;
+                    break;
+                }
+                default:
+                    return false;
+            }
+        }
+        return true;
+    }
+
+    // 对数值列逐行求值谓词
+    template <typename Predicate>
+    std::vector<size_t> scan(size_t col, Predicate predicate) const {
+        std::vector<size_t> result;
+        if (col >= columns.size()) return result;
+        const Column& column = columns[col];
+        if (column.type == ColumnType::Int32) {
+            for (size_t row = 0; row < rows; ++row)
+                if (predicate(column.ints[row])) result.push_back(row);
+        } else if (column.type == ColumnType::Float) {
+            for (size_t row = 0; row < rows; ++row)
+                if (predicate(column.floats[row])) result.push_back(row);
+        }
+        return result;
+    }
+
+    // 获取字符串的字典编码, 不存在时加入字典
+    static uint32_t encode(Column& column, const std::string& value) {
+        if (value.empty()) return 0;
+        if (column.lookup.size() + 1 != column.dict.size()) rebuildLookup(column);
+
+        auto it = column.lookup.find(value);
+        if (it != column.lookup.end()) return it->second;
+
+        uint32_t code = static_cast<uint32_t>(column.dict.size());
+        column.dict.push_back(value);
+        column.lookup.emplace(value, code);
+        return code;
+    }
+
+    // 丢弃未被引用的字典条目并重新编号(按首次出现的行序), 随后重建反查表
+    static void compactDictionary(Column& column) {
+        std::vector<uint32_t> remap(column.dict.size(), 0);  // 旧编码 -> 新编码, 0 表示尚未映射
+        std::vector<std::string> dict(1);
+        for (uint32_t& code : column.codes) {
+            if (code == 0) continue;
+            if (remap[code] == 0) {
+                remap[code] = static_cast<uint32_t>(dict.size());
+                dict.push_back(std::move(column.dict[code]));
+            }
+            code = remap[code];
+        }
+        column.dict = std::move(dict);
+        rebuildLookup(column);
+    }
+
+    // 查找字符串的字典编码(不修改字典)
+    static bool findCode(const Column& column, const std::string& value, uint32_t& code) {
+        if (value.empty()) {
+            code = 0;
+            return true;
+        }
+        if (column.lookup.size() + 1 == column.dict.size()) {
+            auto it = column.lookup.find(value);
+            if (it == column.lookup.end()) return false;
+            code = it->second;
+            return true;
+        }
+        // 反查表尚未建立(例如刚从文件加载), 线性查找字典
+        for (size_t i = 1; i < column.dict.size(); ++i) {
+            if (column.dict[i] == value) {
+                code = static_cast<uint32_t>(i);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // 按字典重建反查表(编码 0 的空字符串不入表)
+    static void rebuildLookup(Column& column) {
+        column.lookup.clear();
+        column.lookup.reserve(column.dict.size());
+        for (size_t i = 1; i < column.dict.size(); ++i) column.lookup.emplace(column.dict[i], static_cast<uint32_t>(i));
+    }
+
+    static bool parseInt(const std::string& text, int32_t& value) {
+        if (text.empty()) return (value = 0), true;
+        char* end = nullptr;
+        long parsed = std::strtol(text.c_str(), &end, 10);
+        if (end == text.c_str() || *end != '\0' || parsed < INT32_MIN || parsed > INT32_MAX) return false;
+        value = static_cast<int32_t>(parsed);
+        return true;
+    }
+
+    static bool parseFloat(const std::string& text, float& value) {
+        if (text.empty()) return (value = 0.0f), true;
+        char* end = nullptr;
+        value = std::strtof(text.c_str(), &end);
+        return end != text.c_str() && *end == '\0';
+    }
+
+    static uint32_t align4(size_t value) { return static_cast<uint32_t>((value + 3) & ~static_cast<size_t>(3)); }
+
+   private:
+    std::vector<Column> columns;
+    size_t rows = 0;
+    FileExplorer file;
+};
@@ -0,0 +1,205 @@
+/**
+ * @file csv_parser.hpp
+ * @date 17.10.2026
+ * @author RMSHE
+ *
+ * < GasSensorOS >
+ * Copyright(C) 2026 RMSHE. All rights reserved.
+ *
+ * This program is free software : you can redistribute it and /or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.If not, see < https://www.gnu.org/licenses/>.
+ *
+ * Electronic Mail : asdfghjkl851@outlook.com
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief 流式 CSV 解析器(RFC 4180)
+ *
+ * 数据可以任意切分成多块依次传入 `feed()`，解析器只扫描一遍输入，每解析出一条记录就交给回调函数。
+ * 单元格直接在当前行中构造，回调可以用 `std::move` 取走整行，不产生中间字符串。
+ *
+ * 支持的格式：
+ * - 以 `,`(或构造时指定的分隔符)分隔单元格，以 `\n` 或 `\r\n` 结束一条记录；
+ * - 以 `"` 包围的单元格可以包含分隔符、换行符，其中的 `""` 表示一个 `"`；
+ * - 不以 `"` 开头的单元格中的 `"` 按普通字符处理(宽松模式)。
+ *
+ * @note 非线程安全。
+ */
+class CSVParser {
+   public:
+    using Row = std::vector<std::string>;
+    using RowHandler = std::function<void(Row& row)>;  // 接收一条记录, 可以 std::move 取走 row
+
+    /**
+     * @brief 构造函数
+     * @param onRow 每解析出一条记录时调用
+     * @param delimiter 单元格分隔符
+     */
+    explicit CSVParser(RowHandler onRow, char delimiter = ',') : on_row_(std::move(onRow)), delimiter_(delimiter) {}
+
+    /**
+     * @brief 解析一块数据
+     * 记录可以跨越多个块，未结束的记录保留到下一次 `feed()` 或 `finish()`。
+     * @param data 数据指针
+     * @param size 数据字节数
+     */
+    void feed(const char* data, size_t size) {
+        const char* p = data;
+        const char* end = data + size;
+
+        while (p < end) {
+            switch (state_) {
+                case State::FieldStart:
+                    if (*p == '"') {
+                        state_ = State::Quoted;
+                        ++p;
+                        break;
+                    }
+                    state_ = State::Unquoted;
+                    // fall through
+                case State::Unquoted: {
+                    // 整段复制到下一个分隔符或换行符之前
+                    const char* stop = p;
+                    while (stop < end && *stop != delimiter_ && *stop != '\n' && *stop != '\r') ++stop;
+                    field_.append(p, stop);
+                    p = stop;
+                    if (p < end) separator(*p++);
+                    break;
+                }
+                case State::Quoted: {
+                    // 整段复制到下一个引号之前
+                    const char* quote = static_cast<const char*>(std::memchr(p, '"', end - p));
+                    if (quote == nullptr) {
+                        field_.append(p, end);
+                        p = end;
+                    } else {
+                        field_.append(p, quote);
+                        p = quote + 1;
+                        state_ = State::QuoteInQuoted;
+                    }
+                    break;
+                }
+                case State::QuoteInQuoted:
+                    if (*p == '"') {
+                        field_.push_back('"');  // "" 转义为一个引号
+                        state_ = State::Quoted;
+                    } else if (*p == delimiter_ || *p == '\n' || *p == '\r') {
+                        separator(*p);
+                    } else {
+                        field_.push_back(*p);  // 引号后的多余字符按普通字符保留
+                        state_ = State::Unquoted;
+                    }
+                    ++p;
+                    break;
+                case State::CarriageReturn:
+                    // \r\n 作为一个换行; 单独的 \r 已经结束了记录
+                    state_ = State::FieldStart;
+                    if (*p == '\n') ++p;
+                    break;
+            }
+        }
+    }
+
+    /**
+     * @brief 结束输入并提交最后一条记录(文件末尾没有换行符时)
+     * @return 输入格式完整返回 true; 引号未闭合时仍提交已解析的内容并返回 false
+     */
+    bool finish() {
+        bool complete = state_ != State::Quoted;
+
+        if (state_ != State::FieldStart && state_ != State::CarriageReturn) {
+            endRecord();
+        } else if (!row_.empty()) {
+            endRecord();  // 以分隔符结尾的最后一行
+        }
+        state_ = State::FieldStart;
+        return complete;
+    }
+
+    // 已提交的记录数
+    size_t rowCount() const { return rows_; }
+
+    /**
+     * @brief 将单元格按 CSV 格式追加到字符串(解析的逆过程)
+     * 单元格包含分隔符、引号或换行符时用引号包围，并将其中的引号写成 `""`。
+     * @param out 输出字符串
+     * @param field 单元格内容
+     * @param delimiter 单元格分隔符
+     */
+    static void appendField(std::string& out, const std::string& field, char delimiter = ',') {
+        const char specials[] = {delimiter, '"', '\n', '\r', '\0'};
+        if (field.find_first_of(specials) == std::string::npos) {
+            out += field;
+            return;
+        }
+
+        out.push_back('"');
+        for (char c : field) {
+            if (c == '"') out.push_back('"');
+            out.push_back(c);
+        }
+        out.push_back('"');
+    }
+
+   private:
+    enum class State : uint8_t {
+        FieldStart,     // 单元格开头
+        Unquoted,       // 普通单元格中
+        Quoted,         // 引号单元格中
+        QuoteInQuoted,  // 引号单元格中遇到引号(可能是转义或结束)
+        CarriageReturn  // 刚读到记录末尾的 \r
+    };
+
+    // 处理单元格外的分隔符或换行符
+    void separator(char c) {
+        if (c == delimiter_) {
+            endField();
+            state_ = State::FieldStart;
+        } else {
+            endRecord();
+            state_ = (c == '\r') ? State::CarriageReturn : State::FieldStart;
+        }
+    }
+
+    void endField() {
+        row_.push_back(std::move(field_));
+        field_.clear();
+    }
+
+    void endRecord() {
+        endField();
+        size_t cols = row_.size();
+        ++rows_;
+        on_row_(row_);
+
+        // 回调可能已取走整行; 按上一行的列数预留, 避免逐格扩容
+        row_.clear();
+        row_.reserve(cols);
+    }
+
+    RowHandler on_row_;
+    char delimiter_;
+    State state_ = State::FieldStart;
+    std::string field_;  // 正在解析的单元格
+    Row row_;            // 正在解析的记录
+    size_t rows_ = 0;    // 已提交的记录数
+};
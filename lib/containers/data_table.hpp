@@ -26,35 +26,76 @@
 
 #pragma once
 
+#include <csv_parser.hpp>
 #include <file_explorer.h>
 
 #include <algorithm>
+#include <cell_store.hpp>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
 #include <fstream>
+#include <functional>
 #include <iostream>
+#include <limits>
+#include <map>
 #include <serial_warning.hpp>
 #include <sstream>
 #include <stdexcept>
 #include <string>
 #include <string_edit.hpp>
+#include <unordered_map>
 #include <vector>
 
+#if !defined(ARDUINO)
+#include <thread>
+#endif
+
 class DataTable {
    public:
     using Row = std::vector<std::string>;
     using Table = std::vector<Row>;
 
+    // 列二级索引的类型
+    enum class IndexType {
+        Hash,    // 哈希索引: 等值查找 O(1)
+        Sorted,  // 有序索引: 等值/范围/前缀查找 O(log n)
+    };
+
+    // 单元格存储的内存占用统计(不含二级索引)
+    struct MemoryStats {
+        size_t cells = 0;          // 单元格数
+        size_t uniqueStrings = 0;  // 去重后的非空字符串数
+        size_t cellBytes = 0;      // 单元格 ID 数组占用的字节数
+        size_t poolBytes = 0;      // 字符串池占用的字节数(估算)
+        size_t totalBytes = 0;     // cellBytes + poolBytes
+        float bytesPerCell = 0;    // 平均每个单元格占用的字节数
+        float poolHitRate = 0;     // 写入单元格时命中已有字符串(含空字符串)的比例
+    };
+
+    // groupBy 的单组聚合结果
+    struct GroupStats {
+        std::string key;   // 分组键
+        size_t rows = 0;   // 组内行数
+        size_t count = 0;  // 参与聚合的数值个数(非数值单元格被跳过)
+        double sum = 0;
+        double min = 0;
+        double max = 0;
+        double mean = 0;
+    };
+
     /**
      * @brief 构造函数：初始化数据表的行数和列数
      * @param rows 数据表的行数
      * @param cols 数据表的列数
      */
-    DataTable(size_t rows, size_t cols, const std::string& defaultValue = "") : data(rows, Row(cols, defaultValue)) {}
+    DataTable(size_t rows, size_t cols, const std::string& defaultValue = "") : data(rows, cols, defaultValue) {}
 
     // 获取表格的行数
-    size_t getRowSize() { return data.size(); }
+    size_t getRowSize() { return data.rows(); }
 
     // 获取表格的列数
-    size_t getColSize() { return data[0].size(); }
+    size_t getColSize() { return data.cols(); }
 
     /**
      * @brief 替换数据到指定单元格
@@ -64,7 +105,11 @@ class DataTable {
      */
     void replaceCell(const std::string& value, size_t row, size_t col) {
         if (!checkBounds(row, col)) return;
-        data[row][col] = value;
+        markModified(row);
+        ColumnIndex* index = liveIndex(col);
+        if (index != nullptr) indexRemove(*index, row, col);
+        data.set(row, col, value);
+        if (index != nullptr) indexAdd(*index, row, col);
     }
 
     /**
@@ -77,14 +122,11 @@ class DataTable {
 
         size_t row_size = getColSize();
 
-        // 创建一个与表格行长度匹配的行数据
-        Row newRow(row_size, "");
-
-        // 将要替换的值复制到新行中，多余的部分自动截断，缺失的部分置空
-        std::copy(values.begin(), values.begin() + std::min(values.size(), row_size), newRow.begin());
-
-        // 将新行替换到指定行位置
-        data[row] = newRow;
+        // 将要替换的值写入指定行，多余的部分自动截断，缺失的部分置空
+        markModified(row);
+        indexEraseRow(row);
+        for (size_t col = 0; col < row_size; ++col) data.set(row, col, col < values.size() ? values[col] : std::string());
+        indexInsertRow(row);
     }
 
     /**
@@ -97,16 +139,12 @@ class DataTable {
 
         size_t col_size = getRowSize();
 
-        // 创建一个与表格行数匹配的新列数据
-        std::vector<std::string> newCol(col_size, "");
-
-        // 将要替换的值复制到新列中，多余的部分自动截断，缺失的部分置空
-        std::copy(values.begin(), values.begin() + std::min(values.size(), col_size), newCol.begin());
-
-        // 将新列数据替换到指定列位置
+        // 将要替换的值写入指定列，多余的部分自动截断，缺失的部分置空
         for (size_t i = 0; i < col_size; ++i) {
-            data[i][col] = newCol[i];
+            data.set(i, col, i < values.size() ? values[i] : std::string());
         }
+        invalidateIndex(col);  // 整列被替换, 该列索引在下次查找时重建
+        markModified();
     }
 
     /**
@@ -140,7 +178,7 @@ class DataTable {
         }
 
         // 在指定的单元格位置插入数据，并将目标位置之后的数据向后移动
-        data[row][col] = value;
+        data.set(row, col, value);
     }
 
     /**
@@ -153,21 +191,16 @@ class DataTable {
      * 到表格的最后一行。
      */
     void insertRow(const std::vector<std::string>& values = Row(), size_t row = std::numeric_limits<size_t>::max()) {
-        size_t col_size = getColSize();  // 获取当前表格的列数
-
-        std::vector<std::string> newRow(col_size, "");
-
-        // 如果 values 非空，将其中的内容复制到新行中，多余部分截断
-        if (!values.empty()) {
-            std::copy(values.begin(), values.begin() + std::min(values.size(), col_size), newRow.begin());
-        }
-
-        // 如果行位置超出表格范围，将新行追加到末尾
+        // 如果行位置超出表格范围，将新行追加到末尾; values 多余部分截断，缺失部分置空
         if (row >= getRowSize()) {
-            data.emplace_back(std::move(newRow));
+            row = getRowSize();
+            data.insertRow(row, values);
         } else {
-            data.insert(data.begin() + row, std::move(newRow));
+            data.insertRow(row, values);
+            invalidateIndexes();  // 插入点之后的行号全部后移, 索引在下次查找时一次性重建
+            markModified(row);
         }
+        indexInsertRow(row);
     }
 
     /**
@@ -180,17 +213,19 @@ class DataTable {
      * 到表格的最后一列。
      */
     void insertCol(const std::vector<std::string>& values = std::vector<std::string>(), size_t col = std::numeric_limits<size_t>::max()) {
-        size_t row_size = getRowSize();  // 获取当前表格的行数
         size_t col_size = getColSize();  // 获取当前表格的列数
 
         // 如果 col 参数超出范围或未指定，默认将新列追加到末尾
         if (col >= col_size) col = col_size;
 
-        // 遍历每一行，在指定位置插入新列
-        for (size_t i = 0; i < row_size; ++i) {
-            std::string value = (i < values.size()) ? values[i] : "";  // 多余部分自动截断，缺失部分置空
-            data[i].insert(data[i].begin() + col, std::move(value));   // 在指定位置插入数据
-        }
+        // 在每一行的指定位置插入新列，多余部分自动截断，缺失部分置空
+        data.insertCol(col, values);
+
+        // 插入点及之后的列索引随列一起右移
+        std::map<size_t, ColumnIndex> shifted;
+        for (auto& entry : indexes) shifted.emplace(entry.first >= col ? entry.first + 1 : entry.first, std::move(entry.second));
+        indexes = std::move(shifted);
+        markModified();
     }
 
     /**
@@ -201,7 +236,7 @@ class DataTable {
      */
     std::string getCell(size_t row, size_t col) const {
         if (!checkBounds(row, col)) return "";  // 检查列索引是否越界
-        return data[row][col];
+        return data.get(row, col);
     }
 
     /**
@@ -211,7 +246,7 @@ class DataTable {
      */
     std::vector<std::string> getRow(size_t row) const {
         if (!checkRowBounds(row)) return {};  // 检查行索引是否越界
-        return data[row];
+        return data.row(row);
     }
 
     /**
@@ -223,8 +258,9 @@ class DataTable {
         if (!checkColBounds(col)) return {};  // 检查列索引是否越界
 
         std::vector<std::string> column;
-        for (const auto& row : data) {
-            column.push_back(row[col]);
+        column.reserve(data.rows());
+        for (size_t row = 0; row < data.rows(); ++row) {
+            column.push_back(data.get(row, col));
         }
         return column;
     }
@@ -245,7 +281,10 @@ class DataTable {
      */
     void clearRow(size_t row) {
         if (!checkRowBounds(row)) return;  // 检查行索引是否越界
-        std::fill(data[row].begin(), data[row].end(), "");
+        markModified(row);
+        indexEraseRow(row);
+        data.clearRow(row);
+        indexInsertRow(row);
     }
 
     /**
@@ -254,16 +293,20 @@ class DataTable {
      */
     void clearCol(size_t col) {
         if (!checkColBounds(col)) return;  // 检查列索引是否越界
-        for (auto& row : data) {
-            row[col] = "";
+        for (size_t row = 0; row < getRowSize(); ++row) {
+            data.set(row, col, std::string());
         }
+        invalidateIndex(col);
+        markModified();
     }
 
     /**
      * @brief 清空整个数据表
      */
     void clear() {
-        for (auto& row : data) std::fill(row.begin(), row.end(), "");
+        data.clearCells();
+        invalidateIndexes();
+        markModified();
     }
 
     /**
@@ -274,8 +317,12 @@ class DataTable {
      */
     void deleteRow(size_t row) {
         if (!checkRowBounds(row)) return;  // 检查行索引是否越界
-        data.erase(data.begin() + row);    // 删除指定的行
-        data.shrink_to_fit();              // 释放未使用的内存
+        if (row + 1 == getRowSize())
+            indexEraseRow(row);   // 删除末行不影响其他行号, 增量更新
+        else
+            invalidateIndexes();  // 删除点之后的行号全部前移, 索引在下次查找时一次性重建
+        data.eraseRow(row);       // 删除指定的行
+        markModified(row);
     }
 
     /**
@@ -288,12 +335,15 @@ class DataTable {
     void deleteCol(size_t col) {
         if (!checkColBounds(col)) return;  // 检查列索引是否越界
 
-        for (auto& row : data) {
-            row.erase(row.begin() + col);  // 删除每一行中的指定列
-            row.shrink_to_fit();           // 释放每行未使用的内存
-        }
+        data.eraseCol(col);  // 删除每一行中的指定列
+        data.shrinkToFit();  // 释放未使用的内存
 
-        data.shrink_to_fit();  // 释放整体数据表未使用的内存
+        // 删除该列的索引, 之后的列索引随列一起左移
+        std::map<size_t, ColumnIndex> shifted;
+        for (auto& entry : indexes)
+            if (entry.first != col) shifted.emplace(entry.first > col ? entry.first - 1 : entry.first, std::move(entry.second));
+        indexes = std::move(shifted);
+        markModified();
     }
 
     /**
@@ -305,8 +355,15 @@ class DataTable {
         // 检查行索引是否有效
         if (!checkRowBounds(row1) || !checkRowBounds(row2)) return;
 
+        if (row1 == row2) return;
+
         // 使用 std::swap 直接交换两行的内容
-        std::swap(data[row1], data[row2]);
+        markModified(std::min(row1, row2));
+        indexEraseRow(row1);
+        indexEraseRow(row2);
+        data.swapRows(row1, row2);
+        indexInsertRow(row1);
+        indexInsertRow(row2);
     }
 
     /**
@@ -319,8 +376,20 @@ class DataTable {
         if (!checkColBounds(col1) || !checkColBounds(col2)) return;
 
         // 遍历每一行，交换指定列的数据
-        for (auto& row : data) {
-            std::swap(row[col1], row[col2]);
+        data.swapCols(col1, col2);
+        if (col1 != col2) markModified();
+
+        // 列索引随列一起交换
+        auto it1 = indexes.find(col1);
+        auto it2 = indexes.find(col2);
+        if (it1 != indexes.end() && it2 != indexes.end()) {
+            std::swap(it1->second, it2->second);
+        } else if (it1 != indexes.end()) {
+            indexes[col2] = std::move(it1->second);
+            indexes.erase(col1);
+        } else if (it2 != indexes.end()) {
+            indexes[col1] = std::move(it2->second);
+            indexes.erase(col2);
         }
     }
 
@@ -330,17 +399,20 @@ class DataTable {
      * @param newCols 新的列数
      */
     void resize(size_t newRows, size_t newCols) {
-        // 先调整行数，如果减少行数则多余的行会被裁剪掉
-        data.resize(newRows);
+        // 被裁剪掉的列不再保留索引, 被裁剪掉的行先移出索引
+        indexes.erase(indexes.lower_bound(newCols), indexes.end());
+        size_t oldRows = data.rows();
+        for (size_t row = newRows; row < oldRows; ++row) indexEraseRow(row);
 
-        // 调整每一行的列数，并释放多余的内存
-        for (auto& row : data) {
-            row.resize(newCols);  // 调整列数
-            row.shrink_to_fit();  // 释放多余的列内存
-        }
+        // 列数变化影响所有已保存的行; 只减少行数时影响被裁剪掉的行
+        markModified(newCols != data.cols() ? 0 : newRows);
+
+        // 调整行列数，被裁剪掉的单元格被释放，新增的单元格为空
+        data.resize(newRows, newCols);
+        data.shrinkToFit();  // 释放多余的内存
 
-        // 最后释放多余的行内存
-        data.shrink_to_fit();
+        // 新增的行加入索引
+        for (size_t row = oldRows; row < newRows; ++row) indexInsertRow(row);
     }
 
     /**
@@ -373,11 +445,22 @@ class DataTable {
         size_t colBegin = std::min(startCol, endCol);
         size_t colEnd = std::max(startCol, endCol);
 
+        // 只查询一列且该列建有索引时, 直接由索引得到匹配的行
+        if (colBegin == colEnd && liveIndex(colBegin) != nullptr) {
+            for (size_t row : findRows(value, colBegin))
+                if (row >= rowBegin && row <= rowEnd) results.emplace_back(row, colBegin);
+            return results;
+        }
+
+        // 单元格以驻留字符串 ID 存储: 值不在字符串池中时不可能匹配, 否则只需比较 ID
+        StringPool::Id id = data.pool().find(value);
+        if (id == StringPool::kNotFound) return results;
+
         // 遍历指定范围内的单元格
         for (size_t row = rowBegin; row <= rowEnd; ++row) {
             for (size_t col = colBegin; col <= colEnd; ++col) {
                 // 查找匹配的值
-                if (data[row][col] == value) {
+                if (data.id(row, col) == id) {
                     results.emplace_back(row, col);  // 找到匹配项，添加到结果中
                 }
             }
@@ -386,6 +469,344 @@ class DataTable {
         return results;  // 返回所有匹配的单元格位置
     }
 
+    /**
+     * @brief 为指定列建立二级索引(已有索引时按新类型重建)
+     *
+     * 索引随 insertRow/deleteRow/replaceCell/replaceRow/swapRows/resize 等操作增量维护；
+     * 整列或整表被替换(如 replaceCol、loadTable)时标记失效, 在下次查找时重建。
+     * @param col 要建立索引的列
+     * @param type 索引类型: Hash 仅支持等值查找, Sorted 额外支持范围与前缀查找
+     */
+    void createIndex(size_t col, IndexType type = IndexType::Hash) {
+        if (!checkColBounds(col)) return;
+        ColumnIndex& index = indexes[col];
+        index = ColumnIndex();
+        index.type = type;
+    }
+
+    // 删除指定列的二级索引
+    void dropIndex(size_t col) { indexes.erase(col); }
+
+    // 指定列是否建有二级索引
+    bool hasIndex(size_t col) const { return indexes.count(col) != 0; }
+
+    /**
+     * @brief 查找指定列中等于 value 的所有行
+     * 该列建有索引时为 O(1)(哈希)或 O(log n)(有序), 否则只扫描这一列。
+     * @param value 查找的值
+     * @param col 查找的列
+     * @return 匹配的行索引(升序)
+     */
+    std::vector<size_t> findRows(const std::string& value, size_t col) {
+        std::vector<size_t> rows;
+        if (!checkColBounds(col)) return rows;
+
+        StringPool::Id id = data.pool().find(value);
+        if (id == StringPool::kNotFound) return rows;  // 表格中没有这个值
+
+        if (ColumnIndex* index = liveIndex(col)) {
+            if (index->type == IndexType::Hash) {
+                auto range = index->hash.equal_range(id);
+                for (auto it = range.first; it != range.second; ++it) rows.push_back(it->second);
+            } else {
+                auto range = index->sorted.equal_range(value);
+                for (auto it = range.first; it != range.second; ++it) rows.push_back(it->second);
+            }
+            std::sort(rows.begin(), rows.end());
+            return rows;
+        }
+
+        for (size_t row = 0; row < data.rows(); ++row)
+            if (data.id(row, col) == id) rows.push_back(row);
+        return rows;
+    }
+
+    /**
+     * @brief 查找指定列中第一个等于 value 的行
+     * @param value 查找的值
+     * @param col 查找的列
+     * @param row 输出匹配的最小行索引
+     * @return 找到返回 true
+     */
+    bool findRow(const std::string& value, size_t col, size_t& row) {
+        std::vector<size_t> rows = findRows(value, col);
+        if (rows.empty()) return false;
+        row = rows.front();
+        return true;
+    }
+
+    /**
+     * @brief 查找指定列中按字典序位于 [low, high] 区间内的所有行
+     * 该列建有有序索引时为 O(log n + k), 否则扫描这一列。
+     * @return 匹配的行索引(升序)
+     */
+    std::vector<size_t> findRange(const std::string& low, const std::string& high, size_t col) {
+        std::vector<size_t> rows;
+        if (!checkColBounds(col)) return rows;
+
+        ColumnIndex* index = liveIndex(col);
+        if (index != nullptr && index->type == IndexType::Sorted) {
+            for (auto it = index->sorted.lower_bound(low); it != index->sorted.end() && it->first <= high; ++it) rows.push_back(it->second);
+            std::sort(rows.begin(), rows.end());
+            return rows;
+        }
+
+        for (size_t row = 0; row < data.rows(); ++row) {
+            const std::string& cell = data.get(row, col);
+            if (cell >= low && cell <= high) rows.push_back(row);
+        }
+        return rows;
+    }
+
+    /**
+     * @brief 查找指定列中以 prefix 开头的所有行
+     * 该列建有有序索引时为 O(log n + k), 否则扫描这一列。
+     * @return 匹配的行索引(升序)
+     */
+    std::vector<size_t> findPrefix(const std::string& prefix, size_t col) {
+        std::vector<size_t> rows;
+        if (!checkColBounds(col)) return rows;
+
+        ColumnIndex* index = liveIndex(col);
+        if (index != nullptr && index->type == IndexType::Sorted) {
+            for (auto it = index->sorted.lower_bound(prefix); it != index->sorted.end() && it->first.compare(0, prefix.size(), prefix) == 0; ++it)
+                rows.push_back(it->second);
+            std::sort(rows.begin(), rows.end());
+            return rows;
+        }
+
+        for (size_t row = 0; row < data.rows(); ++row)
+            if (data.get(row, col).compare(0, prefix.size(), prefix) == 0) rows.push_back(row);
+        return rows;
+    }
+
+    /**
+     * @brief 设置批量操作(getNumericCol/filterRange/groupBy/topK)使用的线程数
+     * 仅在主机端生效, 数据量较小时仍单线程执行; 在 ESP32 上始终单线程。
+     * @param threads 线程数, 0 表示使用硬件并发数
+     */
+    void setBulkThreads(size_t threads) {
+#if !defined(ARDUINO)
+        bulk_threads = threads != 0 ? threads : std::max(1u, std::thread::hardware_concurrency());
+#else
+        (void)threads;
+#endif
+    }
+
+    /**
+     * @brief 将一列解析为连续的 double 数组
+     * 每个不同的值只解析一次(单元格以驻留字符串存储)，无法解析为数值的单元格为 NaN。
+     * 之后的数值运算都在该连续数组上进行，便于编译器向量化。
+     * @param col 列索引
+     * @return 与行一一对应的数值
+     */
+    std::vector<double> getNumericCol(size_t col) const {
+        std::vector<double> values;
+        if (!checkColBounds(col)) return values;
+
+        // 1. 收集该列出现过的不同 ID
+        const size_t rows = data.rows();
+        std::vector<uint8_t> seen(data.pool().idBound(), 0);
+        std::vector<StringPool::Id> ids;
+        for (size_t row = 0; row < rows; ++row) {
+            StringPool::Id id = data.id(row, col);
+            if (!seen[id]) {
+                seen[id] = 1;
+                ids.push_back(id);
+            }
+        }
+
+        // 2. 每个不同的值解析一次
+        std::vector<double> byId(data.pool().idBound(), std::nan(""));
+        parallelFor(ids.size(), [&](size_t begin, size_t end, size_t) {
+            for (size_t i = begin; i < end; ++i) byId[ids[i]] = parseNumber(data.pool().get(ids[i]));
+        });
+
+        // 3. 按行展开
+        values.resize(rows);
+        parallelFor(rows, [&](size_t begin, size_t end, size_t) {
+            for (size_t row = begin; row < end; ++row) values[row] = byId[data.id(row, col)];
+        });
+        return values;
+    }
+
+    /**
+     * @brief 按谓词筛选行
+     * 谓词对该列每个不同的值只调用一次，再按 ID 扫描整列。
+     * @param col 列索引
+     * @param predicate 单元格值满足条件时返回 true
+     * @return 匹配的行索引(升序)
+     */
+    std::vector<size_t> filterRows(size_t col, const std::function<bool(const std::string&)>& predicate) const {
+        std::vector<size_t> rows;
+        if (!checkColBounds(col)) return rows;
+
+        std::vector<int8_t> verdict(data.pool().idBound(), -1);  // -1: 未求值, 0: 不匹配, 1: 匹配
+        for (size_t row = 0; row < data.rows(); ++row) {
+            int8_t& match = verdict[data.id(row, col)];
+            if (match < 0) match = predicate(data.get(row, col)) ? 1 : 0;
+            if (match) rows.push_back(row);
+        }
+        return rows;
+    }
+
+    /**
+     * @brief 筛选数值位于 [low, high] 的行
+     * @return 匹配的行索引(升序)
+     */
+    std::vector<size_t> filterRange(size_t col, double low, double high) const {
+        std::vector<double> values = getNumericCol(col);
+        std::vector<uint8_t> mask(values.size());
+
+        // 无分支的比较循环, 可被向量化
+        parallelFor(values.size(), [&](size_t begin, size_t end, size_t) {
+            for (size_t i = begin; i < end; ++i) mask[i] = (values[i] >= low) & (values[i] <= high);
+        });
+
+        std::vector<size_t> rows;
+        for (size_t i = 0; i < mask.size(); ++i)
+            if (mask[i]) rows.push_back(i);
+        return rows;
+    }
+
+    /**
+     * @brief 按指定列对所有行排序(稳定排序)
+     * @param col 排序依据的列
+     * @param ascending 是否升序
+     * @param numeric 是否按数值比较; 非数值单元格总是排在最后
+     */
+    void sortRows(size_t col, bool ascending = true, bool numeric = false) {
+        if (!checkColBounds(col)) return;
+
+        const size_t rows = data.rows();
+        std::vector<size_t> order(rows);
+        for (size_t row = 0; row < rows; ++row) order[row] = row;
+
+        if (numeric) {
+            std::vector<double> keys = getNumericCol(col);
+            std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+                if (std::isnan(keys[a]) || std::isnan(keys[b])) return !std::isnan(keys[a]) && std::isnan(keys[b]);
+                return ascending ? keys[a] < keys[b] : keys[a] > keys[b];
+            });
+        } else {
+            // 先给每个不同的值按字典序编号, 之后只比较整数
+            std::vector<uint8_t> seen(data.pool().idBound(), 0);
+            std::vector<StringPool::Id> ids;
+            for (size_t row = 0; row < rows; ++row) {
+                StringPool::Id id = data.id(row, col);
+                if (!seen[id]) {
+                    seen[id] = 1;
+                    ids.push_back(id);
+                }
+            }
+            std::sort(ids.begin(), ids.end(), [&](StringPool::Id a, StringPool::Id b) { return data.pool().get(a) < data.pool().get(b); });
+
+            std::vector<uint32_t> rank(data.pool().idBound(), 0);
+            for (size_t i = 0; i < ids.size(); ++i) rank[ids[i]] = static_cast<uint32_t>(i);
+
+            std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+                uint32_t ra = rank[data.id(a, col)], rb = rank[data.id(b, col)];
+                return ascending ? ra < rb : ra > rb;
+            });
+        }
+
+        data.permuteRows(order);
+        invalidateIndexes();
+        markModified();
+    }
+
+    /**
+     * @brief 按 keyCol 分组, 对 valueCol 的数值求 sum/min/max/mean
+     * 分组键以驻留字符串 ID 比较，非数值单元格只计入 rows，不参与聚合。
+     * @param keyCol 分组键所在的列
+     * @param valueCol 聚合的数值列
+     * @return 各组的统计(按分组键首次出现的顺序)
+     */
+    std::vector<GroupStats> groupBy(size_t keyCol, size_t valueCol) const {
+        std::vector<GroupStats> groups;
+        if (!checkColBounds(keyCol) || !checkColBounds(valueCol)) return groups;
+
+        // 1. 为每一行确定分组序号
+        const size_t rows = data.rows();
+        const size_t npos = std::numeric_limits<size_t>::max();
+        std::vector<size_t> groupOfId(data.pool().idBound(), npos);
+        std::vector<uint32_t> groupOfRow(rows);
+        for (size_t row = 0; row < rows; ++row) {
+            size_t& group = groupOfId[data.id(row, keyCol)];
+            if (group == npos) {
+                group = groups.size();
+                groups.emplace_back();
+                groups.back().key = data.get(row, keyCol);
+            }
+            groupOfRow[row] = static_cast<uint32_t>(group);
+        }
+
+        // 2. 各线程分别累加, 最后合并
+        struct Accumulator {
+            size_t rows = 0, count = 0;
+            double sum = 0, min = INFINITY, max = -INFINITY;
+        };
+        std::vector<double> values = getNumericCol(valueCol);
+        std::vector<std::vector<Accumulator>> partial(workerCount(rows), std::vector<Accumulator>(groups.size()));
+        parallelFor(rows, [&](size_t begin, size_t end, size_t worker) {
+            std::vector<Accumulator>& acc = partial[worker];
+            for (size_t row = begin; row < end; ++row) {
+                Accumulator& a = acc[groupOfRow[row]];
+                ++a.rows;
+                double v = values[row];
+                if (std::isnan(v)) continue;
+                ++a.count;
+                a.sum += v;
+                a.min = std::min(a.min, v);
+                a.max = std::max(a.max, v);
+            }
+        });
+
+        for (size_t g = 0; g < groups.size(); ++g) {
+            Accumulator total;
+            for (const auto& acc : partial) {
+                total.rows += acc[g].rows;
+                total.count += acc[g].count;
+                total.sum += acc[g].sum;
+                total.min = std::min(total.min, acc[g].min);
+                total.max = std::max(total.max, acc[g].max);
+            }
+            groups[g].rows = total.rows;
+            groups[g].count = total.count;
+            if (total.count == 0) continue;
+            groups[g].sum = total.sum;
+            groups[g].min = total.min;
+            groups[g].max = total.max;
+            groups[g].mean = total.sum / total.count;
+        }
+        return groups;
+    }
+
+    /**
+     * @brief 返回指定列数值最大(或最小)的 k 行
+     * 非数值单元格被忽略；数值相同时行号小的在前。
+     * @param col 数值列
+     * @param k 返回的行数
+     * @param largest true 取最大的 k 个, false 取最小的 k 个
+     * @return 行索引, 按数值从优到劣排列
+     */
+    std::vector<size_t> topK(size_t col, size_t k, bool largest = true) const {
+        std::vector<double> values = getNumericCol(col);
+        std::vector<size_t> rows;
+        rows.reserve(values.size());
+        for (size_t row = 0; row < values.size(); ++row)
+            if (!std::isnan(values[row])) rows.push_back(row);
+
+        auto better = [&](size_t a, size_t b) {
+            if (values[a] != values[b]) return largest ? values[a] > values[b] : values[a] < values[b];
+            return a < b;
+        };
+        k = std::min(k, rows.size());
+        std::partial_sort(rows.begin(), rows.begin() + k, rows.end(), better);
+        rows.resize(k);
+        return rows;
+    }
+
     /**
      * @brief 获取表格的字符串表示
      *
@@ -398,10 +819,10 @@ class DataTable {
     std::string getTableString() {
         // 1. 计算每一列的最大长度（列宽）
         std::vector<size_t> colWidths(getColSize(), 0);  // 存储每列的最大宽度
-        for (const auto& row : data) {
-            for (size_t col = 0; col < row.size(); ++col) {
+        for (size_t row = 0; row < getRowSize(); ++row) {
+            for (size_t col = 0; col < getColSize(); ++col) {
                 // 更新当前列的最大宽度
-                colWidths[col] = std::max(colWidths[col], row[col].size());
+                colWidths[col] = std::max(colWidths[col], data.get(row, col).size());
             }
         }
 
@@ -420,7 +841,8 @@ class DataTable {
         // 4. 表头和数据行的分隔符不同，因此需要区分处理
         bool isFirstRow = true;  // 标记是否是表头行
 
-        for (const auto& row : data) {
+        for (size_t r = 0; r < getRowSize(); ++r) {
+            const Row row = data.row(r);
             table_str << "|";  // 每行的开始
 
             // 5. 遍历每一列，按列宽格式化内容
@@ -496,7 +918,7 @@ class DataTable {
         DataTable subTable(rowEnd - rowBegin + 1, colEnd - colBegin + 1);
         for (size_t i = rowBegin; i <= rowEnd; ++i) {
             for (size_t j = colBegin; j <= colEnd; ++j) {
-                subTable.data[i - rowBegin][j - colBegin] = data[i][j];
+                subTable.data.set(i - rowBegin, j - colBegin, data.get(i, j));
             }
         }
 
@@ -517,27 +939,26 @@ class DataTable {
         size_t subColCount = subTable.getColSize();
 
         // 调整当前表格的大小以容纳子表格（如有必要）
-        if (startRow + subRowCount > rowCount) {
-            data.resize(startRow + subRowCount);
-        }
-        if (startCol + subColCount > colCount) {
-            for (auto& row : data) {
-                row.resize(startCol + subColCount);
-            }
+        if (startRow + subRowCount > rowCount || startCol + subColCount > colCount) {
+            data.resize(std::max(rowCount, startRow + subRowCount), std::max(colCount, startCol + subColCount));
         }
 
         // 将子表格数据覆盖到指定位置
         for (size_t i = 0; i < subRowCount; ++i) {
             for (size_t j = 0; j < subColCount; ++j) {
-                data[startRow + i][startCol + j] = subTable.data[i][j];
+                data.set(startRow + i, startCol + j, subTable.data.get(i, j));
             }
         }
+        invalidateIndexes();
+        markModified(startCol + subColCount > colCount ? 0 : startRow);
     }
 
     // 删除当前表格并释放内存
     void deleteTable() {
         data.clear();
-        data.shrink_to_fit();  // 释放内存
+        data.shrinkToFit();  // 释放内存
+        invalidateIndexes();
+        markModified();
     }
 
     /**
@@ -551,23 +972,20 @@ class DataTable {
      * @param mode 文件打开模式，支持"w"（覆写）和"a"（追加），默认为"w"
      */
     void saveTable(const std::string& filePath, const char* mode = "w") {
-        size_t rows = getRowSize();  ///< 获取表格的行数
-        size_t cols = getColSize();  ///< 获取表格的列数
-
         // 文件操作模式检查
-        if (mode != "w" && mode != "a") {
+        if (std::string(mode) != "w" && std::string(mode) != "a") {
             WARN(WarningLevel::ERROR, "文件打开模式非法，仅支持(w:覆写, a:追加): %s", mode);
             return;
         }
 
         // 根据模式选择文件操作方式
-        if (mode == "w") {
+        if (std::string(mode) == "w") {
             // 在覆写模式下，创建新文件
             if (!file.createFile(filePath)) {
                 WARN(WarningLevel::ERROR, "DataTable文件创建失败: %s", filePath.c_str());
                 return;
             }
-        } else if (mode == "a") {
+        } else {
             // 在追加模式下，检查文件是否存在
             if (!file.exists(filePath)) {
                 WARN(WarningLevel::ERROR, "DataTable文件不存在,无法追加数据: %s", filePath.c_str());
@@ -575,61 +993,102 @@ class DataTable {
             }
         }
 
-        // 使用ostringstream高效拼接数据
-        std::ostringstream tableBuffer;
-        for (size_t row = 0; row < rows; ++row) {
-            // 遍历每一列，拼接每一行的数据
-            for (size_t col = 0; col < cols; ++col) {
-                tableBuffer << getCell(row, col);        ///< 获取当前单元格的内容
-                if (col < cols - 1) tableBuffer << ",";  ///< 每个单元格之间用逗号分隔
-            }
-            tableBuffer << "\n";  ///< 每一行结束后添加换行符
-        }
-
         // 写入数据到文件
-        if (!file.writeFileAsString(filePath, tableBuffer.str(), mode)) {
+        if (!writeRows(filePath, 0, getRowSize(), mode)) {
             WARN(WarningLevel::ERROR, "DataTable文件写入失败: %s", filePath.c_str());
             return;
         }
+
+        // 覆写后文件与表格一致; 追加后文件中多了一份表格, 不再能增量保存
+        if (std::string(mode) == "w") {
+            markSynced(filePath);
+        } else if (filePath == synced_path) {
+            synced_path.clear();
+        }
+    }
+
+    /**
+     * @brief 增量保存DataTable到指定路径的CSV文件
+     *
+     * 表格记录上一次与文件同步(`saveTable` 覆写、`loadTable` 或 `syncTable`)之后的修改：
+     * - 若只在表格末尾追加了新行，则只把新行追加到文件末尾，写入量与新增的行数成正比；
+     * - 若已保存的行被修改、删除、移动，列结构发生变化，或目标不是上次同步的文件，则先把整表写入临时文件
+     *   `filePath + ".tmp"`，再以一次重命名替换原文件。掉电时原文件要么是旧内容，要么是完整的新内容。
+     *
+     * @param filePath 要保存的文件路径(不存在时创建)
+     * @return 保存成功返回 true
+     */
+    bool syncTable(const std::string& filePath) {
+        size_t rows = getRowSize();
+
+        // 只追加了新行: 把新行追加到文件末尾
+        if (!synced_stale && filePath == synced_path && file.exists(filePath)) {
+            if (synced_rows == rows) return true;  // 没有任何修改
+
+            std::string delta;
+            for (size_t row = synced_rows; row < rows; ++row) appendCSVRow(delta, row);
+            if (!file.writeFileAsString(filePath, delta, "a")) {
+                WARN(WarningLevel::ERROR, "DataTable增量保存失败: %s", filePath.c_str());
+                synced_path.clear();  // 文件内容未知, 下次整表重写
+                return false;
+            }
+            synced_rows = rows;
+            return true;
+        }
+
+        // 整表写入临时文件, 再原子替换原文件
+        std::string tempPath = filePath + ".tmp";
+        if (!file.exists(tempPath) && !file.createFile(tempPath)) return false;  // 同时创建缺失的父目录
+        if (!writeRows(tempPath, 0, rows, "w")) {
+            WARN(WarningLevel::ERROR, "DataTable临时文件写入失败: %s", tempPath.c_str());
+            if (file.exists(tempPath)) file.deletePath(tempPath);
+            return false;
+        }
+        if (!file.replaceFile(tempPath, filePath)) {
+            file.deletePath(tempPath);
+            return false;
+        }
+
+        markSynced(filePath);
+        return true;
     }
 
     /**
      * @brief 从指定 CSV 格式文件加载表格数据并覆写到当前表格中
      *
-     * 本函数会读取指定路径的文件内容，并按行和列将数据填充到当前表格中。初始表格将被清空并重新调整为适当的大小。
-     * 文件中每一行数据以换行符分隔，列数据以逗号分隔。最后会删除第一行（通常用于标题）。
+     * 本函数会分块读取指定路径的文件内容，并按行和列将数据填充到当前表格中。初始表格将被清空并重新调整为适当的大小。
+     * 文件中每一行数据以换行符(\n 或 \r\n)分隔，列数据以逗号分隔；以双引号包围的单元格可以包含逗号、换行符，其中的 "" 表示一个引号(RFC 4180)。
+     * 文件按块单遍流式解析，跨块的半行会暂存到下一块，峰值内存只与表格本身和一个读取缓冲区有关，不再额外持有整份文件文本。
      *
      * @param filePath 文件路径，指向包含表格数据的文本文件
      */
     void loadTable(const std::string& filePath) {
-        // 读取CSV文件内容到字符串
-        std::string table_buffer_str = file.readFileAsString(filePath);
-
-        // 获取CSV数据的最大行数和列数
-        size_t maxRows = 0, maxCols = 0;
-        getCSVDimensions(table_buffer_str, maxRows, maxCols);
+        data.clear();
+        invalidateIndexes();
 
-        // 清空现有数据并调整表格大小
-        clear();
-        resize(maxRows, maxCols);
+        // 单遍流式解析: 每解析出一行就直接驻留到单元格存储中, 不再保留整份中间表格
+        CSVParser parser([&](Row& row) {
+            if (row.size() > data.cols()) data.resize(data.rows(), row.size());  // 遇到更宽的行时补齐之前的行
+            data.insertRow(data.rows(), row);
+        });
 
-        // 用于逐行读取CSV数据
-        std::istringstream stream(table_buffer_str);
-        std::string line;
-        size_t row_index = 0;
+        char lastByte = '\n';  ///< 文件的最后一个字节
+        bool loaded = file.readFileChunks(filePath, [&](const uint8_t* chunk, size_t size) {
+            parser.feed(reinterpret_cast<const char*>(chunk), size);
+            if (size > 0) lastByte = static_cast<char>(chunk[size - 1]);
+            return true;
+        });
 
-        // 逐行解析CSV数据
-        while (std::getline(stream, line)) {
-            std::istringstream lineStream(line);  // 按逗号分隔每一行
-            std::string cell;
-            std::vector<std::string> row_data;
+        // 文件末尾没有换行符的最后一行
+        if (!parser.finish()) WARN(WarningLevel::WARNING, "CSV 文件格式不完整: %s", filePath.c_str());
 
-            // 按逗号分隔每一列，并将其加入到当前行中
-            while (std::getline(lineStream, cell, ',')) row_data.push_back(cell);
+        data.shrinkToFit();
 
-            // 将解析后的行数据添加到表格中
-            replaceRow(row_data, row_index);
-            ++row_index;
+        // 文件以换行结尾时, 之后 syncTable 可以直接把新行追加到文件末尾
+        if (loaded && lastByte == '\n') {
+            markSynced(filePath);
+        } else {
+            synced_path.clear();
         }
     }
 
@@ -646,13 +1105,195 @@ class DataTable {
             deepCopy(data, table);  // 当 table 为空时，将 data 深拷贝到 table
         } else {
             deepCopy(table, data);  // 当 table 非空时，将 table 深拷贝到 data
+            invalidateIndexes();
+            markModified();
         }
     }
 
+    /**
+     * @brief 获取单元格存储的内存占用统计
+     *
+     * 单元格以 4 字节的驻留字符串 ID 存储，相同的值(如重复的 SSID、状态标志、空字符串)只保存一份，
+     * 空字符串不占用字符串池。可据此估算表格在 SRAM/PSRAM 中的占用。
+     */
+    MemoryStats memoryStats() const {
+        MemoryStats stats;
+        const StringPool& pool = data.pool();
+        stats.cells = data.rows() * data.cols();
+        stats.uniqueStrings = pool.size();
+        stats.cellBytes = data.cellMemoryUsage();
+        stats.poolBytes = pool.memoryUsage();
+        stats.totalBytes = stats.cellBytes + stats.poolBytes;
+        if (stats.cells > 0) stats.bytesPerCell = static_cast<float>(stats.totalBytes) / stats.cells;
+        if (pool.acquires() > 0) stats.poolHitRate = static_cast<float>(pool.hits()) / pool.acquires();
+        return stats;
+    }
+
    private:
-    Table data;
+    // 一列的二级索引: 值 -> 行号
+    struct ColumnIndex {
+        IndexType type = IndexType::Hash;
+        bool dirty = true;                                    // 是否需要在下次查找前重建
+        std::unordered_multimap<StringPool::Id, size_t> hash;  // 哈希索引(以驻留字符串 ID 为键, 不复制字符串)
+        std::multimap<std::string, size_t> sorted;           // 有序索引
+    };
+
+    CellStore data;  // 单元格存储: 行优先的连续 ID 数组 + 驻留字符串池
     FileExplorer file;
     StringSplitter splitter;
+    size_t bulk_threads = 1;  // 批量操作的线程数(仅主机端)
+
+    // 每个线程至少处理的元素数, 低于该值时线程开销大于收益
+    static constexpr size_t kMinItemsPerThread = 16384;
+
+    // 处理 items 个元素实际使用的线程数
+    size_t workerCount(size_t items) const { return std::max<size_t>(1, std::min(bulk_threads, items / kMinItemsPerThread)); }
+
+    /**
+     * @brief 将 [0, items) 均分给若干线程执行 fn(begin, end, worker)
+     * 在 ESP32 上或数据量较小时直接在当前线程执行。
+     */
+    void parallelFor(size_t items, const std::function<void(size_t, size_t, size_t)>& fn) const {
+        const size_t workers = workerCount(items);
+        if (workers <= 1) {
+            fn(0, items, 0);
+            return;
+        }
+#if !defined(ARDUINO)
+        std::vector<std::thread> threads;
+        const size_t step = (items + workers - 1) / workers;
+        for (size_t w = 1; w < workers; ++w) threads.emplace_back(fn, std::min(items, w * step), std::min(items, (w + 1) * step), w);
+        fn(0, std::min(items, step), 0);
+        for (auto& thread : threads) thread.join();
+#endif
+    }
+
+    // 将字符串完整解析为数值, 失败时返回 NaN
+    static double parseNumber(const std::string& text) {
+        if (text.empty()) return std::nan("");
+        char* end = nullptr;
+        double value = std::strtod(text.c_str(), &end);
+        return (*end == '\0') ? value : std::nan("");
+    }
+    std::map<size_t, ColumnIndex> indexes;  // 列号 -> 该列的二级索引
+
+    // 与 CSV 文件的同步状态(供 syncTable 增量保存)
+    std::string synced_path;    // 上一次同步的文件, 为空表示没有与任何文件同步
+    size_t synced_rows = 0;     // 文件中已保存的行数, 之后的行是新追加的
+    bool synced_stale = false;  // 已保存的行是否被修改过(需要整表重写)
+
+    // 记录表格已与文件同步
+    void markSynced(const std::string& filePath) {
+        synced_path = filePath;
+        synced_rows = data.rows();
+        synced_stale = false;
+    }
+
+    // 记录从 row 开始的行被修改; 修改涉及已保存的行时, 下次 syncTable 需要整表重写
+    void markModified(size_t row = 0) {
+        if (row < synced_rows) synced_stale = true;
+    }
+
+    // 将一行按 CSV 格式追加到字符串
+    void appendCSVRow(std::string& out, size_t row) const {
+        for (size_t col = 0; col < data.cols(); ++col) {
+            if (col > 0) out += ',';  // 每个单元格之间用逗号分隔
+            CSVParser::appendField(out, data.get(row, col));
+        }
+        out += '\n';  // 每一行结束后添加换行符
+    }
+
+    // 将 [firstRow, lastRow) 行按 CSV 格式分块写入文件, 内存占用与表格大小无关
+    bool writeRows(const std::string& filePath, size_t firstRow, size_t lastRow, const char* mode) {
+        std::string pending;  // 已序列化但尚未写出的数据
+        size_t offset = 0;    // pending 中已写出的字节数
+        size_t row = firstRow;
+
+        return file.writeFileChunks(
+            filePath,
+            [&](uint8_t* buffer, size_t capacity) -> size_t {
+                pending.erase(0, offset);
+                offset = 0;
+                while (pending.size() < capacity && row < lastRow) appendCSVRow(pending, row++);
+
+                size_t size = std::min(capacity, pending.size());
+                std::memcpy(buffer, pending.data(), size);
+                offset = size;
+                return size;
+            },
+            mode);
+    }
+
+    // 获取指定列的可用索引(失效时先重建), 没有索引时返回 nullptr
+    ColumnIndex* liveIndex(size_t col) {
+        auto it = indexes.find(col);
+        if (it == indexes.end()) return nullptr;
+
+        ColumnIndex& index = it->second;
+        if (index.dirty) {
+            index.hash.clear();
+            index.sorted.clear();
+            if (index.type == IndexType::Hash) index.hash.reserve(data.rows());
+            for (size_t row = 0; row < data.rows(); ++row) indexAdd(index, row, col);
+            index.dirty = false;
+        }
+        return &index;
+    }
+
+    // 将单元格 (row, col) 的当前值加入索引
+    void indexAdd(ColumnIndex& index, size_t row, size_t col) {
+        if (index.type == IndexType::Hash) {
+            index.hash.emplace(data.id(row, col), row);
+        } else {
+            index.sorted.emplace(data.get(row, col), row);
+        }
+    }
+
+    template <typename Map, typename Key>
+    static void indexRemove(Map& map, const Key& key, size_t row) {
+        auto range = map.equal_range(key);
+        for (auto it = range.first; it != range.second; ++it) {
+            if (it->second == row) {
+                map.erase(it);
+                return;
+            }
+        }
+    }
+
+    // 将单元格 (row, col) 的当前值移出索引
+    void indexRemove(ColumnIndex& index, size_t row, size_t col) {
+        if (index.type == IndexType::Hash) {
+            indexRemove(index.hash, data.id(row, col), row);
+        } else {
+            indexRemove(index.sorted, data.get(row, col), row);
+        }
+    }
+
+    // 将一行的各索引列加入索引(失效的索引会整体重建, 此处跳过)
+    void indexInsertRow(size_t row) {
+        for (auto& entry : indexes)
+            if (!entry.second.dirty) indexAdd(entry.second, row, entry.first);
+    }
+
+    // 将一行的各索引列移出索引
+    void indexEraseRow(size_t row) {
+        for (auto& entry : indexes)
+            if (!entry.second.dirty) indexRemove(entry.second, row, entry.first);
+    }
+
+    // 标记指定列的索引失效(已失效时直接返回, 连续的中间插入/删除只付出一次清空的代价)
+    void invalidateIndex(size_t col) {
+        auto it = indexes.find(col);
+        if (it == indexes.end() || it->second.dirty) return;
+        it->second.dirty = true;
+        it->second.hash.clear();
+        it->second.sorted.clear();
+    }
+
+    // 标记所有索引失效
+    void invalidateIndexes() {
+        for (auto& entry : indexes) invalidateIndex(entry.first);
+    }
 
     /**
      * @brief 执行深拷贝操作
@@ -660,73 +1301,36 @@ class DataTable {
      * @param source 源表格
      * @param destination 目标表格
      * @details
-     * 将 source 表格的内容深拷贝到 destination 中。此函数是通用拷贝逻辑的抽象，
-     * 通过 `reserve` 和 `emplace_back` 优化了内存管理，并利用了移动语义提升性能。
+     * 在单元格存储与 `Table` 之间深拷贝全部内容。导出时逐行构造字符串；导入时按最长的一行确定列数，
+     * 字符串重新驻留到本表的字符串池中。
      */
-    void deepCopy(const Table& source, Table& destination) noexcept {
+    void deepCopy(const CellStore& source, Table& destination) noexcept {
         destination.clear();
-        destination.reserve(source.size());  // 提前分配目标表格所需内存
-
-        for (const auto& src_row : source) {
-            Row new_row;
-            new_row.reserve(src_row.size());  // 提前分配目标行所需内存
-
-            for (const auto& elem : src_row) {
-                new_row.emplace_back(elem);  // 深拷贝字符串
-            }
+        destination.reserve(source.rows());  // 提前分配目标表格所需内存
+        for (size_t row = 0; row < source.rows(); ++row) destination.emplace_back(source.row(row));
+    }
 
-            destination.emplace_back(std::move(new_row));  // 移动新行到目标表格
-        }
+    void deepCopy(const Table& source, CellStore& destination) noexcept {
+        size_t cols = 0;
+        for (const auto& row : source) cols = std::max(cols, row.size());
+        destination.assign(source, cols);
     }
 
     // 边界检查: 检查给定的行列索引是否在表格的有效范围内(有效则返回true)
     bool checkBounds(size_t row, size_t col) const {
-        if (row >= data.size() || col >= data[0].size()) return false;
+        if (row >= data.rows() || col >= data.cols()) return false;
         return true;
     }
 
     // 边界检查: 检查给定的行索引是否在表格的有效范围内(有效则返回true)
     bool checkRowBounds(size_t row) const {
-        if (row >= data.size()) return false;
+        if (row >= data.rows()) return false;
         return true;
     }
 
     // 边界检查: 检查给定的列索引是否在表格的有效范围内(有效则返回true)
     bool checkColBounds(size_t col) const {
-        if (col >= data[0].size()) return false;
+        if (col >= data.cols()) return false;
         return true;
     }
-
-    /**
-     * @brief 获取CSV数据的最大行数和最大列数。
-     * @param[in] csvData 要解析的CSV格式数据，按行分隔，用逗号分隔列。
-     * @param[out] maxRows 返回最大行数。
-     * @param[out] maxCols 返回最大列数。
-     */
-    void getCSVDimensions(const std::string& csvData, size_t& maxRows, size_t& maxCols) {
-        // 用于逐行读取CSV数据
-        std::istringstream stream(csvData);
-        std::string line;
-
-        // 初始化行数和列数
-        maxRows = 0;
-        maxCols = 0;
-
-        // 逐行读取CSV数据
-        while (std::getline(stream, line)) {
-            maxRows++;  ///< 每读取一行，行数加1
-
-            size_t colCount = 0;  ///< 当前行的列数
-
-            // 直接使用std::getline按逗号分隔列，避免不必要的内存分配
-            std::istringstream lineStream(line);  ///< 用于分隔每一行的字段
-            std::string cell;
-
-            // 按逗号分隔每一列，统计当前行的列数
-            while (std::getline(lineStream, cell, ',')) colCount++;
-
-            // 更新最大列数
-            maxCols = std::max(maxCols, colCount);
-        }
-    }
 };
@@ -23,7 +23,7 @@
  */
 
 /*
-这段代码定义了一个名为 forward_queue 的类，实现了一个双端队列，其中 T 是一个泛型类型参数，表示队列中保存的元素类型。
+这段代码定义了一个名为 forward_queue 的类，实现了一个有界的正向队列，其中 T 是一个泛型类型参数，表示队列中保存的元素类型。
 
 类的公共接口包括以下成员函数：
 
@@ -31,7 +31,9 @@
 push：将新元素压入队列的顶部，如果队列已满，从底部弹出一个元素；
 pop：从队列的底部弹出一个元素；
 size：返回当前队列中元素的数量；
-getItems：返回当前队列中的所有元素；
+capacity：返回队列的最大长度；
+getItems：返回当前队列中所有元素的只读视图(不复制元素)；
+operator[]：按下标访问元素(0 为顶部最新的元素)；
 front：返回队列头的元素的引用；
 const front：返回队列头的元素的常量引用；
 back：返回队列尾的元素的引用；
@@ -42,15 +44,19 @@ const begin：返回队列开头的常量迭代器；
 const end：返回队列结尾的常量迭代器；
 clear：清空队列中的所有元素；
 empty：检查队列是否为空。
-在类的内部，使用了一个 std::deque 类型的成员变量 m_queue 来保存队列中的元素。push 和 pop 函数分别使用 m_queue.push_front 和 m_queue.pop_back
-操作来实现从顶部压入元素和从底部弹出元素的功能。
 
-begin 和 end 函数分别使用 m_queue.begin 和 m_queue.end 操作来返回迭代器。需要注意的是，由于 forward_queue 类是一个模板类，因此需要在返回迭代器的函数前加上
-typename 关键字，来表示 std::deque<T>::iterator 和 std::deque<T>::const_iterator 是一个类型。
+在类的内部，元素保存在构造时按 maxSize 一次性分配的 std::vector 中，作为环形存储使用：m_head 指向顶部(最新)的元素，
+push 将 m_head 向前移动一格并写入新元素，队列已满时新元素恰好覆盖底部(最旧)的元素；pop 只减少元素计数并重置被弹出的槽位。
+之后的压入、弹出都不再分配内存，避免 std::deque 按块分配造成的堆碎片。
 */
 
 #pragma once
-#include <deque>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 /**
  * @brief 正向队列, 元素从顶部压入, 从底部弹出.
@@ -58,63 +64,147 @@ typename 关键字，来表示 std::deque<T>::iterator 和 std::deque<T>::const_
  */
 template <typename T>
 class forward_queue {
+    template <bool Const>
+    class Iterator;
+
    public:
-    // 构造函数，接受一个整数参数，表示队列的最大长度
-    forward_queue(uint64_t maxSize) : m_maxSize(maxSize) {}
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    // 队列元素的只读视图, 不复制元素; 队列被修改后失效
+    class view {
+       public:
+        explicit view(const forward_queue& queue) : m_queue(&queue) {}
+
+        const_iterator begin() const { return m_queue->begin(); }
+        const_iterator end() const { return m_queue->end(); }
+        uint64_t size() const { return m_queue->size(); }
+        bool empty() const { return m_queue->empty(); }
+        const T& operator[](uint64_t index) const { return (*m_queue)[index]; }
+
+       private:
+        const forward_queue* m_queue;
+    };
+
+    // 构造函数，接受一个整数参数，表示队列的最大长度(存储空间在此一次性分配)
+    forward_queue(uint64_t maxSize) : m_store(maxSize) {}
 
     // 将新元素压入队列的顶部
     void push(T item) {
-        // 如果队列已满，从底部弹出一个元素
-        if (m_queue.size() >= m_maxSize) m_queue.pop_back();
+        if (m_store.empty()) return;
 
-        // 将新元素压入队列的顶部
-        m_queue.push_front(item);
+        // 顶部向前移动一格; 如果队列已满，该位置正是底部最旧的元素，直接被覆盖
+        m_head = (m_head == 0 ? m_store.size() : m_head) - 1;
+        m_store[m_head] = std::move(item);
+        if (m_count < m_store.size()) ++m_count;
     }
 
     // 从队列的底部弹出一个元素
     void pop() {
-        if (!m_queue.empty()) m_queue.pop_back();
+        if (m_count == 0) return;
+        --m_count;
+        m_store[slot(m_count)] = T();  // 释放元素持有的资源
     }
 
     // 返回当前队列中元素的数量
-    uint64_t size() const { return m_queue.size(); }
+    uint64_t size() const { return m_count; }
 
-    // 返回当前队列中的所有元素
-    std::deque<T> getItems() const { return m_queue; }
+    // 返回队列的最大长度
+    uint64_t capacity() const { return m_store.size(); }
+
+    // 返回当前队列中所有元素的只读视图(从顶部到底部, 不复制元素)
+    view getItems() const { return view(*this); }
+
+    // 按下标访问元素, 0 为顶部(最新)的元素
+    T& operator[](uint64_t index) { return m_store[slot(index)]; }
+    const T& operator[](uint64_t index) const { return m_store[slot(index)]; }
 
     // 返回队列头的元素的引用
-    T& front() { return m_queue.front(); }
+    T& front() { return m_store[m_head]; }
 
     // 返回队列头的元素的常量引用
-    const T& front() const { return m_queue.front(); }
+    const T& front() const { return m_store[m_head]; }
 
     // 返回队列尾的元素的引用
-    T& back() { return m_queue.back(); }
+    T& back() { return m_store[slot(m_count - 1)]; }
 
     // 返回队列尾的元素的常量引用
-    const T& back() const { return m_queue.back(); }
+    const T& back() const { return m_store[slot(m_count - 1)]; }
 
     // 返回队列开头的迭代器
-    typename std::deque<T>::iterator begin() { return m_queue.begin(); }
+    iterator begin() { return iterator(this, 0); }
 
     // 返回队列结尾的迭代器
-    typename std::deque<T>::iterator end() { return m_queue.end(); }
+    iterator end() { return iterator(this, m_count); }
 
     // 返回队列开头的常量迭代器
-    typename std::deque<T>::const_iterator begin() const { return m_queue.begin(); }
+    const_iterator begin() const { return const_iterator(this, 0); }
 
     // 返回队列结尾的常量迭代器
-    typename std::deque<T>::const_iterator end() const { return m_queue.end(); }
+    const_iterator end() const { return const_iterator(this, m_count); }
 
-    // 清空队列中的所有元素
-    void clear() { m_queue.clear(); }
+    // 清空队列中的所有元素(保留存储空间)
+    void clear() {
+        while (m_count != 0) pop();
+        m_head = 0;
+    }
 
     // 检查队列是否为空
-    bool empty() const { return m_queue.empty(); }
+    bool empty() const { return m_count == 0; }
 
    private:
-    uint64_t m_maxSize;     // 队列的最大长度
-    std::deque<T> m_queue;  // 双端队列，用于保存元素
+    // 第 index 个元素(0 为顶部)在环形存储中的位置
+    size_t slot(uint64_t index) const {
+        size_t pos = m_head + static_cast<size_t>(index);
+        return pos >= m_store.size() ? pos - m_store.size() : pos;
+    }
+
+    // 随机访问迭代器, 保存逻辑下标(0 为顶部)
+    template <bool Const>
+    class Iterator {
+        using Queue = typename std::conditional<Const, const forward_queue, forward_queue>::type;
+
+       public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = typename std::conditional<Const, const T*, T*>::type;
+        using reference = typename std::conditional<Const, const T&, T&>::type;
+
+        Iterator() = default;
+        Iterator(Queue* queue, uint64_t index) : m_queue(queue), m_index(index) {}
+        operator Iterator<true>() const { return Iterator<true>(m_queue, m_index); }  // iterator → const_iterator
+
+        reference operator*() const { return (*m_queue)[m_index]; }
+        pointer operator->() const { return &**this; }
+        reference operator[](difference_type n) const { return *(*this + n); }
+
+        Iterator& operator++() { return ++m_index, *this; }
+        Iterator& operator--() { return --m_index, *this; }
+        Iterator operator++(int) { return Iterator(m_queue, m_index++); }
+        Iterator operator--(int) { return Iterator(m_queue, m_index--); }
+        Iterator& operator+=(difference_type n) { return m_index += n, *this; }
+        Iterator& operator-=(difference_type n) { return m_index -= n, *this; }
+        Iterator operator+(difference_type n) const { return Iterator(m_queue, m_index + n); }
+        Iterator operator-(difference_type n) const { return Iterator(m_queue, m_index - n); }
+        friend Iterator operator+(difference_type n, const Iterator& it) { return it + n; }
+        difference_type operator-(const Iterator& other) const { return static_cast<difference_type>(m_index) - static_cast<difference_type>(other.m_index); }
+
+        bool operator==(const Iterator& other) const { return m_index == other.m_index; }
+        bool operator!=(const Iterator& other) const { return m_index != other.m_index; }
+        bool operator<(const Iterator& other) const { return m_index < other.m_index; }
+        bool operator>(const Iterator& other) const { return m_index > other.m_index; }
+        bool operator<=(const Iterator& other) const { return m_index <= other.m_index; }
+        bool operator>=(const Iterator& other) const { return m_index >= other.m_index; }
+
+       private:
+        Queue* m_queue = nullptr;
+        uint64_t m_index = 0;
+    };
+
+    std::vector<T> m_store;  // 环形存储, 长度即队列的最大长度
+    size_t m_head = 0;       // 顶部(最新)元素的位置
+    size_t m_count = 0;      // 当前元素数量
 };
 
 /*
@@ -0,0 +1,119 @@
+/**
+ * @file object_pool.hpp
+ * @date 17.10.2026
+ * @author RMSHE
+ *
+ * < GasSensorOS >
+ * Copyright(C) 2026 RMSHE. All rights reserved.
+ *
+ * This program is free software : you can redistribute it and /or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.If not, see < https://www.gnu.org/licenses/>.
+ *
+ * Electronic Mail : asdfghjkl851@outlook.com
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+/**
+ * @class ObjectPool
+ * @brief 固定大小对象的块式内存池
+ *
+ * @tparam T         池中对象的类型
+ * @tparam BlockSize 每次向堆申请的对象槽数量
+ *
+ * @details
+ * - 以块为单位向堆申请内存, 每块容纳 BlockSize 个对象, 减少小块分配造成的堆碎片
+ * - 释放的槽位进入空闲链表, 之后的 create() 优先复用, 不再访问堆
+ * - 内存池析构或 reset() 时一次性释放所有块, 不逐个归还槽位
+ *
+ * @note 内存池不追踪存活对象; 析构前必须通过 destroy() 销毁池中的所有对象, 否则它们的析构函数不会被调用.
+ * @note 非线程安全.
+ */
+template <typename T, size_t BlockSize = 32>
+class ObjectPool {
+    static_assert(BlockSize > 0, "BlockSize must be greater than 0");
+
+   public:
+    ObjectPool() = default;
+    ObjectPool(const ObjectPool&) = delete;
+    ObjectPool& operator=(const ObjectPool&) = delete;
+
+    /**
+     * @brief 在池中构造一个对象
+     * @param args 传递给 T 构造函数的参数
+     * @return 指向新对象的指针
+     */
+    template <typename... Args>
+    T* create(Args&&... args) {
+        if (free_list == nullptr) grow();
+
+        Slot* slot = free_list;
+        free_list = slot->next;
+        ++live_count;
+        return new (slot->storage) T(std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief 析构对象并将其槽位归还空闲链表
+     * @param object 由 create() 返回的指针
+     */
+    void destroy(T* object) {
+        object->~T();
+        Slot* slot = reinterpret_cast<Slot*>(object);
+        slot->next = free_list;
+        free_list = slot;
+        --live_count;
+    }
+
+    /**
+     * @brief 一次性回收全部槽位并释放所有块, 代价与块数成正比
+     * @note 不调用任何对象的析构函数: 调用前池中的对象必须已经析构(或可以平凡析构), 之后池中的所有指针都将失效.
+     */
+    void reset() {
+        blocks.clear();
+        free_list = nullptr;
+        live_count = 0;
+    }
+
+    size_t size() const { return live_count; }                         // 存活对象数
+    size_t capacity() const { return blocks.size() * BlockSize; }      // 已申请的槽位总数
+    size_t blockCount() const { return blocks.size(); }                // 已申请的块数
+    size_t memoryUsage() const { return blocks.size() * sizeof(Slot) * BlockSize; }  // 池占用的堆内存(字节)
+
+   private:
+    // 槽位: 空闲时保存空闲链表的下一项, 使用时保存对象本身
+    union Slot {
+        Slot* next;
+        alignas(T) unsigned char storage[sizeof(T)];
+    };
+
+    // 申请一个新块并将其所有槽位加入空闲链表
+    void grow() {
+        blocks.emplace_back(new Slot[BlockSize]);
+        Slot* block = blocks.back().get();
+        for (size_t i = BlockSize; i > 0; --i) {
+            block[i - 1].next = free_list;
+            free_list = &block[i - 1];
+        }
+    }
+
+    std::vector<std::unique_ptr<Slot[]>> blocks;  // 已申请的内存块
+    Slot* free_list = nullptr;                    // 空闲槽位链表
+    size_t live_count = 0;                        // 存活对象数
+};
@@ -26,8 +26,35 @@
 #ifndef RING_BUFFER_H
 #define RING_BUFFER_H
 
+#include <algorithm>
+#include <atomic>
 #include <cstddef>
+#include <iterator>
 #include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @brief 指向一段连续元素的非拥有视图(指针 + 长度)
+ * @tparam T 元素类型(可以是 const 类型)
+ */
+template <typename T>
+struct RingSpan {
+    T* data = nullptr;     ///< 首元素地址
+    std::size_t size = 0;  ///< 元素个数
+
+    RingSpan() = default;
+    RingSpan(T* ptr, std::size_t count) noexcept : data(ptr), size(count) {}
+
+    /// 可写视图可以隐式转换为只读视图, 例如把 RingBuffer::segments() 的结果直接传给接受 RingSpan<const T> 的函数
+    template <typename U, typename = std::enable_if_t<!std::is_const<U>::value && std::is_same<const U, T>::value>>
+    RingSpan(const RingSpan<U>& other) noexcept : data(other.data), size(other.size) {}
+
+    T* begin() const noexcept { return data; }
+    T* end() const noexcept { return data + size; }
+    bool empty() const noexcept { return size == 0; }
+    T& operator[](std::size_t index) const noexcept { return data[index]; }
+};
 
 /**
  * @class RingBuffer
@@ -40,13 +67,32 @@
  * - 固定容量，编译期分配，无堆内存
  * - 自动覆盖最旧数据，保障持续写入
  * - 提供随机访问、首/尾访问及插入、弹出接口
+ * - 可按至多两段连续内存访问或批量复制元素，便于直接送入 DSP 算法
  * - 适合 ESP32 等内存受限环境
  */
 template <typename T, std::size_t Capacity>
 class RingBuffer {
     static_assert(Capacity > 0, "RingBuffer 容量必须大于0");
 
+    template <bool Const>
+    class Iterator;
+
    public:
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    /**
+     * @brief 缓冲区内容按时间顺序分成的至多两段连续内存
+     * first 从最旧元素开始，second 是绕回缓冲区开头的部分(未绕回时为空)。
+     */
+    template <typename U>
+    struct Segments {
+        RingSpan<U> first;
+        RingSpan<U> second;
+
+        std::size_t size() const noexcept { return first.size + second.size; }
+    };
+
     /**
      * @brief 构造函数，初始化缓冲区
      */
@@ -59,11 +105,11 @@ class RingBuffer {
      */
     inline void pushBack(const T& value) noexcept {
         buffer_[tail_] = value;
-        tail_ = (tail_ + 1) % Capacity;
+        tail_ = wrap(tail_ + 1);
         if (count_ < Capacity) {
             ++count_;
         } else {
-            head_ = (head_ + 1) % Capacity;
+            head_ = wrap(head_ + 1);
         }
     }
 
@@ -73,7 +119,7 @@ class RingBuffer {
      */
     inline bool popBack() noexcept {
         if (empty()) return false;
-        tail_ = (tail_ + Capacity - 1) % Capacity;
+        tail_ = wrap(tail_ + Capacity - 1);
         --count_;
         return true;
     }
@@ -84,7 +130,7 @@ class RingBuffer {
      */
     inline bool popFront() noexcept {
         if (empty()) return false;
-        head_ = (head_ + 1) % Capacity;
+        head_ = wrap(head_ + 1);
         --count_;
         return true;
     }
@@ -106,7 +152,7 @@ class RingBuffer {
      */
     inline T& back() {
         if (empty()) throw std::out_of_range("RingBuffer::back: 缓冲区为空");
-        return buffer_[(tail_ + Capacity - 1) % Capacity];
+        return buffer_[wrap(tail_ + Capacity - 1)];
     }
 
     /**
@@ -117,9 +163,77 @@ class RingBuffer {
      */
     inline T& at(std::size_t index) {
         if (index >= count_) throw std::out_of_range("RingBuffer::at: 索引越界");
-        return buffer_[(head_ + index) % Capacity];
+        return buffer_[wrap(head_ + index)];
+    }
+
+    /**
+     * @brief 以至多两段连续内存访问全部元素(最旧 → 最新)
+     * @note 视图在下一次修改缓冲区后失效。
+     */
+    Segments<T> segments() noexcept { return segmentsFrom<T>(buffer_, 0, count_); }
+    Segments<const T> segments() const noexcept { return segmentsFrom<const T>(buffer_, 0, count_); }
+
+    /**
+     * @brief 以至多两段连续内存访问最新的 n 个元素(按时间顺序)
+     * @param n 元素个数, 超过 size() 时取全部元素
+     */
+    Segments<T> latestSegments(std::size_t n) noexcept {
+        n = std::min(n, count_);
+        return segmentsFrom<T>(buffer_, count_ - n, n);
+    }
+    Segments<const T> latestSegments(std::size_t n) const noexcept {
+        n = std::min(n, count_);
+        return segmentsFrom<const T>(buffer_, count_ - n, n);
+    }
+
+    /**
+     * @brief 按时间顺序复制最旧的 n 个元素
+     * @param dest 目标数组, 至少能容纳 n 个元素
+     * @param n 元素个数, 超过 size() 时复制全部元素
+     * @return 实际复制的元素个数
+     */
+    std::size_t copyTo(T* dest, std::size_t n) const { return copySegments(segmentsFrom<const T>(buffer_, 0, std::min(n, count_)), dest); }
+
+    /**
+     * @brief 按时间顺序复制最新的 n 个元素(滑动窗口)
+     * @param dest 目标数组, 至少能容纳 n 个元素
+     * @param n 窗口长度, 超过 size() 时复制全部元素
+     * @return 实际复制的元素个数
+     */
+    std::size_t copyLatest(T* dest, std::size_t n) const { return copySegments(latestSegments(n), dest); }
+
+    /**
+     * @brief 原地旋转存储, 使全部元素在内存中连续(最旧元素位于开头)
+     * 之后可以直接把返回的视图交给需要连续数组的算法；已经连续时不移动任何元素。
+     * @return 全部元素的连续视图, 在下一次修改缓冲区后失效
+     */
+    RingSpan<T> linearize() {
+        if (head_ + count_ > Capacity) {
+            std::rotate(buffer_, buffer_ + head_, buffer_ + Capacity);
+            head_ = 0;
+            tail_ = wrap(count_);
+        }
+        return RingSpan<T>{buffer_ + head_, count_};
     }
 
+    /**
+     * @brief 最新 n 个元素的连续视图(必要时先调用 linearize())
+     * @param n 窗口长度, 超过 size() 时取全部元素
+     */
+    RingSpan<T> latestWindow(std::size_t n) {
+        RingSpan<T> all = linearize();
+        n = std::min(n, all.size);
+        return RingSpan<T>{all.data + (all.size - n), n};
+    }
+
+    // 按时间顺序(最旧 → 最新)遍历的随机访问迭代器
+    iterator begin() noexcept { return iterator(buffer_, head_, 0); }
+    iterator end() noexcept { return iterator(buffer_, head_, count_); }
+    const_iterator begin() const noexcept { return const_iterator(buffer_, head_, 0); }
+    const_iterator end() const noexcept { return const_iterator(buffer_, head_, count_); }
+    const_iterator cbegin() const noexcept { return begin(); }
+    const_iterator cend() const noexcept { return end(); }
+
     /**
      * @brief 清空缓冲区
      */
@@ -150,10 +264,209 @@ class RingBuffer {
     inline bool full() const noexcept { return count_ == Capacity; }
 
    private:
+    // 将 [0, 2 * Capacity) 内的位置折回 [0, Capacity), 代替取模运算
+    static constexpr std::size_t wrap(std::size_t pos) noexcept { return pos >= Capacity ? pos - Capacity : pos; }
+
+    // 从第 offset 个元素(0 为最旧)开始的 n 个元素所在的两段内存
+    template <typename U, typename Storage>
+    Segments<U> segmentsFrom(Storage* storage, std::size_t offset, std::size_t n) const noexcept {
+        const std::size_t start = wrap(head_ + offset);
+        const std::size_t first = std::min(n, Capacity - start);
+        return Segments<U>{RingSpan<U>{storage + start, first}, RingSpan<U>{storage, n - first}};
+    }
+
+    static std::size_t copySegments(const Segments<const T>& segments, T* dest) {
+        dest = std::copy(segments.first.begin(), segments.first.end(), dest);
+        std::copy(segments.second.begin(), segments.second.end(), dest);
+        return segments.size();
+    }
+
+    // 随机访问迭代器, 保存逻辑下标(0 为最旧元素)
+    template <bool Const>
+    class Iterator {
+        using Storage = typename std::conditional<Const, const T, T>::type;
+
+       public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = Storage*;
+        using reference = Storage&;
+
+        Iterator() noexcept = default;
+        Iterator(Storage* buffer, std::size_t head, std::size_t index) noexcept : buffer_(buffer), head_(head), index_(index) {}
+        operator Iterator<true>() const noexcept { return Iterator<true>(buffer_, head_, index_); }  // iterator → const_iterator
+
+        reference operator*() const noexcept { return buffer_[wrap(head_ + index_)]; }
+        pointer operator->() const noexcept { return &**this; }
+        reference operator[](difference_type n) const noexcept { return *(*this + n); }
+
+        Iterator& operator++() noexcept { return ++index_, *this; }
+        Iterator& operator--() noexcept { return --index_, *this; }
+        Iterator operator++(int) noexcept { return Iterator(buffer_, head_, index_++); }
+        Iterator operator--(int) noexcept { return Iterator(buffer_, head_, index_--); }
+        Iterator& operator+=(difference_type n) noexcept { return index_ += n, *this; }
+        Iterator& operator-=(difference_type n) noexcept { return index_ -= n, *this; }
+        Iterator operator+(difference_type n) const noexcept { return Iterator(buffer_, head_, index_ + n); }
+        Iterator operator-(difference_type n) const noexcept { return Iterator(buffer_, head_, index_ - n); }
+        friend Iterator operator+(difference_type n, const Iterator& it) noexcept { return it + n; }
+        difference_type operator-(const Iterator& other) const noexcept { return static_cast<difference_type>(index_) - static_cast<difference_type>(other.index_); }
+
+        bool operator==(const Iterator& other) const noexcept { return index_ == other.index_; }
+        bool operator!=(const Iterator& other) const noexcept { return index_ != other.index_; }
+        bool operator<(const Iterator& other) const noexcept { return index_ < other.index_; }
+        bool operator>(const Iterator& other) const noexcept { return index_ > other.index_; }
+        bool operator<=(const Iterator& other) const noexcept { return index_ <= other.index_; }
+        bool operator>=(const Iterator& other) const noexcept { return index_ >= other.index_; }
+
+       private:
+        Storage* buffer_ = nullptr;
+        std::size_t head_ = 0;
+        std::size_t index_ = 0;
+    };
+
     T buffer_[Capacity];  ///< 数据存储
     std::size_t head_;    ///< 最旧元素索引
     std::size_t tail_;    ///< 下一个写入位置
     std::size_t count_;   ///< 当前元素数量
 };
 
+/**
+ * @class SPSCRingBuffer
+ * @brief 单生产者/单消费者无锁环形缓冲区
+ *
+ * @tparam T        存储元素类型
+ * @tparam Capacity 缓冲区容量，必须是 2 的幂
+ *
+ * @details
+ * - 一个线程(或 ISR)只调用 `tryPush`/`pushN`，另一个线程只调用 `tryPop`/`popN`，两者之间无需加锁
+ * - 读写索引是单调递增的原子计数器，下标由 `& (Capacity - 1)` 得到，不做取模运算
+ * - 生产者与消费者的状态分别位于不同的缓存行，并各自缓存对方索引，只在看似满/空时才重新读取
+ * - 满时 `tryPush` 失败而不是覆盖旧数据(覆盖最旧元素需要修改消费者的索引)
+ *
+ * @note 需要 `std::atomic<std::size_t>` 无锁(ESP32 与常见主机平台均满足)。
+ */
+template <typename T, std::size_t Capacity>
+class SPSCRingBuffer {
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "SPSCRingBuffer 容量必须是 2 的幂");
+
+    static constexpr std::size_t kMask = Capacity - 1;
+    static constexpr std::size_t kCacheLine = 64;  ///< 按主机常见的缓存行大小隔离, 在 ESP32 上只多占少量内存
+
+   public:
+    SPSCRingBuffer() noexcept = default;
+    SPSCRingBuffer(const SPSCRingBuffer&) = delete;
+    SPSCRingBuffer& operator=(const SPSCRingBuffer&) = delete;
+
+    /**
+     * @brief 推入一个元素(仅生产者调用)
+     * @param value 要插入的元素
+     * @return 成功返回 true; 缓冲区已满返回 false
+     */
+    inline bool tryPush(const T& value) {
+        const std::size_t tail = tail_.load(std::memory_order_relaxed);
+        if (space(tail, 1) == 0) return false;
+        buffer_[tail & kMask] = value;
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    inline bool tryPush(T&& value) {
+        const std::size_t tail = tail_.load(std::memory_order_relaxed);
+        if (space(tail, 1) == 0) return false;
+        buffer_[tail & kMask] = std::move(value);
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief 弹出最旧的元素(仅消费者调用)
+     * @param value 接收弹出的元素
+     * @return 成功返回 true; 缓冲区为空返回 false
+     */
+    inline bool tryPop(T& value) {
+        const std::size_t head = head_.load(std::memory_order_relaxed);
+        if (available(head, 1) == 0) return false;
+        value = std::move(buffer_[head & kMask]);
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief 批量推入元素(仅生产者调用)
+     * 按空闲空间尽量多地写入，最多分两段连续复制(到缓冲区末尾、从缓冲区开头)。
+     * @param values 元素数组
+     * @param count 元素个数
+     * @return 实际写入的元素个数
+     */
+    std::size_t pushN(const T* values, std::size_t count) {
+        const std::size_t tail = tail_.load(std::memory_order_relaxed);
+        count = std::min(count, space(tail, count));
+        if (count == 0) return 0;
+
+        const std::size_t pos = tail & kMask;
+        const std::size_t first = std::min(count, Capacity - pos);
+        std::copy(values, values + first, buffer_ + pos);
+        std::copy(values + first, values + count, buffer_);
+        tail_.store(tail + count, std::memory_order_release);
+        return count;
+    }
+
+    /**
+     * @brief 批量弹出最旧的元素(仅消费者调用)
+     * @param values 接收元素的数组, 至少能容纳 count 个元素
+     * @param count 最多弹出的元素个数
+     * @return 实际弹出的元素个数
+     */
+    std::size_t popN(T* values, std::size_t count) {
+        const std::size_t head = head_.load(std::memory_order_relaxed);
+        count = std::min(count, available(head, count));
+        if (count == 0) return 0;
+
+        const std::size_t pos = head & kMask;
+        const std::size_t first = std::min(count, Capacity - pos);
+        std::move(buffer_ + pos, buffer_ + pos + first, values);
+        std::move(buffer_, buffer_ + (count - first), values + first);
+        head_.store(head + count, std::memory_order_release);
+        return count;
+    }
+
+    /**
+     * @brief 获取当前储存的元素数量
+     * @note 另一端并发操作时只是一个瞬时值。
+     */
+    inline std::size_t size() const noexcept { return tail_.load(std::memory_order_acquire) - head_.load(std::memory_order_acquire); }
+
+    inline constexpr std::size_t capacity() const noexcept { return Capacity; }
+    inline bool empty() const noexcept { return size() == 0; }
+    inline bool full() const noexcept { return size() == Capacity; }
+
+   private:
+    // 生产者: 空闲空间; 按缓存的读索引算出的空间不足 wanted 时才重新读取
+    inline std::size_t space(std::size_t tail, std::size_t wanted) {
+        std::size_t free = Capacity - (tail - head_cache_);
+        if (free < wanted) {
+            head_cache_ = head_.load(std::memory_order_acquire);
+            free = Capacity - (tail - head_cache_);
+        }
+        return free;
+    }
+
+    // 消费者: 可读元素数; 按缓存的写索引算出的数量不足 wanted 时才重新读取
+    inline std::size_t available(std::size_t head, std::size_t wanted) {
+        std::size_t count = tail_cache_ - head;
+        if (count < wanted) {
+            tail_cache_ = tail_.load(std::memory_order_acquire);
+            count = tail_cache_ - head;
+        }
+        return count;
+    }
+
+    alignas(kCacheLine) std::atomic<std::size_t> head_{0};  ///< 消费者: 下一个读取位置
+    std::size_t tail_cache_ = 0;                            ///< 消费者: 最近一次读到的写索引
+    alignas(kCacheLine) std::atomic<std::size_t> tail_{0};  ///< 生产者: 下一个写入位置
+    std::size_t head_cache_ = 0;                            ///< 生产者: 最近一次读到的读索引
+    alignas(kCacheLine) T buffer_[Capacity];                ///< 数据存储
+};
+
 #endif  // RINGBUFFER_H
@@ -39,50 +39,171 @@ Tree类包含了树的遍历、节点查找、节点删除等方法。其中，
 #pragma once
 
 #include <algorithm>
+#include <cstddef>
+#include <iterator>
 #include <make_ptr.hpp>
 #include <memory>
+#include <object_pool.hpp>
 #include <queue>
+#include <type_traits>
 #include <unordered_map>
 #include <vector>
 
+/**
+ * @brief 树的索引策略
+ * @tparam ChildIndex 是否为每个节点建立"子节点值 -> 子节点"的哈希索引, 使 addChild/findChild/deleteChild 以常数时间完成.
+ * @tparam GlobalIndex 是否在 Tree 中建立"节点值 -> 节点"的全局哈希多重映射, 使 findNode/findDescendants 不再遍历整棵树.
+ * @tparam SubtreeStats 是否在每个节点上缓存子树的节点数、高度与叶子数, 使 getSize/getDepth/getBreadth 以常数时间返回.
+ * 缓存在 addChild/deleteChild/deleteNode 时沿祖先路径增量更新, 代价为 O(深度).
+ * @tparam PooledNodes 是否从 Tree 持有的块式内存池(ObjectPool)分配节点. 节点不再逐个向堆申请, 删除的节点归还内存池复用,
+ * deleteTree/树析构时只析构节点而不逐个归还槽位, 最后按块一次性回收内存池.
+ * @note 启用索引要求 T 可以被 std::hash<T> 散列. 索引只由 addChild/addNode/deleteChild/deleteNode/deleteTree 维护,
+ * 直接修改 children 或 node_data 会使索引失效. 启用索引后 findNode/findDescendants 返回结果的顺序不再固定.
+ */
+template <bool ChildIndex, bool GlobalIndex, bool SubtreeStats = false, bool PooledNodes = false>
+struct TreeIndexPolicy {
+    static constexpr bool child_index = ChildIndex;
+    static constexpr bool global_index = GlobalIndex;
+    static constexpr bool subtree_stats = SubtreeStats;
+    static constexpr bool pooled_nodes = PooledNodes;
+};
+
+using TreeLinearPolicy = TreeIndexPolicy<false, false>;             // 默认策略: 线性查找, 不占用额外内存(与原行为一致)
+using TreeHashPolicy = TreeIndexPolicy<true, false>;                // 子节点哈希索引
+using TreeFullHashPolicy = TreeIndexPolicy<true, true>;             // 子节点哈希索引 + 全局节点值索引
+using TreeStatsPolicy = TreeIndexPolicy<false, false, true>;        // 仅缓存子树统计
+using TreePoolPolicy = TreeIndexPolicy<false, false, false, true>;  // 仅从内存池分配节点
+
+// 树的统计信息, 由 Tree::getStats 一次遍历得到
+struct TreeStats {
+    uint32_t size = 0;     // 节点数
+    uint32_t depth = 0;    // 深度(层数)
+    uint32_t breadth = 0;  // 叶子数
+    uint32_t width = 0;    // 宽度(节点最多的一层的节点数)
+    uint32_t degree = 0;   // 度(子节点最多的节点的子节点数)
+};
+
+// 节点上缓存的子树统计, 未启用时不占用任何字段
+template <bool Enabled>
+struct TreeSubtreeStats {};
+
+template <>
+struct TreeSubtreeStats<true> {
+    uint32_t size = 1;    // 以该节点为根的子树的节点数
+    uint32_t height = 1;  // 以该节点为根的子树的高度
+    uint32_t leaves = 1;  // 以该节点为根的子树的叶子数
+};
+
+template <typename T, typename Policy = TreeLinearPolicy>
+class TreeNode;
+
+template <typename T, typename Policy = TreeLinearPolicy>
+class Tree;
+
+template <typename T, typename Policy>
+class TreePreOrderIterator;
+
+// 树节点内存池
+template <typename T, typename Policy>
+using TreeNodePool = ObjectPool<TreeNode<T, Policy>>;
+
+// 池化节点的删除器: 节点来自内存池时归还内存池, 否则直接 delete
+template <typename T, typename Policy>
+struct TreeNodeDeleter {
+    void operator()(TreeNode<T, Policy>* node_ptr) const;
+};
+
+// 指向树节点的独占指针, 未启用内存池时即为 std::unique_ptr<TreeNode<T, Policy>>
+template <typename T, typename Policy>
+using TreeNodePtr = std::unique_ptr<TreeNode<T, Policy>, std::conditional_t<Policy::pooled_nodes, TreeNodeDeleter<T, Policy>, std::default_delete<TreeNode<T, Policy>>>>;
+
+// 节点所在的内存池, 未启用内存池时不占用任何字段
+template <typename T, typename Policy, bool PooledNodes = Policy::pooled_nodes>
+struct TreeNodeAllocation {};
+
+template <typename T, typename Policy>
+struct TreeNodeAllocation<T, Policy, true> {
+    TreeNodePool<T, Policy>* pool = nullptr;  // 节点所在的内存池(为空时节点由堆分配)
+};
+
+// 全局节点值索引: 节点值 -> 具有该值的所有节点
+template <typename T, typename Policy>
+using TreeNodeRegistry = std::unordered_multimap<T, TreeNode<T, Policy>*>;
+
+// 节点上的索引存储, 未启用的索引不占用任何字段
+template <typename T, typename Policy, bool ChildIndex = Policy::child_index, bool GlobalIndex = Policy::global_index>
+struct TreeNodeIndex {};
+
+template <typename T, typename Policy>
+struct TreeNodeIndex<T, Policy, true, false> {
+    std::unordered_map<T, TreeNode<T, Policy>*> children;  // 子节点值 -> 第一个具有该值的子节点
+};
+
+template <typename T, typename Policy>
+struct TreeNodeIndex<T, Policy, false, true> {
+    TreeNodeRegistry<T, Policy>* registry = nullptr;  // 所属树的全局索引(不属于任何树时为空)
+};
+
+template <typename T, typename Policy>
+struct TreeNodeIndex<T, Policy, true, true> {
+    std::unordered_map<T, TreeNode<T, Policy>*> children;  // 子节点值 -> 第一个具有该值的子节点
+    TreeNodeRegistry<T, Policy>* registry = nullptr;       // 所属树的全局索引(不属于任何树时为空)
+};
+
 // @note 一个 TreeNode 对象代表了一棵树中的一个节点，其中包含了当前节点的数据和指向它的父节点的指针以及指向其子节点的所有指针。
-template <typename T>
+// @note 模板参数 Policy 为索引策略(见 TreeIndexPolicy), 默认不建立索引.
+template <typename T, typename Policy>
 class TreeNode {
+    friend class Tree<T, Policy>;
+
    public:
-    T node_data;                                         // 储存这个节点的值
-    std::vector<std::unique_ptr<TreeNode<T>>> children;  // 储存指向这个节点的子节点的指针
-    TreeNode<T>* parent;                                 // 储存指向这个节点的父节点的指针
+    T node_data;                                                 // 储存这个节点的值
+    std::vector<TreeNodePtr<T, Policy>> children;     // 储存指向这个节点的子节点的指针
+    TreeNode<T, Policy>* parent;                      // 储存指向这个节点的父节点的指针
+    TreeNodeIndex<T, Policy> node_index;              // 储存由索引策略决定的查找索引
+    TreeSubtreeStats<Policy::subtree_stats> subtree;  // 储存由索引策略决定的子树统计缓存
+    TreeNodeAllocation<T, Policy> allocation;         // 储存由索引策略决定的节点内存池
 
     /**
      * @brief "TreeNode"树节点构造函数: 创建一个新的节点对象，构造节点.
      * @param data const T&类型的参数，表示根节点的数据(data的数据类型可任意).
-     * @param parent_node_ptr TreeNode<T>* 类型的参数，表示指向父节点的指针, 默认为nullptr.
+     * @param parent_node_ptr TreeNode<T, Policy>* 类型的参数，表示指向父节点的指针, 默认为nullptr.
      * @note 用法：TreeNode< std::string > node("data", parent_node_ptr);
      */
-    TreeNode(const T& data, TreeNode<T>* parent_node_ptr = nullptr) : node_data(data), parent(parent_node_ptr) {}
+    TreeNode(const T& data, TreeNode<T, Policy>* parent_node_ptr = nullptr) : node_data(data), parent(parent_node_ptr) {}
 
     /**
      * @brief 向当前节点添加一个子节点
      * @param data const T&类型的参数，表示节点的值.
-     * @return TreeNode<T>* 返回一个指向新加子节点的指针
+     * @return TreeNode<T, Policy>* 返回一个指向新加子节点的指针
      * @note 当调用 addChild() 函数时，它将创建一个新的 TreeNode 对象，该对象保存传递给函数的数据，并将指向新创建节点的指针添加到当前节点的 children
      * 向量中。也就是说，addChild() 添加的是一个新的子节点。使用示例：parent_node_ptr->addChild(data) / parent_node_ptr->addChild(data0)->addChild(data1);
      */
-    TreeNode<T>* addChild(const T& data) {
-        // 为类分配内存并创建对象时会自动调用类的构造函数TreeNode(const T& data, TreeNode<T>* parent_node_ptr = nullptr);
+    TreeNode<T, Policy>* addChild(const T& data) {
+        // 为类分配内存并创建对象时会自动调用类的构造函数TreeNode(const T& data, TreeNode<T, Policy>* parent_node_ptr = nullptr);
         // parent_node_ptr->addChild(data); 在这个语句中 this 即是 parent_node_ptr;
-        children.emplace_back(make_unique<TreeNode>(data, this));  // 向父节点添加一个指向子节点的指针；
+        children.emplace_back(makeChild(data));  // 向父节点添加一个指向子节点的指针；
 
-        return this->findChild(data);  // 返回一个指向刚刚添加的子节点的指针
+        TreeNode<T, Policy>* child = children.back().get();  // 刚刚添加的子节点位于末尾, 无需再次查找
+        indexChild(child);                                  // 将子节点登记到索引中
+        growStats(child);                                   // 更新祖先的子树统计
+
+        return child;  // 返回一个指向刚刚添加的子节点的指针
     }
 
     /**
      * @brief 在当前节点的子节点中查找指定数据的节点
      * @param target_child_data const T&类型的参数，表示要查找的节点数据(值).
-     * @return TreeNode<T>* 指向查找到的节点的指针，如果未找到返回 nullptr.
+     * @return TreeNode<T, Policy>* 指向查找到的节点的指针，如果未找到返回 nullptr.
      * @note 使用示例：parent_node_ptr->findChild(target_child_data);
      */
-    TreeNode<T>* findChild(const T& target_child_data) {
+    TreeNode<T, Policy>* findChild(const T& target_child_data) {
+        // 启用子节点索引时直接查询哈希表
+        if constexpr (Policy::child_index) {
+            auto it = node_index.children.find(target_child_data);
+            return it == node_index.children.end() ? nullptr : it->second;
+        }
+
         // 遍历当前节点的每一个子节点
         for (auto& child : children) {
             if (child->node_data == target_child_data) {
@@ -96,31 +217,33 @@ class TreeNode {
     /**
      * @brief 在当前节点的后裔中查找所有与指定数据匹配的节点
      *
-     * 遍历当前节点及其所有子节点，递归查找匹配的数据，并返回所有匹配节点的指针。
+     * 以前序遍历当前节点的所有后裔(不含自身)，查找匹配的数据，并返回所有匹配节点的指针。
      * 该方法能够处理树中存在多个相同数据值的节点，返回所有匹配的节点指针。
      *
      * @param target_node_data 要查找的目标节点数据
-     * @return std::vector<TreeNode<T>*> 返回一个包含所有匹配节点指针的容器
+     * @return std::vector<TreeNode<T, Policy>*> 返回一个包含所有匹配节点指针的容器
      *         如果没有找到任何匹配节点，则返回空容器
      *
-     * @note 该方法使用递归方式遍历树结构，因此在树的深度较大时可能存在栈溢出的风险。
-     *       推荐对树的深度进行适当控制。
+     * @note 遍历使用显式栈而不是递归，树的深度较大时也不会导致栈溢出。
      */
-    std::vector<TreeNode<T>*> findDescendants(const T& target_node_data) {
-        std::vector<TreeNode<T>*> result;  ///< 用于存储找到的所有匹配节点指针
-
-        // 遍历当前节点的所有子节点
-        for (auto& child : children) {
-            // 如果子节点的数据与目标数据匹配，加入结果集
-            if (child->node_data == target_node_data) {
-                result.push_back(child.get());
+    std::vector<TreeNode<T, Policy>*> findDescendants(const T& target_node_data) {
+        std::vector<TreeNode<T, Policy>*> result;  ///< 用于存储找到的所有匹配节点指针
+
+        // 启用全局索引时只需检查具有该值的节点是否位于当前节点之下
+        if constexpr (Policy::global_index) {
+            if (node_index.registry != nullptr) {
+                auto range = node_index.registry->equal_range(target_node_data);
+                for (auto it = range.first; it != range.second; ++it)
+                    if (isAncestorOf(it->second)) result.push_back(it->second);
+                return result;
             }
+        }
 
-            // 递归查找子节点的后裔节点
-            std::vector<TreeNode<T>*> child_result = child->findDescendants(target_node_data);
-
-            // 将子节点的查找结果合并到当前结果中
-            result.insert(result.end(), child_result.begin(), child_result.end());
+        // 以前序遍历当前节点的所有后裔(跳过当前节点自身)
+        TreePreOrderIterator<T, Policy> it(this), end;
+        for (++it; it != end; ++it) {
+            // 如果后裔节点的数据与目标数据匹配，加入结果集
+            if (it->node_data == target_node_data) result.push_back(&*it);
         }
 
         return result;  ///< 返回所有找到的匹配节点
@@ -128,7 +251,7 @@ class TreeNode {
 
     /**
      * @brief 判断当前节点的一个子节点是否有孩子.
-     * @param node_ptr TreeNode<T>* 待判断节点的指针
+     * @param node_ptr TreeNode<T, Policy>* 待判断节点的指针
      * @return 如果存在子节点返回true, 否则返回false
      * @note 使用方法: node_ptr->hasChildren();
      */
@@ -145,10 +268,13 @@ class TreeNode {
      * 使用示例：parent_node_ptr->deleteChild(target_child_data);
      */
     bool deleteChild(const T& target_child_data) {
-        TreeNode<T>* child_node_ptr = findChild(target_child_data);  // 从当前父节点查找要删除的子节点的指针
+        TreeNode<T, Policy>* child_node_ptr = findChild(target_child_data);  // 从当前父节点查找要删除的子节点的指针
 
         // 判断这个子节点是否也存在子节点，这里只支持删除没有子节点的节点(树叶), 如果存在子节点或找不到要删除的子节点，返回 false
-        if (child_node_ptr == nullptr || hasChildren(child_node_ptr) == true) return false;
+        if (child_node_ptr == nullptr || child_node_ptr->hasChildren() == true) return false;
+
+        unindexChild(child_node_ptr);  // 从索引中移除该子节点
+        shrinkStats(child_node_ptr);   // 更新祖先的子树统计
 
         // 遍历当前父节点的所有子节点，在父节点中删除要删除的节点
         for (auto it = children.begin(); it != children.end(); ++it) {
@@ -162,13 +288,318 @@ class TreeNode {
 
         return true;
     }
+
+   private:
+    // 创建子节点: 当前节点来自内存池时子节点也从同一内存池分配
+    TreeNodePtr<T, Policy> makeChild(const T& data) {
+        if constexpr (Policy::pooled_nodes) {
+            if (allocation.pool != nullptr) {
+                TreeNode<T, Policy>* child_ptr = allocation.pool->create(data, this);
+                child_ptr->allocation.pool = allocation.pool;
+                return TreeNodePtr<T, Policy>(child_ptr);
+            }
+        }
+        return TreeNodePtr<T, Policy>(new TreeNode<T, Policy>(data, this));
+    }
+
+    // 判断当前节点是否为指定节点的祖先(不含自身)
+    bool isAncestorOf(const TreeNode<T, Policy>* node_ptr) const {
+        for (node_ptr = node_ptr->parent; node_ptr != nullptr; node_ptr = node_ptr->parent)
+            if (node_ptr == this) return true;
+        return false;
+    }
+
+    // 将新添加的子节点登记到索引中(子节点继承父节点所属树的全局索引)
+    void indexChild(TreeNode<T, Policy>* child_ptr) {
+        if constexpr (Policy::child_index) node_index.children.emplace(child_ptr->node_data, child_ptr);  // 已存在同值子节点时保留第一个
+        if constexpr (Policy::global_index) {
+            child_ptr->node_index.registry = node_index.registry;
+            if (node_index.registry != nullptr) node_index.registry->emplace(child_ptr->node_data, child_ptr);
+        }
+    }
+
+    // 注销并释放全部子节点, 与逐个删除不同, 宽节点也只需线性时间
+    void clearChildren() {
+        if constexpr (Policy::child_index) node_index.children.clear();
+        if constexpr (Policy::global_index) {
+            if (node_index.registry != nullptr) {
+                for (auto& child : children) unregisterSubtree(child.get());
+            }
+        }
+
+        // 先把后裔逐层移出再释放, 每个节点析构时都已没有子节点, 避免深树上的递归析构
+        std::vector<TreeNodePtr<T, Policy>> pending = std::move(children);
+        children.clear();
+        while (!pending.empty()) {
+            TreeNodePtr<T, Policy> node = std::move(pending.back());
+            pending.pop_back();
+            for (auto& child : node->children) pending.push_back(std::move(child));
+        }
+
+        // 当前节点变为叶子, 从自身开始向上扣除被释放的节点数与叶子数
+        if constexpr (Policy::subtree_stats) propagateShrink(this, subtree.size - 1, subtree.leaves - 1, nullptr);
+    }
+
+    // 新子节点挂上后, 沿祖先路径累加子树统计
+    void growStats(TreeNode<T, Policy>* child_ptr) {
+        if constexpr (Policy::subtree_stats) {
+            uint32_t added_leaves = child_ptr->subtree.leaves - (children.size() == 1 ? 1 : 0);  // 当前节点原本是叶子时不再计为叶子
+            uint32_t height = child_ptr->subtree.height + 1;
+            for (TreeNode<T, Policy>* node_ptr = this; node_ptr != nullptr; node_ptr = node_ptr->parent) {
+                node_ptr->subtree.size += child_ptr->subtree.size;
+                node_ptr->subtree.leaves += added_leaves;
+                node_ptr->subtree.height = std::max(node_ptr->subtree.height, height);
+                height = node_ptr->subtree.height + 1;
+            }
+        }
+    }
+
+    // 子节点摘下前, 沿祖先路径扣除其子树统计
+    void shrinkStats(TreeNode<T, Policy>* child_ptr) {
+        if constexpr (Policy::subtree_stats) {
+            uint32_t removed_leaves = child_ptr->subtree.leaves - (children.size() == 1 ? 1 : 0);  // 当前节点将变为叶子
+            propagateShrink(this, child_ptr->subtree.size, removed_leaves, child_ptr);
+        }
+    }
+
+    // 从 node_ptr 开始向上扣除节点数与叶子数, 并按剩余子节点重新计算高度(excluded_ptr 为即将被摘下的子节点)
+    static void propagateShrink(TreeNode<T, Policy>* node_ptr, uint32_t removed_size, uint32_t removed_leaves, const TreeNode<T, Policy>* excluded_ptr) {
+        for (; node_ptr != nullptr; node_ptr = node_ptr->parent, excluded_ptr = nullptr) {
+            node_ptr->subtree.size -= removed_size;
+            node_ptr->subtree.leaves -= removed_leaves;
+
+            uint32_t child_height = 0;
+            for (auto& child : node_ptr->children)
+                if (child.get() != excluded_ptr) child_height = std::max(child_height, child->subtree.height);
+            node_ptr->subtree.height = child_height + 1;
+        }
+    }
+
+    // 在子节点被移除前将其(及其后裔)从索引中注销
+    void unindexChild(TreeNode<T, Policy>* child_ptr) {
+        if constexpr (Policy::child_index) {
+            auto it = node_index.children.find(child_ptr->node_data);
+            if (it != node_index.children.end() && it->second == child_ptr) {
+                node_index.children.erase(it);
+
+                // 若还有同值的兄弟节点, 让索引指向其中的第一个, 与线性查找的结果保持一致
+                for (auto& sibling : children) {
+                    if (sibling.get() != child_ptr && sibling->node_data == child_ptr->node_data) {
+                        node_index.children.emplace(sibling->node_data, sibling.get());
+                        break;
+                    }
+                }
+            }
+        }
+        if constexpr (Policy::global_index) {
+            if (node_index.registry != nullptr) unregisterSubtree(child_ptr);
+        }
+    }
+
+    // 将以指定节点为根的子树从全局索引中注销
+    void unregisterSubtree(TreeNode<T, Policy>* subtree_ptr) {
+        std::vector<TreeNode<T, Policy>*> pending{subtree_ptr};
+        while (!pending.empty()) {
+            TreeNode<T, Policy>* node_ptr = pending.back();
+            pending.pop_back();
+
+            auto range = node_index.registry->equal_range(node_ptr->node_data);
+            for (auto it = range.first; it != range.second; ++it) {
+                if (it->second == node_ptr) {
+                    node_index.registry->erase(it);
+                    break;
+                }
+            }
+            for (auto& child : node_ptr->children) pending.push_back(child.get());
+        }
+    }
+};
+
+/**
+ * @brief 树的前序(深度优先)遍历迭代器
+ *
+ * 使用显式栈代替递归，逐个产出节点的引用而不复制节点数据。栈中只保存待访问节点的指针，
+ * 不会因为树的深度过大而导致调用栈溢出。
+ * @note 用法: for (auto& node : tree.preOrder()) { node.node_data; }
+ */
+template <typename T, typename Policy>
+class TreePreOrderIterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = TreeNode<T, Policy>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = TreeNode<T, Policy>*;
+    using reference = TreeNode<T, Policy>&;
+
+    TreePreOrderIterator() = default;  // 结束迭代器
+    explicit TreePreOrderIterator(TreeNode<T, Policy>* start_ptr) {
+        if (start_ptr != nullptr) pending.push_back(start_ptr);
+    }
+
+    reference operator*() const { return *pending.back(); }
+    pointer operator->() const { return pending.back(); }
+
+    TreePreOrderIterator& operator++() {
+        TreeNode<T, Policy>* node_ptr = pending.back();
+        pending.pop_back();
+
+        // 子节点逆序入栈, 使第一个子节点最先被访问
+        for (auto it = node_ptr->children.rbegin(); it != node_ptr->children.rend(); ++it) pending.push_back(it->get());
+        return *this;
+    }
+
+    bool operator==(const TreePreOrderIterator& other) const { return current() == other.current(); }
+    bool operator!=(const TreePreOrderIterator& other) const { return current() != other.current(); }
+
+   private:
+    pointer current() const { return pending.empty() ? nullptr : pending.back(); }
+
+    std::vector<TreeNode<T, Policy>*> pending;  // 待访问节点栈
+};
+
+/**
+ * @brief 树的后序遍历迭代器
+ *
+ * 先访问全部子节点再访问父节点。栈中保存从起点到当前节点路径上的节点及其下一个待访问子节点的序号，
+ * 栈的大小等于树的深度。
+ * @note 用法: for (auto& node : tree.postOrder()) { node.node_data; }
+ */
+template <typename T, typename Policy>
+class TreePostOrderIterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = TreeNode<T, Policy>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = TreeNode<T, Policy>*;
+    using reference = TreeNode<T, Policy>&;
+
+    TreePostOrderIterator() = default;  // 结束迭代器
+    explicit TreePostOrderIterator(TreeNode<T, Policy>* start_ptr) {
+        if (start_ptr != nullptr) descend(start_ptr);
+    }
+
+    reference operator*() const { return *path.back().first; }
+    pointer operator->() const { return path.back().first; }
+
+    TreePostOrderIterator& operator++() {
+        path.pop_back();
+        if (path.empty()) return *this;
+
+        // 父节点还有未访问的子节点时进入下一棵子树, 否则下一个访问的就是父节点自身
+        auto& parent = path.back();
+        if (parent.second < parent.first->children.size()) descend(parent.first->children[parent.second++].get());
+        return *this;
+    }
+
+    bool operator==(const TreePostOrderIterator& other) const { return current() == other.current(); }
+    bool operator!=(const TreePostOrderIterator& other) const { return current() != other.current(); }
+
+   private:
+    pointer current() const { return path.empty() ? nullptr : path.back().first; }
+
+    // 沿第一个子节点一直下降到叶子
+    void descend(TreeNode<T, Policy>* node_ptr) {
+        while (true) {
+            path.emplace_back(node_ptr, 0);
+            if (node_ptr->children.empty()) return;
+            path.back().second = 1;
+            node_ptr = node_ptr->children.front().get();
+        }
+    }
+
+    std::vector<std::pair<TreeNode<T, Policy>*, size_t>> path;  // 当前路径: 节点及其下一个待访问子节点的序号
 };
 
-template <typename T>
-class Tree {
+/**
+ * @brief 树的层序(广度优先)遍历迭代器
+ *
+ * 按层从左到右访问节点，队列中只保存待访问节点的指针。
+ * @note 用法: for (auto& node : tree.levelOrder()) { node.node_data; }
+ */
+template <typename T, typename Policy>
+class TreeLevelOrderIterator {
    public:
-    std::unique_ptr<TreeNode<T>> root;           // 储存树的根节点
-    TreeNode<T>* current_node_ptr = root.get();  // 储存最后一次添加节点后的指针位置(初始化时设为根节点指针)
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = TreeNode<T, Policy>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = TreeNode<T, Policy>*;
+    using reference = TreeNode<T, Policy>&;
+
+    TreeLevelOrderIterator() = default;  // 结束迭代器
+    explicit TreeLevelOrderIterator(TreeNode<T, Policy>* start_ptr) {
+        if (start_ptr != nullptr) pending.push(start_ptr);
+    }
+
+    reference operator*() const { return *pending.front(); }
+    pointer operator->() const { return pending.front(); }
+
+    TreeLevelOrderIterator& operator++() {
+        TreeNode<T, Policy>* node_ptr = pending.front();
+        pending.pop();
+        for (auto& child : node_ptr->children) pending.push(child.get());
+        return *this;
+    }
+
+    bool operator==(const TreeLevelOrderIterator& other) const { return current() == other.current(); }
+    bool operator!=(const TreeLevelOrderIterator& other) const { return current() != other.current(); }
+
+   private:
+    pointer current() const { return pending.empty() ? nullptr : pending.front(); }
+
+    std::queue<TreeNode<T, Policy>*> pending;  // 待访问节点队列
+};
+
+// 由起始迭代器构成的遍历区间, 供范围 for 循环使用
+template <typename Iterator>
+class TreeRange {
+   public:
+    explicit TreeRange(Iterator first) : first(first) {}
+
+    Iterator begin() const { return first; }
+    Iterator end() const { return Iterator(); }
+
+   private:
+    Iterator first;
+};
+
+template <typename T, typename Policy>
+void TreeNodeDeleter<T, Policy>::operator()(TreeNode<T, Policy>* node_ptr) const {
+    if (node_ptr->allocation.pool != nullptr)
+        node_ptr->allocation.pool->destroy(node_ptr);
+    else
+        delete node_ptr;
+}
+
+// 树的节点存储: 未启用内存池时根节点直接由堆分配
+template <typename T, typename Policy, bool PooledNodes = Policy::pooled_nodes>
+class TreeNodeStorage {
+   protected:
+    TreeNodePtr<T, Policy> allocateRoot(const T& data) { return TreeNodePtr<T, Policy>(new TreeNode<T, Policy>(data)); }
+};
+
+// 树的节点存储: 启用内存池时持有内存池, 根节点及之后添加的所有节点都从中分配.
+// 作为 Tree 的基类, 保证内存池先于根节点构造、晚于根节点析构.
+template <typename T, typename Policy>
+class TreeNodeStorage<T, Policy, true> {
+   public:
+    // 获取节点内存池(可用于查询存活节点数与内存占用)
+    const TreeNodePool<T, Policy>& nodePool() const { return node_pool; }
+
+   protected:
+    TreeNodePtr<T, Policy> allocateRoot(const T& data) {
+        TreeNode<T, Policy>* root_ptr = node_pool.create(data);
+        root_ptr->allocation.pool = &node_pool;
+        return TreeNodePtr<T, Policy>(root_ptr);
+    }
+
+    TreeNodePool<T, Policy> node_pool;  // 节点内存池
+};
+
+template <typename T, typename Policy>
+class Tree : public TreeNodeStorage<T, Policy> {
+   public:
+    TreeNodePtr<T, Policy> root;                         // 储存树的根节点
+    TreeNode<T, Policy>* current_node_ptr = root.get();  // 储存最后一次添加节点后的指针位置(初始化时设为根节点指针)
 
     /**
      * @brief "Tree"树构造函数: 创建一个新的Tree对象，构造根节点.
@@ -176,47 +607,89 @@ class Tree {
      * @return void
      * @note 用法：Tree< std::string > tree0("root");
      */
-    Tree(const T& data) : root(make_unique<TreeNode<T>>(data)) {}
+    Tree(const T& data) : root(this->allocateRoot(data)) {
+        // 启用全局索引时, 由根节点将索引传递给之后添加的所有节点
+        if constexpr (Policy::global_index) {
+            root->node_index.registry = &node_registry;
+            node_registry.emplace(data, root.get());
+        }
+    }
 
     /**
      * @brief 向当前节点添加一个子节点
-     * @param node_ptr TreeNode<T>*类型的参数(指向节点的指针)，表示在该节点下添加子节点.
+     * @param node_ptr TreeNode<T, Policy>*类型的参数(指向节点的指针)，表示在该节点下添加子节点.
      * @param data const T&类型的参数，表示要添加的节点的数据.
-     * @return TreeNode<T>* 返回一个指向刚刚添加的子节点的指针
+     * @return TreeNode<T, Policy>* 返回一个指向刚刚添加的子节点的指针
      * @note 当调用 `addNode()` 函数时，它将创建一个新的 `TreeNode`
      * 对象，该对象保存传递给函数的数据，并将指向新创建节点的指针添加到当前节点的`children`向量中。也就是说，`addNode()` 添加的是一个新的子节点。`addNode`
      * 与 `addChild` 不同, `addNode` 是 `Tree class` 的成员, 而 `addChild` 是`TreeNode class` 的成员, `addNode` 将父节点指针作为参数传递.
      * 该函数还会将指向新增节点的指针保存到类成员变量 `current_node_ptr`中,以便用户更清楚当前树的编辑位置.
      */
-    TreeNode<T>* addNode(TreeNode<T>* node_ptr, const T& data) { return current_node_ptr = node_ptr->addChild(data); }
+    TreeNode<T, Policy>* addNode(TreeNode<T, Policy>* node_ptr, const T& data) { return current_node_ptr = node_ptr->addChild(data); }
 
     /**
-     * @brief 以深度优先的方式遍历树
-     * @param node_ptr TreeNode<T>* 提供一个节点指针，函数会以该节点为根节点递归遍历它所有的子嗣节点(若不传参则默认遍历整颗树).
-     * @return 返回一个向量, 其中包含从指定节点开始子树的所有节点数据值和对应的指针 std::vector<std::pair<T, TreeNode<T>*>>
-     * @note 深度优先遍历算法是递归的，它首先访问根节点，然后再递归地遍历每个子树。在每个节点访问完成后，递归函数回溯到其父节点继续遍历其他子树
+     * @brief 获取前序(深度优先)遍历区间
+     * @param node_ptr TreeNode<T, Policy>* 遍历的起点(若不传参则默认遍历整颗树).
+     * @return 可用于范围 for 循环的遍历区间, 元素类型为 TreeNode<T, Policy>&
+     * @note 遍历是惰性的, 不会预先生成节点列表. 遍历期间不要添加或删除节点. 使用示例: for (auto& node : tree.preOrder()) {...}
      */
-    std::vector<std::pair<T, TreeNode<T>*>> traversalDFS(TreeNode<T>* node_ptr = nullptr) {
-        // 默认节点指针设置为根节点
-        if (node_ptr == nullptr) node_ptr = root.get();
+    TreeRange<TreePreOrderIterator<T, Policy>> preOrder(TreeNode<T, Policy>* node_ptr = nullptr) {
+        return TreeRange<TreePreOrderIterator<T, Policy>>(TreePreOrderIterator<T, Policy>(node_ptr == nullptr ? root.get() : node_ptr));
+    }
 
-        // 如果节点为空，直接返回一个空向量
-        if (node_ptr == nullptr) return {};
+    /**
+     * @brief 获取后序遍历区间(先访问子节点, 再访问父节点)
+     * @param node_ptr TreeNode<T, Policy>* 遍历的起点(若不传参则默认遍历整颗树).
+     * @return 可用于范围 for 循环的遍历区间, 元素类型为 TreeNode<T, Policy>&
+     */
+    TreeRange<TreePostOrderIterator<T, Policy>> postOrder(TreeNode<T, Policy>* node_ptr = nullptr) {
+        return TreeRange<TreePostOrderIterator<T, Policy>>(TreePostOrderIterator<T, Policy>(node_ptr == nullptr ? root.get() : node_ptr));
+    }
 
-        // 创建一个向量，用于存储当前节点和其子节点的数据
-        std::vector<std::pair<T, TreeNode<T>*>> tree_data;
+    /**
+     * @brief 获取层序(广度优先)遍历区间
+     * @param node_ptr TreeNode<T, Policy>* 遍历的起点(若不传参则默认遍历整颗树).
+     * @return 可用于范围 for 循环的遍历区间, 元素类型为 TreeNode<T, Policy>&
+     */
+    TreeRange<TreeLevelOrderIterator<T, Policy>> levelOrder(TreeNode<T, Policy>* node_ptr = nullptr) {
+        return TreeRange<TreeLevelOrderIterator<T, Policy>>(TreeLevelOrderIterator<T, Policy>(node_ptr == nullptr ? root.get() : node_ptr));
+    }
 
-        // 将当前节点的数据插入到 tree_data 向量的末尾
-        tree_data.emplace_back(std::pair<T, TreeNode<T>*>(node_ptr->node_data, node_ptr));
+    /**
+     * @brief 以前序访问子树中的每个节点
+     * @param visit 访问函数, 形如 void(TreeNode<T, Policy>& node), 节点以引用传入, 不复制节点数据.
+     * @param node_ptr TreeNode<T, Policy>* 遍历的起点(若不传参则默认遍历整颗树).
+     * @note 使用示例: tree.forEachPreOrder([](TreeNode<std::string>& node) { Serial.println(node.node_data.c_str()); });
+     */
+    template <typename Visitor>
+    void forEachPreOrder(Visitor&& visit, TreeNode<T, Policy>* node_ptr = nullptr) {
+        for (auto& node : preOrder(node_ptr)) visit(node);
+    }
 
-        // 遍历当前节点的每个子节点
-        for (auto& child : node_ptr->children) {
-            // 递归遍历当前子节点的子树，并将其存储在 deep_tree_data 向量中
-            auto deep_tree_data = traversalDFS(child.get());
+    // 以后序访问子树中的每个节点, 参数同 forEachPreOrder
+    template <typename Visitor>
+    void forEachPostOrder(Visitor&& visit, TreeNode<T, Policy>* node_ptr = nullptr) {
+        for (auto& node : postOrder(node_ptr)) visit(node);
+    }
 
-            // 将当前子节点的子树数据插入到 tree_data 向量的末尾
-            tree_data.insert(tree_data.end(), deep_tree_data.begin(), deep_tree_data.end());
-        }
+    // 以层序访问子树中的每个节点, 参数同 forEachPreOrder
+    template <typename Visitor>
+    void forEachLevelOrder(Visitor&& visit, TreeNode<T, Policy>* node_ptr = nullptr) {
+        for (auto& node : levelOrder(node_ptr)) visit(node);
+    }
+
+    /**
+     * @brief 以深度优先的方式遍历树
+     * @param node_ptr TreeNode<T, Policy>* 提供一个节点指针，函数会以该节点为根节点遍历它所有的子嗣节点(若不传参则默认遍历整颗树).
+     * @return 返回一个向量, 其中包含从指定节点开始子树的所有节点数据值和对应的指针 std::vector<std::pair<T, TreeNode<T, Policy>*>>
+     * @note 深度优先遍历首先访问根节点，然后依次遍历每个子树。该函数会复制每个节点的数据, 只需要访问节点时请使用 preOrder() 或 forEachPreOrder().
+     */
+    std::vector<std::pair<T, TreeNode<T, Policy>*>> traversalDFS(TreeNode<T, Policy>* node_ptr = nullptr) {
+        // 创建一个向量，用于存储当前节点和其子节点的数据
+        std::vector<std::pair<T, TreeNode<T, Policy>*>> tree_data;
+
+        // 按前序将每个节点的数据值和指针插入到 tree_data 向量的末尾
+        for (auto& node : preOrder(node_ptr)) tree_data.emplace_back(node.node_data, &node);
 
         // 返回包含当前节点及其所有子节点的数据的向量
         return tree_data;
@@ -224,36 +697,17 @@ class Tree {
 
     /**
      * @brief 以广度优先的方式遍历树。
-     * @param node_ptr TreeNode<T>* 提供一个节点指针，函数会以该节点为根节点递归遍历所有的子节点(若不传参则默认遍历整颗树).
-     * @return 返回一个向量, 其中包含从指定节点开始子树的所有节点数据值和对应的指针 std::vector<std::pair<T, TreeNode<T>*>>
+     * @param node_ptr TreeNode<T, Policy>* 提供一个节点指针，函数会以该节点为根节点遍历所有的子节点(若不传参则默认遍历整颗树).
+     * @return 返回一个向量, 其中包含从指定节点开始子树的所有节点数据值和对应的指针 std::vector<std::pair<T, TreeNode<T, Policy>*>>
      * @note 广度优先遍历算法是按层遍历，从根节点开始，先遍历根节点，然后按照从左到右的顺序遍历其子节点，再依次遍历下一层的所有节点。
+     * 该函数会复制每个节点的数据, 只需要访问节点时请使用 levelOrder() 或 forEachLevelOrder().
      */
-    std::vector<std::pair<T, TreeNode<T>*>> traversalBFS(TreeNode<T>* node_ptr = nullptr) {
-        // 默认节点指针设置为根节点
-        if (node_ptr == nullptr) node_ptr = root.get();
-
-        // 当节点为空时返回空向量
-        if (node_ptr == nullptr) return {};
-
+    std::vector<std::pair<T, TreeNode<T, Policy>*>> traversalBFS(TreeNode<T, Policy>* node_ptr = nullptr) {
         // 创建一个向量，用于存储当前节点和其子节点的数据
-        std::vector<std::pair<T, TreeNode<T>*>> tree_data;
-
-        // 定义队列，并将根节点推入队列
-        std::queue<TreeNode<T>*> node_queue;
-        node_queue.push(node_ptr);
+        std::vector<std::pair<T, TreeNode<T, Policy>*>> tree_data;
 
-        // 遍历队列，直到队列为空
-        while (!node_queue.empty()) {
-            // 取出队列头部的节点后将其弹出
-            auto current_node = node_queue.front();
-            node_queue.pop();
-
-            // 将当前节点的数据值和指针插入到 tree_data 向量的末尾
-            tree_data.emplace_back(std::pair<T, TreeNode<T>*>(current_node->node_data, current_node));
-
-            // 将当前节点的所有子节点推入队列
-            for (auto& child : current_node->children) node_queue.push(child.get());
-        }
+        // 按层序将每个节点的数据值和指针插入到 tree_data 向量的末尾
+        for (auto& node : levelOrder(node_ptr)) tree_data.emplace_back(node.node_data, &node);
 
         // 返回包含当前节点及其所有子节点的数据的向量
         return tree_data;
@@ -266,13 +720,21 @@ class Tree {
      * 如果找到与指定数据匹配的节点，则返回这些节点的指针；否则，返回空容器。
      *
      * @param target_node_data 要查找的节点数据.
-     * @return std::vector<TreeNode<T>*> 包含所有匹配节点指针的容器，如果未找到返回空容器.
+     * @return std::vector<TreeNode<T, Policy>*> 包含所有匹配节点指针的容器，如果未找到返回空容器.
      * @note 此方法会调用 `findDescendants` 来查找整个树中与目标数据匹配的所有节点。
      *       如果根节点的数据匹配目标数据，也会包含根节点自身。
      */
-    std::vector<TreeNode<T>*> findNode(const T& target_node_data) {
+    std::vector<TreeNode<T, Policy>*> findNode(const T& target_node_data) {
+        // 启用全局索引时直接返回具有该值的所有节点
+        if constexpr (Policy::global_index) {
+            auto range = node_registry.equal_range(target_node_data);
+            std::vector<TreeNode<T, Policy>*> node_ptrs;
+            for (auto it = range.first; it != range.second; ++it) node_ptrs.push_back(it->second);
+            return node_ptrs;
+        }
+
         // 使用根节点查找所有匹配的后裔节点
-        std::vector<TreeNode<T>*> node_ptrs = root->findDescendants(target_node_data);
+        std::vector<TreeNode<T, Policy>*> node_ptrs = root->findDescendants(target_node_data);
 
         // 如果根节点本身的数据与目标数据匹配，则将根节点加入结果
         if (root->node_data == target_node_data) {
@@ -285,41 +747,66 @@ class Tree {
 
     /**
      * @brief 判断指定节点是否存在子节点
-     * @param node_ptr TreeNode<T>* 待判断节点的指针
+     * @param node_ptr TreeNode<T, Policy>* 待判断节点的指针
      * @return 如果存在子节点返回true, 否则返回false
      */
-    bool hasChildren(TreeNode<T>* node_ptr) const {
+    bool hasChildren(TreeNode<T, Policy>* node_ptr) const {
         return !node_ptr->children.empty();  // 如果 node_ptr->children 不为空，则表示这个节点有子节点。
     }
 
     /**
-     * @brief 递归地计算树的深度(高度)(默认统计整颗树的深度)
-     * @param node_ptr TreeNode<T>*类型的参数(指向节点的指针)，表示从该节点开始统计树枝的深度，若设为root则为统计整颗树的深度(这也是无传参时的默认设置)
+     * @brief 一次遍历统计树或树枝的节点数、深度、叶子数、宽度与度
+     * @param node_ptr TreeNode<T, Policy>*类型的参数(指向节点的指针)，表示统计以该节点为起点的树枝，无传参时默认统计整颗树.
+     * @return TreeStats 统计结果
+     * @note 以层序遍历一次完成全部统计, 时间复杂度 O(N). 需要多项统计时应优先使用该函数, 而不是分别调用 getSize/getDepth/getWidth 等.
+     */
+    TreeStats getStats(TreeNode<T, Policy>* node_ptr = nullptr) {
+        TreeStats stats;
+        uint32_t level_size = 1;       // 当前层的节点数(起点所在的一层只有一个节点)
+        uint32_t level_remaining = 1;  // 当前层尚未访问的节点数
+        uint32_t next_level_size = 0;  // 下一层的节点数
+
+        for (auto& node : levelOrder(node_ptr)) {
+            ++stats.size;
+            if (node.hasChildren() == false) ++stats.breadth;
+            stats.degree = std::max(stats.degree, static_cast<uint32_t>(node.children.size()));
+            next_level_size += node.children.size();
+
+            // 当前层访问完毕, 进入下一层
+            if (--level_remaining == 0) {
+                ++stats.depth;
+                stats.width = std::max(stats.width, level_size);
+                level_size = level_remaining = next_level_size;
+                next_level_size = 0;
+            }
+        }
+
+        return stats;
+    }
+
+    /**
+     * @brief 计算树的深度(高度)(默认统计整颗树的深度)
+     * @param node_ptr TreeNode<T, Policy>*类型的参数(指向节点的指针)，表示从该节点开始统计树枝的深度，若设为root则为统计整颗树的深度(这也是无传参时的默认设置)
      * @return uint32_t 返回树的深度.
-     * @note 使用示例：1.统计整颗树的深度：tree.getHeight();    2.统计从 node1 节点开始的树枝深度：tree.getHeight(node1_ptr);
+     * @note 使用示例：1.统计整颗树的深度：tree.getDepth();    2.统计从 node1 节点开始的树枝深度：tree.getDepth(node1_ptr);
+     * 启用 SubtreeStats 策略时直接返回缓存值.
      */
-    uint32_t getDepth(TreeNode<T>* node_ptr = nullptr) {
+    uint32_t getDepth(TreeNode<T, Policy>* node_ptr = nullptr) {
         // 默认节点指针设置为根节点
         if (node_ptr == nullptr) node_ptr = root.get();
 
-        // 如果节点没有子节点，说明当前节点是叶子节点，返回 1 作为高度
-        if (hasChildren(node_ptr) == false) return 1;
+        if constexpr (Policy::subtree_stats) return node_ptr->subtree.height;
 
-        uint32_t max_depth = 0;  // 定义最大深度（一个树中最少有一个树枝最长）；
-
-        // 如果节点有子节点，则递归计算子节点的高度，并找到其中最大的高度
-        for (const auto& child : node_ptr->children) max_depth = std::max(max_depth, getDepth(child.get()));
-
-        // 返回最大高度加上 1，即为整个树的高度
-        return max_depth + 1;
+        // 按层遍历一次, 层数即为树的深度
+        return getStats(node_ptr).depth;
     }
 
     /**
      * @brief 获取节点的度(对于一个给定的节点，其子节点的数量称为度. 一个叶子的度数一定是零)
-     * @param node_ptr TreeNode<T>*类型的参数(指向节点的指针)，表示获取该节点的子节点的个数，无传参时默认获取根节点的度.
+     * @param node_ptr TreeNode<T, Policy>*类型的参数(指向节点的指针)，表示获取该节点的子节点的个数，无传参时默认获取根节点的度.
      * @return uint32_t 返回目标节点的子节点的个数.
      */
-    uint32_t getDegree(TreeNode<T>* node_ptr = nullptr) {
+    uint32_t getDegree(TreeNode<T, Policy>* node_ptr = nullptr) {
         // 默认节点指针设置为根节点
         if (node_ptr == nullptr) node_ptr = root.get();
 
@@ -335,7 +822,7 @@ class Tree {
         uint32_t max_degree = 0;  // 初始化最大度为0
 
         // 对树进行深度优先遍历获取所有节点的子节点个数，这里将当前最大值max_degree与遍历到的父节点的子节点个数进行比较后取较大值更新回max_degree中.
-        for (auto& node : traversalDFS()) max_degree = std::max(max_degree, node.second->children.size());
+        forEachPreOrder([&max_degree](TreeNode<T, Policy>& node) { max_degree = std::max(max_degree, static_cast<uint32_t>(node.children.size())); });
 
         // 遍历完成后返回树中所有结点的度的最大值
         return max_degree;
@@ -343,19 +830,23 @@ class Tree {
 
     /**
      * @brief 获取树或树枝的叶子数量(叶子即没有子节点的节点，也称做终端节点)
-     * @param node_ptr TreeNode<T>*类型的参数(指向节点的指针)，表示获取以该节点为起点的树枝的叶子个数，无传参时默认获取整个树的叶子数量.
+     * @param node_ptr TreeNode<T, Policy>*类型的参数(指向节点的指针)，表示获取以该节点为起点的树枝的叶子个数，无传参时默认获取整个树的叶子数量.
      * @return 返回树或指定树枝的叶子数量
      */
-    uint32_t getBreadth(TreeNode<T>* node_ptr = nullptr) {
+    uint32_t getBreadth(TreeNode<T, Policy>* node_ptr = nullptr) {
         // 默认节点指针设置为根节点
         if (node_ptr == nullptr) node_ptr = root.get();
 
+        if constexpr (Policy::subtree_stats) return node_ptr->subtree.leaves;
+
         uint32_t num_leaves = 0;  // 初始化叶子数为0
 
-        // 对树进行深度优先遍历;
-        for (auto& node : traversalDFS(node_ptr))
-            // 如果一个节点没有子节点，则增加叶子数.
-            if (hasChildren(node.second) == false) ++num_leaves;
+        // 对树进行深度优先遍历; 如果一个节点没有子节点，则增加叶子数.
+        forEachPreOrder(
+            [&num_leaves](TreeNode<T, Policy>& node) {
+                if (node.hasChildren() == false) ++num_leaves;
+            },
+            node_ptr);
 
         // 返回树的叶子数量
         return num_leaves;
@@ -363,38 +854,38 @@ class Tree {
 
     /**
      * @brief 获取树的宽度或指定节点所在层的宽度(宽度指一个层的节点数)
-     * @param node_ptr TreeNode<T>*类型的参数(指向节点的指针)，表示获取该节点所在层的宽度，无传参时默认获取整个树的宽度(拥有最大宽度的层级).
+     * @param node_ptr TreeNode<T, Policy>*类型的参数(指向节点的指针)，表示获取该节点所在层的宽度，无传参时默认获取整个树的宽度(拥有最大宽度的层级).
      * @return 无参数时返回树的宽度，有参数时返回参数节点所在层的宽度.
      */
-    uint32_t getWidth(TreeNode<T>* node_ptr = nullptr) {
-        // 如果没有传递指针，则默认使用根节点指针。
-        if (node_ptr == nullptr) node_ptr = root.get();
-
-        uint32_t max_level_width = 0;                         // 用于储存树的宽度(拥有最大宽度的层级)
-        std::unordered_map<uint32_t, uint32_t> level_widths;  // 用于存储每个层级的节点数的哈希表
-
-        // 使用广度优先搜索遍历每个节点
-        for (auto& node : traversalBFS(node_ptr)) {
-            uint32_t level = static_cast<uint32_t>(getLevel(node.second));  // 获取当前节点的层级
-            auto iter = level_widths.find(level);                           // 查找当前层级是否已经在哈希表中存在
-
-            if (iter != level_widths.end()) {
-                ++iter->second;                                             // 如果存在，就增加该层级的节点数
-                max_level_width = std::max(max_level_width, iter->second);  // 更新树的宽度
-            } else
-                level_widths.insert({level, 1});  // 如果不存在，就将该层级的节点数设置为1
+    uint32_t getWidth(TreeNode<T, Policy>* node_ptr = nullptr) {
+        // 如果没有传递指针或传入根节点，则返回树的宽度(拥有最大宽度的层级)
+        if (node_ptr == nullptr || node_ptr == root.get()) return getStats().width;
+
+        // 否则从根节点按层遍历, 统计与该节点处于同一层的节点数
+        uint32_t target_level = static_cast<uint32_t>(getLevel(node_ptr));
+        uint32_t level = 0;
+        uint32_t level_remaining = 1;  // 当前层尚未访问的节点数
+        uint32_t next_level_size = 0;  // 下一层的节点数
+
+        for (auto& node : levelOrder()) {
+            next_level_size += node.children.size();
+            if (--level_remaining != 0) continue;
+
+            // 当前层访问完毕, 若下一层就是目标层则其节点数即为所求
+            if (++level == target_level) return next_level_size;
+            level_remaining = next_level_size;
+            next_level_size = 0;
         }
 
-        // 如果传入的指针是根节点指针或空指针，则返回树的宽度；否则返回该节点所在层级的节点数
-        return node_ptr == root.get() ? max_level_width : level_widths.find(getLevel(node_ptr))->second;
+        return 0;
     }
 
     /**
      * @brief 获取指定节点的层级(一个节点的层级是它与根节点之间唯一路径上的边的数量, 根节点层级为零)
-     * @param node_ptr TreeNode<T>*类型的参数(指向节点的指针)，表示获取该节点的层级.
+     * @param node_ptr TreeNode<T, Policy>*类型的参数(指向节点的指针)，表示获取该节点的层级.
      * @return 返回指定节点的所在层级数, 如果提供的节点指针为空指针则返回-1
      */
-    int32_t getLevel(TreeNode<T>* node_ptr) {
+    int32_t getLevel(TreeNode<T, Policy>* node_ptr) {
         // 当节点为空时返回错误信息
         if (node_ptr == nullptr) return -1;
 
@@ -411,15 +902,20 @@ class Tree {
 
     /**
      * @brief 获取树或树枝的大小(节点数)
-     * @param node_ptr TreeNode<T>*类型的参数(指向节点的指针)，表示获取以该节点为起点的树枝的节点总数，无传参时默认获取整个树的节点总数.
+     * @param node_ptr TreeNode<T, Policy>*类型的参数(指向节点的指针)，表示获取以该节点为起点的树枝的节点总数，无传参时默认获取整个树的节点总数.
      * @return 返回树或指定树枝的节点总数
      */
-    uint32_t getSize(TreeNode<T>* node_ptr = nullptr) {
+    uint32_t getSize(TreeNode<T, Policy>* node_ptr = nullptr) {
         // 默认节点指针设置为根节点
         if (node_ptr == nullptr) node_ptr = root.get();
 
+        if constexpr (Policy::subtree_stats) return node_ptr->subtree.size;
+
+        uint32_t num_nodes = 0;  // 初始化节点数为0
+
         // 对树进行深度优先遍历然后返回树中的节点数;
-        return traversalDFS(node_ptr).size();
+        forEachPreOrder([&num_nodes](TreeNode<T, Policy>&) { ++num_nodes; }, node_ptr);
+        return num_nodes;
     }
 
     /**
@@ -430,31 +926,24 @@ class Tree {
 
     /**
      * @brief 递归删除一个节点及其后裔
-     * @param node_ptr TreeNode<T>* 这里需要提供指向待删除节点的指针
+     * @param node_ptr TreeNode<T, Policy>* 这里需要提供指向待删除节点的指针
      * @return 删除成功返回true，否则返回false
      * @note 使用示例：tree.deleteNode(node_1);
      */
-    bool deleteNode(TreeNode<T>* node_ptr) {
+    bool deleteNode(TreeNode<T, Policy>* node_ptr) {
         // 如果节点为空，直接返回
         if (node_ptr == nullptr) return false;
 
-        // 获取该节点的所有子节点，并遍历删除它们
-        auto& children = node_ptr->children;
-        for (auto it = children.begin(); it != children.end();) {
-            auto& child = *it;  // it 是迭代器, *it 是迭代器所指的内容.
-
-            // 这里是在判断一个节点是否有孩子.
-            if (hasChildren(child.get()) == true)
-                deleteNode(child.get());  // 如果子节点不是树叶节点(有孩子)，则递归调用 deleteNode
-            else
-                it = children.erase(it);  // 移除树叶节点(如果删除成功，该函数会返回指向被删除元素之后的元素的迭代器)
-        }
+        // 从索引中注销并释放该节点的所有子节点(std::unique_ptr 会自动释放各自的后裔)
+        node_ptr->clearChildren();
 
         // 检查当前节点node_ptr是否为根节点，如果是，则返回 false, 这里无法删除根节点.
         if (node_ptr->parent == nullptr) return false;
 
         // 在删除完这个节点的孩子后, 删除它自身
         auto parent = node_ptr->parent;  // 获取当前节点的父节点指针
+        parent->unindexChild(node_ptr);  // 从索引中注销当前节点
+        parent->shrinkStats(node_ptr);   // 更新祖先的子树统计
 
         // 在父节点的子节点列表中查找并移除当前节点
         parent->children.erase(
@@ -464,7 +953,7 @@ class Tree {
 
                            // 查找谓词，用于确定哪些元素符合要求。该函数或函数对象接受一个元素作为参数.
                            // remove_if算法会将child传入这个匿名函数, 如果 child指针与node_ptr相同则返回 true.
-                           [node_ptr](std::unique_ptr<TreeNode<T>>& child) { return child.get() == node_ptr; }),
+                           [node_ptr](TreeNodePtr<T, Policy>& child) { return child.get() == node_ptr; }),
             parent->children.end()  // 移除的终止位置
         );
 
@@ -476,10 +965,47 @@ class Tree {
      * @note 使用示例：tree.deleteTree();
      */
     void deleteTree() {
+        // 整棵树都将被删除, 直接清空全局索引, 不再逐个注销节点
+        if constexpr (Policy::global_index) {
+            node_registry.clear();
+            if (root != nullptr) root->node_index.registry = nullptr;
+        }
+
+        // 启用内存池时整棵树的节点一起析构, 不再逐个归还空闲链表, 最后按块一次性回收内存池
+        if constexpr (Policy::pooled_nodes) {
+            releasePooledTree();
+            return;
+        }
+
         deleteNode(root.get());  // 删除根节点的所有子嗣节点;
         root.reset();            // 移除根节点(将根节点重置为nullptr);
     }
 
     // Tree的析构函数
     ~Tree() { deleteTree(); }
+
+   private:
+    struct EmptyRegistry {};
+
+    // 析构整棵树的所有节点并回收内存池. 节点依次脱离父节点后再析构, 避免深树上的递归析构;
+    // 来自本树内存池的节点只调用析构函数, 其余节点(如由堆分配的节点)仍交给删除器释放.
+    void releasePooledTree() {
+        if (root == nullptr) return;
+
+        std::vector<TreeNode<T, Policy>*> pending{root.release()};
+        while (!pending.empty()) {
+            TreeNode<T, Policy>* node_ptr = pending.back();
+            pending.pop_back();
+            for (auto& child : node_ptr->children) pending.push_back(child.release());
+
+            if (node_ptr->allocation.pool == &this->node_pool)
+                node_ptr->~TreeNode();
+            else
+                TreeNodeDeleter<T, Policy>()(node_ptr);
+        }
+        this->node_pool.reset();
+    }
+
+    // 全局节点值索引(仅在索引策略启用 GlobalIndex 时存在)
+    std::conditional_t<Policy::global_index, TreeNodeRegistry<T, Policy>, EmptyRegistry> node_registry;
 };
\ No newline at end of file
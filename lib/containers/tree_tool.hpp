@@ -34,13 +34,14 @@ class TreeTool {
      * 该函数递归地遍历树的每个节点，使用不同的连接符（如`├─`、`│  ├─`）表示层级关系，并返回整个树的结构字符串。
      *
      * @tparam T 节点的数据类型
+     * @tparam Policy 树的索引策略
      * @param node 当前树节点指针
      * @param prefix 当前节点的缩进前缀，默认空
      * @param isLast 是否为当前节点的最后一个子节点，默认false
      * @return std::string 返回树的结构字符串
      */
-    template <typename T>
-    std::string getTreeString(TreeNode<T>* node, const std::string& prefix = "", bool isLast = false) {
+    template <typename T, typename Policy>
+    std::string getTreeString(TreeNode<T, Policy>* node, const std::string& prefix = "", bool isLast = false) {
         if (node == nullptr) {
             return "";  ///< 如果节点为空，返回空字符串
         }
@@ -67,11 +68,12 @@ class TreeTool {
      * 该函数从树的根节点开始调用递归函数，构建并返回整个树的结构字符串。
      *
      * @tparam T 节点的数据类型
+     * @tparam Policy 树的索引策略
      * @param tree 树的对象
      * @return std::string 返回整个树的结构字符串
      */
-    template <typename T>
-    std::string getTreeString(const Tree<T>& tree) {
+    template <typename T, typename Policy>
+    std::string getTreeString(const Tree<T, Policy>& tree) {
         return getTreeString(tree.root.get());  ///< 从树的根节点开始生成树结构字符串
     }
 
@@ -79,14 +81,15 @@ class TreeTool {
      * @brief 获取指定节点的完整路径
      *
      * @tparam T 节点数据类型
+     * @tparam Policy 树的索引策略
      * @param node 指向目标节点的指针
      * @return std::string 完整路径字符串
      *
      * @note 此函数从目标节点开始，逐级向上追溯父节点，
      *       拼接各节点数据构建完整路径，直到根节点为止。
      */
-    template <typename T>
-    std::string getPath(TreeNode<T>* node) {
+    template <typename T, typename Policy>
+    std::string getPath(TreeNode<T, Policy>* node) {
         std::string found_path = node->node_data;  // 初始化路径
 
         // 从目标节点向上遍历到根节点，构建完整路径
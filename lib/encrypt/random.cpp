@@ -22,11 +22,17 @@
  * Electronic Mail : asdfghjkl851@outlook.com
  */
 
-#include <esp_system.h>
 #include <random.h>
 
 #include <random>
 
+#ifdef ARDUINO
+#include <esp_system.h>
+#else
+// 主机端(native 测试环境)没有硬件随机数发生器, 以 std::random_device 代替
+static uint32_t esp_random() { return std::random_device{}(); }
+#endif
+
 std::random_device rd;  // 用于获取随机种子
 
 /*
@@ -23,6 +23,7 @@
  */
 
 #pragma once
+#include <cstdint>
 #include <vector>
 
 // 生成指定长度的真随机数.
@@ -0,0 +1,408 @@
+/**
+ * @file directory_index.hpp
+ * @date 17.10.2026
+ * @author RMSHE
+ *
+ * < GasSensorOS >
+ * Copyright(C) 2026 RMSHE. All rights reserved.
+ *
+ * This program is free software : you can redistribute it and /or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.If not, see < https://www.gnu.org/licenses/>.
+ *
+ * Electronic Mail : asdfghjkl851@outlook.com
+ */
+
+#pragma once
+#include <algorithm>
+#include <directory_manager.hpp>
+#include <file_manager.hpp>
+#include <fs_Interface.hpp>
+#include <map>
+#include <memory>
+#include <serial_warning.hpp>
+#include <string>
+#include <tree.hpp>
+#include <vector>
+
+/**
+ * @brief 目录索引：文件系统命名空间在内存中的镜像
+ *
+ * 索引在首次使用时建立(优先从持久化文件恢复，否则完整扫描一次闪存)，之后通过 `FSInterface::onChange()` 回调增量维护：
+ * 任何组件(FileExplorer、FileManager、DirectoryManager 或直接使用 FSInterface)创建、删除、重命名文件或目录都会记入索引。
+ * 索引尚未建立时变更只追加到日志，下次建立时随日志一起重放，因此重启后索引仍与闪存一致。
+ * 查找名称与枚举子树只需访问内存，不再逐项打开闪存文件。
+ *
+ * 持久化文件采用追加式日志：首行起为快照记录，之后每次修改追加一条记录，启动时按顺序重放即可恢复索引。
+ * 日志记录数超过快照规模时自动压缩为新的快照。记录格式(每行一条)：
+ * - `+D <path>` / `+F <path>`：新增目录 / 文件(自动补齐父目录)
+ * - `- <path>`：删除路径及其子树
+ * - `> <from>\t<to>`：移动路径
+ *
+ * @note 在安装回调之前(即第一个 `FileExplorer` 构造之前)对闪存的修改不会反映到索引中，此时可调用 `rebuild()`
+ * (命令行 `reindex`)重新扫描；日志记录损坏时也会自动重新扫描。
+ */
+class DirectoryIndex {
+   public:
+    // 索引中的一个条目(目录或文件)
+    struct Entry {
+        bool is_dir = true;                                     // 是否为目录
+        std::map<std::string, std::unique_ptr<Entry>> children;  // 子条目(按名称有序)
+    };
+
+    /**
+     * @brief 构造函数
+     * @param persist_path 持久化文件路径, 为空字符串时不持久化
+     */
+    explicit DirectoryIndex(const std::string& persist_path = "/.os/dir_index.db") : persist_path_(persist_path) {}
+
+    // 设置持久化文件路径(为空字符串时关闭持久化)
+    void setPersistPath(const std::string& persist_path) { persist_path_ = persist_path; }
+
+    // 索引是否已建立
+    bool isLoaded() const { return loaded_; }
+
+    // 索引中的条目总数(不含根目录)
+    size_t size() const { return entry_count_; }
+
+    /**
+     * @brief 确保索引已建立
+     * 若持久化文件存在则重放日志恢复索引，否则完整扫描闪存并写入快照。
+     */
+    void ensureLoaded() {
+        if (loaded_) return;
+        if (!persist_path_.empty() && fs.exists(persist_path_) && load()) return;
+        rebuild();
+    }
+
+    /**
+     * @brief 完整扫描闪存，重建索引并写入快照
+     */
+    void rebuild() {
+        clear();
+        scanDir("/", root_);
+        loaded_ = true;
+        save();
+    }
+
+    /**
+     * @brief 将当前索引压缩写入持久化文件(快照)
+     * @return 成功返回 true; 未启用持久化或写入失败返回 false
+     */
+    bool save() {
+        if (persist_path_.empty() || !loaded_) return false;
+
+        // 确保持久化文件所在目录存在, 并将其纳入索引
+        updating_ = true;
+        std::string parent = parentPath(persist_path_);
+        if (parent != "/" && !fs.exists(parent)) {
+            DirectoryManager().createDir(parent);
+        }
+        if (parent != "/") add(parent, true);
+
+        std::string snapshot;
+        serialize(root_, "", snapshot);
+
+        journal_records_ = 0;
+        const bool saved = file.writeFileAsString(persist_path_, snapshot, "w");
+        updating_ = false;
+        return saved;
+    }
+
+   public:
+    // ---- 增量维护 ----
+
+    /**
+     * @brief 应用一次命名空间变更(由 FSInterface::onChange() 回调调用)
+     * 索引已建立时更新内存并追加日志；尚未建立时只追加日志(没有持久化文件时下次建立会完整扫描, 无需记录)。
+     * 未启用持久化时只更新内存。
+     * @param change 变更类型
+     * @param path 变更的路径
+     * @param target 重命名的目标路径
+     */
+    void apply(FSInterface::Change change, const std::string& path, const std::string& target) {
+        if (updating_ || (!persist_path_.empty() && normalize(path) == persist_path_)) return;  // 忽略索引写持久化文件本身引起的变更
+
+        std::string record;
+        switch (change) {
+            case FSInterface::Change::CreateFile:
+            case FSInterface::Change::CreateDir: {
+                const bool is_dir = change == FSInterface::Change::CreateDir;
+                if (loaded_) add(path, is_dir);
+                record = std::string(is_dir ? "+D " : "+F ") + normalize(path);
+                break;
+            }
+            case FSInterface::Change::Remove:
+                if (normalize(path) == "/") {
+                    clear();  // 文件系统已格式化, 持久化文件随之消失, 下次使用时重新扫描
+                    return;
+                }
+                if (loaded_) remove(path);
+                record = "- " + normalize(path);
+                break;
+            case FSInterface::Change::Rename:
+                if (loaded_) move(path, target);
+                record = "> " + normalize(path) + "\t" + normalize(target);
+                break;
+        }
+        journal(record);
+    }
+
+   public:
+    // ---- 查询 ----
+
+    /**
+     * @brief 查找路径对应的条目
+     * @return 条目指针, 不存在时返回 nullptr
+     */
+    const Entry* find(const std::string& path) const {
+        const Entry* node = &root_;
+        for (const auto& name : splitPath(path)) {
+            auto it = node->children.find(name);
+            if (it == node->children.end()) return nullptr;
+            node = it->second.get();
+        }
+        return node;
+    }
+
+    bool exists(const std::string& path) const { return find(path) != nullptr; }
+
+    bool isDirectory(const std::string& path) const {
+        const Entry* entry = find(path);
+        return entry != nullptr && entry->is_dir;
+    }
+
+    /**
+     * @brief 将指定目录的子树展开到树节点下(仅访问内存)
+     * @param path 目录路径
+     * @param parent 子条目将作为该节点的子节点添加
+     * @return 路径存在返回 true
+     */
+    template <typename Policy>
+    bool buildTree(const std::string& path, TreeNode<std::string, Policy>& parent) const {
+        const Entry* entry = find(path);
+        if (entry == nullptr) return false;
+        buildSubTree(*entry, parent);
+        return true;
+    }
+
+   private:
+    // 清空索引
+    void clear() {
+        root_.children.clear();
+        entry_count_ = 0;
+        loaded_ = false;
+    }
+
+    // 新增路径, 缺失的父目录一并补齐; 返回对应条目
+    Entry* add(const std::string& path, bool is_dir) {
+        std::vector<std::string> names = splitPath(path);
+        Entry* node = &root_;
+        for (size_t i = 0; i < names.size(); ++i) {
+            auto& slot = node->children[names[i]];
+            if (!slot) {
+                slot.reset(new Entry());
+                slot->is_dir = (i + 1 < names.size()) || is_dir;
+                ++entry_count_;
+            }
+            node = slot.get();
+        }
+        return node;
+    }
+
+    // 删除路径及其子树
+    bool remove(const std::string& path) {
+        std::unique_ptr<Entry> entry = detach(path);
+        if (!entry) return false;
+        entry_count_ -= countEntries(*entry);
+        return true;
+    }
+
+    // 移动路径(目标已存在时被覆盖)
+    bool move(const std::string& from, const std::string& to) {
+        std::unique_ptr<Entry> entry = detach(from);
+        if (!entry) return false;
+        size_t moved = countEntries(*entry);
+        entry_count_ -= moved;
+        attach(to, std::move(entry), moved);
+        return true;
+    }
+
+    // 将条目从父目录中摘下并返回
+    std::unique_ptr<Entry> detach(const std::string& path) {
+        std::vector<std::string> names = splitPath(path);
+        if (names.empty()) return nullptr;  // 不允许摘下根目录
+
+        Entry* parent = const_cast<Entry*>(find(parentPath(normalize(path))));
+        if (parent == nullptr) return nullptr;
+
+        auto it = parent->children.find(names.back());
+        if (it == parent->children.end()) return nullptr;
+
+        std::unique_ptr<Entry> entry = std::move(it->second);
+        parent->children.erase(it);
+        return entry;
+    }
+
+    // 将条目挂到目标路径上(父目录自动补齐)
+    void attach(const std::string& path, std::unique_ptr<Entry> entry, size_t count) {
+        std::vector<std::string> names = splitPath(path);
+        if (names.empty()) return;
+
+        remove(path);  // 覆盖已存在的目标
+        Entry* parent = add(parentPath(normalize(path)), true);
+        parent->children[names.back()] = std::move(entry);
+        entry_count_ += count;
+    }
+
+    static size_t countEntries(const Entry& entry) {
+        size_t count = 1;
+        for (const auto& child : entry.children) count += countEntries(*child.second);
+        return count;
+    }
+
+    template <typename Policy>
+    static void buildSubTree(const Entry& entry, TreeNode<std::string, Policy>& parent) {
+        for (const auto& child : entry.children) {
+            TreeNode<std::string, Policy>* node = parent.addChild(child.first);
+            if (child.second->is_dir) buildSubTree(*child.second, *node);
+        }
+    }
+
+    // 扫描闪存目录(每个目录只打开一次, 条目类型随遍历一并取得)
+    void scanDir(const std::string& path, Entry& node) {
+        if (!fs.openDir(path)) return;
+        std::vector<std::pair<std::string, bool>> entries = fs.listEntries();
+
+        for (const auto& item : entries) {
+            std::string child_path = (path == "/" ? "/" : path + "/") + item.first;
+            if (child_path == persist_path_) continue;  // 持久化文件本身不纳入索引
+
+            std::unique_ptr<Entry> child(new Entry());
+            child->is_dir = item.second;
+            ++entry_count_;
+            if (item.second) scanDir(child_path, *child);
+            node.children[item.first] = std::move(child);
+        }
+    }
+
+    // 以前序方式序列化为快照记录
+    static void serialize(const Entry& entry, const std::string& path, std::string& out) {
+        for (const auto& child : entry.children) {
+            std::string child_path = path + "/" + child.first;
+            out += child.second->is_dir ? "+D " : "+F ";
+            out += child_path;
+            out += '\n';
+            if (child.second->is_dir) serialize(*child.second, child_path, out);
+        }
+    }
+
+    // 从持久化文件重放日志恢复索引
+    bool load() {
+        std::string data;
+        if (!file.readFileAsString(persist_path_, data)) return false;
+
+        clear();
+        size_t records = 0;
+        size_t pos = 0;
+        while (pos < data.size()) {
+            size_t end = data.find('\n', pos);
+            if (end == std::string::npos) end = data.size();
+            if (!replay(data.substr(pos, end - pos))) {
+                WARN(WarningLevel::WARNING, "目录索引记录损坏, 将重新扫描: %s", persist_path_.c_str());
+                clear();
+                return false;
+            }
+            ++records;
+            pos = end + 1;
+        }
+
+        loaded_ = true;
+        journal_records_ = records > entry_count_ ? records - entry_count_ : 0;
+        return true;
+    }
+
+    // 重放一条日志记录
+    bool replay(const std::string& record) {
+        if (record.size() < 3) return false;
+        if (record[0] == '+') {
+            add(record.substr(3), record[1] == 'D');
+            return true;
+        }
+
+        std::string args = record.substr(2);
+        if (record[0] == '-') {
+            remove(args);
+            return true;
+        }
+
+        size_t tab = args.find('\t');
+        if (tab == std::string::npos) return false;
+        if (record[0] == '>') {
+            move(args.substr(0, tab), args.substr(tab + 1));
+            return true;
+        }
+        return false;
+    }
+
+    // 追加一条日志记录, 日志过长时压缩为快照
+    void journal(const std::string& record) {
+        if (persist_path_.empty()) return;
+        if (loaded_ && ++journal_records_ > std::max<size_t>(entry_count_, 64)) {
+            save();
+            return;
+        }
+        if (!loaded_ && !fs.exists(persist_path_)) return;  // 没有持久化文件, 下次建立时完整扫描
+
+        updating_ = true;
+        file.writeFileAsString(persist_path_, record + "\n", "a");
+        updating_ = false;
+    }
+
+    // 拆分路径为各级名称(忽略空段)
+    static std::vector<std::string> splitPath(const std::string& path) {
+        std::vector<std::string> names;
+        size_t pos = 0;
+        while (pos < path.size()) {
+            size_t end = path.find('/', pos);
+            if (end == std::string::npos) end = path.size();
+            if (end > pos) names.emplace_back(path.substr(pos, end - pos));
+            pos = end + 1;
+        }
+        return names;
+    }
+
+    // 规范化路径: "/a//b/" -> "/a/b"
+    static std::string normalize(const std::string& path) {
+        std::string result;
+        for (const auto& name : splitPath(path)) result += "/" + name;
+        return result.empty() ? "/" : result;
+    }
+
+    // 获取规范化路径的父路径: "/a/b" -> "/a"; "/a" -> "/"
+    static std::string parentPath(const std::string& path) {
+        size_t pos = path.find_last_of('/');
+        if (pos == std::string::npos || pos == 0) return "/";
+        return path.substr(0, pos);
+    }
+
+   private:
+    Entry root_;                    // 根目录条目
+    std::string persist_path_;      // 持久化文件路径
+    bool loaded_ = false;           // 索引是否已建立
+    size_t entry_count_ = 0;        // 条目总数
+    size_t journal_records_ = 0;    // 自上次快照以来追加的日志记录数
+    bool updating_ = false;         // 正在写持久化文件(期间的变更回调来自索引自身, 应忽略)
+
+    FSInterface fs;    // 底层文件系统接口实例
+    FileManager file;  // 用于读写持久化文件
+};
@@ -24,7 +24,7 @@
 
 #pragma once
 #include <file_manager.hpp>
-#include <fs_interface.hpp>
+#include <fs_Interface.hpp>
 #include <serial_warning.hpp>
 #include <string>
 #include <string_edit.hpp>
@@ -24,6 +24,7 @@
 
 #include <file_explorer.h>
 
+#include <chrono>
 #include <string_edit.hpp>
 #include <type_traits>
 
@@ -33,7 +34,10 @@
  */
 // FileExplorer::FileExplorer(const std::string& metadatabase_path) : meta(metadatabase_path) { fs.mount(); }
 
-FileExplorer::FileExplorer(const std::string& metadatabase_path) { fs.mount(); }
+FileExplorer::FileExplorer(const std::string& metadatabase_path) {
+    fs.mount();
+    index();  // 安装命名空间变更回调, 此后对闪存的任何修改都会同步到目录索引
+}
 
 /**
  * @brief 析构函数
@@ -78,55 +82,75 @@ bool FileExplorer::exists(const std::string& path) { return fs.exists(path); }
  * @param targetPath 目标文件或目录的路径。
  */
 void FileExplorer::copyPath(const std::string& sourcePath, const std::string& targetPath) {
+    writeCache().flush(sourcePath);  // 先写回源路径下的缓冲数据
+
     // 判断是文件还是目录
-    if (fs.isDirectory(sourcePath)) {
-        dir.copyDir(sourcePath, targetPath);  // 复制目录
+    if (isDirectory(sourcePath)) {
+        if (!dir.copyDir(sourcePath, targetPath)) return;  // 复制目录
     } else {
-        file.copyFile(sourcePath, targetPath);  // 复制文件
+        if (!file.copyFile(sourcePath, targetPath)) return;  // 复制文件
     }
     // meta.copyMetadata(sourcePath, targetPath);  // 复制元数据
 }
 
 /**
  * @brief 移动指定路径的文件或目录到目标路径。
+ *
+ * 优先使用文件系统的原地重命名，不复制任何数据；仅当重命名失败时才退化为分块复制后删除源路径。
  * @param sourcePath 源文件或目录的路径。
- * @param targetPath 目标文件或目录的路径。
+ * @param targetPath 目标文件或目录的路径，必须不存在。
+ * @param measure 是否统计移动的文件数与字节数(需要打开源路径下的每个文件)。
+ * @return 移动结果统计。
  */
-void FileExplorer::movePath(const std::string& sourcePath, const std::string& targetPath) {
-    // 判断是文件还是目录
-    if (fs.isDirectory(sourcePath)) {
-        if (!dir.copyDir(sourcePath, targetPath)) return;  // 复制目录
-    } else {
-        if (!file.copyFile(sourcePath, targetPath)) return;  // 复制文件
-    }
+FileExplorer::MoveStats FileExplorer::movePath(const std::string& sourcePath, const std::string& targetPath, bool measure) {
     // meta.moveMetadata(sourcePath, targetPath);  // 移动元数据
-    fs.deletePath(sourcePath);  // 删除源文件;
+    return relocate(sourcePath, targetPath, measure);
 }
 
 /**
  * @brief 重命名指定路径的文件或目录。
  * @param path 要重命名的文件或目录路径。
  * @param newName 新名称。
+ * @param measure 是否统计移动的文件数与字节数。
+ * @return 重命名结果统计。
  */
-void FileExplorer::renamePath(const std::string& path, const std::string& newName) {
+FileExplorer::MoveStats FileExplorer::renamePath(const std::string& path, const std::string& newName, bool measure) {
     // 构建目标路径：将原路径的目录部分与新的名称拼接
     std::string target_path = file.getDirectoryPath(path) + "/" + newName;
+    return relocate(path, target_path, measure);
+}
 
-    // 判断是文件还是目录
-    if (fs.isDirectory(path)) {
-        if (!dir.copyDir(path, target_path)) return;  // 复制目录
-    } else {
-        if (!file.copyFile(path, target_path)) return;  // 复制文件
+/**
+ * @brief 用源文件替换目标文件(目标文件不存在时相当于移动)。
+ * 通过一次重命名完成, 文件系统保证替换是原子的: 掉电时目标路径上要么是旧文件, 要么是完整的新文件。
+ * 用于"先写临时文件, 再替换正式文件"的安全覆写。
+ * @param sourcePath 源文件的路径(通常是写好的临时文件)。
+ * @param targetPath 被替换的目标文件路径。
+ * @return 如果替换成功，返回 true；否则返回 false。
+ */
+bool FileExplorer::replaceFile(const std::string& sourcePath, const std::string& targetPath) {
+    if (!fs.exists(sourcePath)) {
+        WARN(WarningLevel::ERROR, "源路径不存在: %s", sourcePath.c_str());
+        return false;
+    }
+    if (isDirectory(sourcePath) || (fs.exists(targetPath) && isDirectory(targetPath))) {
+        WARN(WarningLevel::ERROR, "只能替换文件: %s -> %s", sourcePath.c_str(), targetPath.c_str());
+        return false;
     }
 
-    fs.deletePath(path);  // 删除源文件;
+    writeCache().flush(sourcePath);    // 先写回源文件的缓冲数据
+    writeCache().discard(targetPath);  // 目标文件的缓冲数据随旧文件一起作废
+    return fs.rename(sourcePath, targetPath);
 }
 
 /**
  * @brief 删除指定路径的文件或目录。
  * @param path 要删除的文件或目录路径。
  */
-void FileExplorer::deletePath(const std::string& path) { fs.deletePath(path); }
+void FileExplorer::deletePath(const std::string& path) {
+    writeCache().discard(path);  // 丢弃即将被删除的文件的缓冲数据
+    fs.deletePath(path);
+}
 
 /**
  * @brief 以字符串形式读取文件内容。
@@ -134,6 +158,7 @@ void FileExplorer::deletePath(const std::string& path) { fs.deletePath(path); }
  * @return 文件内容的字符串表示。
  */
 std::string FileExplorer::readFileAsString(const std::string& filePath) {
+    writeCache().flush(filePath);  // 先写回缓冲数据, 保证读到完整内容
     std::string fileData = "";
     file.readFileAsString(filePath, fileData);
     return fileData;
@@ -145,6 +170,7 @@ std::string FileExplorer::readFileAsString(const std::string& filePath) {
  * @return 文件内容的字节数组表示。
  */
 std::vector<uint8_t> FileExplorer::readFileAsBytes(const std::string& filePath) {
+    writeCache().flush(filePath);  // 先写回缓冲数据, 保证读到完整内容
     std::vector<uint8_t> fileData = {};
     file.readFileAsBytes(filePath, fileData);
     return fileData;
@@ -158,6 +184,7 @@ std::vector<uint8_t> FileExplorer::readFileAsBytes(const std::string& filePath)
  * @return 如果写入成功，返回 true；否则返回 false。
  */
 bool FileExplorer::writeFileAsString(const std::string& filePath, const std::string& data, const char* mode) {
+    if (useWriteCache(filePath, mode)) return writeCache().append(filePath, data);
     return file.writeFileAsString(filePath, data, mode);
 }
 
@@ -169,9 +196,39 @@ bool FileExplorer::writeFileAsString(const std::string& filePath, const std::str
  * @return 如果写入成功，返回 true；否则返回 false。
  */
 bool FileExplorer::writeFileAsBytes(const std::string& filePath, const std::vector<uint8_t>& data, const char* mode) {
+    if (useWriteCache(filePath, mode)) return writeCache().append(filePath, data.data(), data.size());
     return file.writeFileAsBytes(filePath, data, mode);
 }
 
+/**
+ * @brief 分块读取文件内容, 内存占用与文件大小无关。
+ * @param filePath 文件的路径。
+ * @param onChunk 分块读取回调，返回 false 时提前结束读取。
+ * @return 如果读取成功，返回 true；否则返回 false。
+ */
+bool FileExplorer::readFileChunks(const std::string& filePath, const FileManager::ChunkReader& onChunk) {
+    writeCache().flush(filePath);  // 先写回缓冲数据, 保证读到完整内容
+    return file.readFileChunks(filePath, onChunk);
+}
+
+/**
+ * @brief 分块写入数据到文件, 内存占用与数据总量无关。
+ * @param filePath 文件的路径。
+ * @param produce 分块写入回调，返回本次填充的字节数，返回 0 表示数据已写完。
+ * @param mode 写入模式，默认以追加模式写入。
+ * @param expectedSize 预计写入的总字节数(未知时为 0)，用于选择缓冲区大小。
+ * @return 如果写入成功，返回 true；否则返回 false。
+ */
+bool FileExplorer::writeFileChunks(const std::string& filePath, const FileManager::ChunkWriter& produce, const char* mode, size_t expectedSize) {
+    // 追加时先写回缓冲数据以保持写入顺序, 覆写时缓冲数据已无意义
+    if (std::string(mode) == "a") {
+        writeCache().flush(filePath);
+    } else {
+        writeCache().discard(filePath);
+    }
+    return file.writeFileChunks(filePath, produce, mode, expectedSize);
+}
+
 /**
  * @brief 精确查找指定名称的文件或目录。
  *
@@ -187,7 +244,7 @@ std::vector<std::string> FileExplorer::findPath(const std::string& targetName, c
     auto file_tree = getTree(parentPath);  // 获取指定路径下的文件树
 
     // 查找所有匹配目标名称的节点
-    std::vector<TreeNode<std::string>*> found_target_nodes = file_tree->findNode(targetName);
+    std::vector<FileTreeNode*> found_target_nodes = file_tree->findNode(targetName);
 
     std::vector<std::string> found_paths;            // 存储找到的路径列表
     found_paths.reserve(found_target_nodes.size());  // 提前为路径分配内存，提升性能
@@ -221,16 +278,16 @@ std::vector<std::string> FileExplorer::searchPath(const std::string& targetName,
     if (!fileTree) return {};
 
     // 用于存储符合条件的节点及其相似度
-    std::vector<std::pair<TreeNode<std::string>*, float>> matchingNodes;
+    std::vector<std::pair<FileTreeNode*, float>> matchingNodes;
 
     // 遍历文件树，计算每个节点名称与目标名称的相似度
-    for (const auto& nodeData : fileTree->traversalDFS()) {
-        sim.replaceString(targetName, nodeData.first);      // 设置比较的字符串
+    for (auto& node : fileTree->preOrder()) {
+        sim.replaceString(targetName, node.node_data);      // 设置比较的字符串
         float similarity = sim.evaluateStringSimilarity();  // 计算相似度
 
         // 如果相似度超过阈值，将节点加入匹配列表
         if (similarity >= similarityThreshold) {
-            matchingNodes.emplace_back(nodeData.second, similarity);
+            matchingNodes.emplace_back(&node, similarity);
         }
     }
 
@@ -238,8 +295,8 @@ std::vector<std::string> FileExplorer::searchPath(const std::string& targetName,
     if (matchingNodes.empty()) return {};
 
     // 按相似度从高到低排序
-    std::sort(matchingNodes.begin(), matchingNodes.end(),
-              [](const std::pair<TreeNode<std::string>*, float>& a, const std::pair<TreeNode<std::string>*, float>& b) { return a.second > b.second; });
+    std::stable_sort(matchingNodes.begin(), matchingNodes.end(),
+                     [](const std::pair<FileTreeNode*, float>& a, const std::pair<FileTreeNode*, float>& b) { return a.second > b.second; });
 
     std::vector<std::string> resultPaths;       // 准备返回结果的路径列表
     resultPaths.reserve(matchingNodes.size());  // 预分配内存以提高性能
@@ -277,34 +334,19 @@ void FileExplorer::printDir(const std::string& dirPath) {
 /**
  * @brief 获取指定目录路径下的目录树结构
  *
- * 该函数通过递归遍历指定路径下的文件和子目录，构建并返回一个目录树。
- * 通过调用 `dir.listDir` 获取目录内容，并使用 `TreeNode` 类来表示每一个目录项。
+ * 该函数从内存中的目录索引展开指定路径下的文件和子目录，构建并返回一个目录树。
+ * 目录索引在首次使用时建立，之后由各修改操作增量维护，因此构建过程不访问闪存。
  *
  * @param dirPath 需要构建目录树的根路径，默认为根目录 "/"
- * @return std::unique_ptr<Tree<std::string>> 返回构建好的目录树
+ * @return std::unique_ptr<FileTree> 返回构建好的目录树
  */
-std::unique_ptr<Tree<std::string>> FileExplorer::getTree(const std::string& dirPath) {
+std::unique_ptr<FileExplorer::FileTree> FileExplorer::getTree(const std::string& dirPath) {
     // 创建一个空的目录树对象，根节点为指定的目录路径
-    auto file_tree = make_unique<Tree<std::string>>(dirPath);
-
-    // 获取指定目录下的所有文件和子目录
-    std::vector<std::string> root_dir_names = dir.listDir(dirPath);
-
-    // 遍历目录下的每个文件和子目录
-    for (const auto& name : root_dir_names) {
-        // 获取当前项的完整路径
-        std::string full_path = dirPath;
-        if (dirPath.back() != '/') full_path += "/";  // 如果目录路径最后没有斜杠，添加斜杠
-        full_path += name;
-
-        // 在目录树中添加该目录作为根节点的子节点
-        TreeNode<std::string>* parent_ptr = file_tree->root->addChild(name);
+    auto file_tree = ::make_unique<FileTree>(dirPath);
 
-        // 如果是目录，递归构建子目录树
-        if (fs.isDirectory(full_path)) {
-            buildSubTree(full_path, *parent_ptr);  // 传递父节点指针
-        }
-    }
+    // 从目录索引展开指定目录下的所有文件和子目录
+    index().ensureLoaded();
+    index().buildTree(dirPath, *file_tree->root);
 
     // 返回构建好的目录树
     return file_tree;
@@ -317,31 +359,155 @@ void FileExplorer::printTree(const std::string& dirPath) {
 }
 
 /**
- * @brief 递归构建子目录树
+ * @brief 重新扫描闪存并重建目录索引
+ *
+ * 目录索引通过 `FSInterface::onChange()` 跟踪所有修改; 仅当闪存在回调安装之前被修改(例如另一个固件写入的数据)时，
+ * 才需要调用该函数使目录索引重新与闪存保持一致。
+ */
+void FileExplorer::rebuildIndex() { index().rebuild(); }
+
+/**
+ * @brief 获取所有 FileExplorer 实例共享的目录索引
+ *
+ * 索引按需建立：首次调用 `ensureLoaded` 时从持久化文件恢复或扫描闪存。
+ * 首次调用时安装 `FSInterface::onChange()` 回调，之后任何组件对闪存命名空间的修改都会同步到索引。
+ * 索引对象有意不析构, 原因同 `writeCache()`: 程序退出时卸载文件系统写回缓存仍可能触发回调。
+ */
+DirectoryIndex& FileExplorer::index() {
+    static DirectoryIndex* shared_index = [] {
+        FSInterface::onChange() = [](FSInterface::Change change, const std::string& path, const std::string& target) { index().apply(change, path, target); };
+        return new DirectoryIndex();
+    }();
+    return *shared_index;
+}
+
+/**
+ * @brief 获取所有 FileExplorer 共享的追加写回缓存
  *
- * 该函数递归遍历指定路径下的文件和子目录，并构建目录树。
- * 每遇到一个子目录，都会进一步递归构建其子目录树。
+ * 缓存默认关闭, 启用后 `writeFileAsString`/`writeFileAsBytes` 的追加写入会先进入缓存合并, 文件系统卸载前自动写回。
+ * 缓存对象有意不析构: 全局 FileExplorer 在程序退出时析构并卸载文件系统, 此时缓存必须仍然可用。
+ * @note 用法: FileExplorer::writeCache().setConfig({true, 4096, 16384, 2000});
+ */
+WriteBehindCache& FileExplorer::writeCache() {
+    static WriteBehindCache* shared_cache = [] {
+        FSInterface::beforeUnmount() = [] { writeCache().flush(); };
+        return new WriteBehindCache();
+    }();
+    return *shared_cache;
+}
+
+/**
+ * @brief 判断写入是否应交给写回缓存
  *
- * @param dirPath 当前目录的路径
- * @param parent_ptr 当前目录的父节点
+ * 只有启用缓存且目标文件已存在时的追加写入才进入缓存(首次写入直接创建文件, 使存在性检查与目录索引保持一致);
+ * 覆写时丢弃该文件旧的缓冲数据。已有缓冲数据的文件必然存在(删除、覆写前都会丢弃缓冲), 此时跳过闪存存在性查询,
+ * 因此连续追加只在每次写回后的第一笔数据上访问一次闪存元数据。
+ * @param filePath 文件路径
+ * @param mode 写入模式
+ * @return 应交给缓存返回 true; 需要直接写入闪存返回 false
+ */
+bool FileExplorer::useWriteCache(const std::string& filePath, const char* mode) {
+    WriteBehindCache& cache = writeCache();
+    if (std::string(mode) != "a") {
+        cache.discard(filePath);
+        return false;
+    }
+    if (!cache.enabled()) return false;
+    return cache.pending(filePath) || fs.exists(filePath);
+}
+
+/**
+ * @brief 判断路径是否为目录(优先查询目录索引)
+ * @param path 文件或目录路径
+ * @return 是目录返回 true
+ */
+bool FileExplorer::isDirectory(const std::string& path) {
+    index().ensureLoaded();
+    if (index().exists(path)) return index().isDirectory(path);
+    return fs.isDirectory(path);  // 索引中不存在时回退到闪存查询
+}
+
+/**
+ * @brief 移动/重命名的公共实现: 先尝试原地重命名, 失败时退化为复制后删除。
+ * @param sourcePath 源文件或目录的路径。
+ * @param targetPath 目标文件或目录的路径。
+ * @param measure 是否统计移动的文件数与字节数。
+ * @return 移动结果统计。
+ */
+FileExplorer::MoveStats FileExplorer::relocate(const std::string& sourcePath, const std::string& targetPath, bool measure) {
+    MoveStats stats;
+    const auto start = std::chrono::steady_clock::now();
+    auto elapsed = [&]() { return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count()); };
+
+    if (!fs.exists(sourcePath)) {
+        WARN(WarningLevel::ERROR, "源路径不存在: %s", sourcePath.c_str());
+        return stats;
+    }
+    if (fs.exists(targetPath)) {
+        WARN(WarningLevel::ERROR, "目标路径已存在: %s", targetPath.c_str());
+        return stats;
+    }
+
+    const bool is_dir = isDirectory(sourcePath);
+    if (is_dir && targetPath.compare(0, sourcePath.size() + 1, sourcePath + "/") == 0) {
+        WARN(WarningLevel::ERROR, "目标路径位于源目录之内，无法移动: %s -> %s", sourcePath.c_str(), targetPath.c_str());
+        return stats;
+    }
+
+    writeCache().flush(sourcePath);  // 先写回源路径下的缓冲数据
+    if (measure) measurePath(sourcePath, is_dir, stats.files, stats.bytes);
+
+    // 确保目标路径的父目录存在(重命名不会自动创建中间目录)
+    std::string parent_path = file.getDirectoryPath(targetPath);
+    if (!parent_path.empty() && !fs.exists(parent_path) && !createDir(parent_path)) {
+        stats.elapsedMs = elapsed();
+        return stats;
+    }
+
+    if (fs.rename(sourcePath, targetPath)) {
+        stats.native = true;  // 只改写了目录项, 数据块原地不动
+    } else {
+        // 重命名失败(例如后端不支持), 退化为分块复制后删除源路径
+        WARN(WarningLevel::WARNING, "无法原地移动，改为复制后删除: %s", sourcePath.c_str());
+        bool copied = is_dir ? dir.copyDir(sourcePath, targetPath) : file.copyFile(sourcePath, targetPath);
+        if (!copied) {
+            stats.elapsedMs = elapsed();
+            return stats;
+        }
+        fs.deletePath(sourcePath);
+    }
+
+    stats.success = true;
+    stats.elapsedMs = elapsed();
+    return stats;
+}
+
+/**
+ * @brief 统计路径下的文件数与总字节数。
+ * @param path 文件或目录的路径。
+ * @param isDir 路径是否为目录。
+ * @param files 输出文件数。
+ * @param bytes 输出总字节数。
  */
-void FileExplorer::buildSubTree(const std::string& dirPath, TreeNode<std::string>& parent_ptr) {
-    // 获取当前目录下的所有文件和子目录
-    std::vector<std::string> sub_dir_names = dir.listDir(dirPath);
-
-    // 遍历当前目录下的每个文件和子目录
-    for (const auto& name : sub_dir_names) {
-        // 获取当前项的完整路径
-        std::string full_path = dirPath;
-        if (dirPath.back() != '/') full_path += "/";  // 如果目录路径最后没有斜杠，添加斜杠
-        full_path += name;
-
-        // 查找父节点，并将当前子目录作为其子节点添加
-        TreeNode<std::string>* ptr = parent_ptr.addChild(name);
-
-        // 如果该项是目录，则递归构建该子目录的树形结构
-        if (fs.isDirectory(full_path)) {
-            buildSubTree(full_path, *ptr);  // 递归处理该子目录
+void FileExplorer::measurePath(const std::string& path, bool isDir, size_t& files, size_t& bytes) {
+    files = 0;
+    bytes = 0;
+
+    // 用显式栈遍历目录, 避免深层目录递归
+    std::vector<std::pair<std::string, bool>> pending = {{path, isDir}};
+    while (!pending.empty()) {
+        std::pair<std::string, bool> item = std::move(pending.back());
+        pending.pop_back();
+
+        if (!item.second) {
+            if (!fs.open(item.first, "r")) continue;
+            bytes += fs.getSize();
+            fs.close();
+            ++files;
+            continue;
         }
+
+        if (!fs.openDir(item.first)) continue;
+        for (const auto& entry : fs.listEntries()) pending.emplace_back((item.first == "/" ? "/" : item.first + "/") + entry.first, entry.second);
     }
-}
\ No newline at end of file
+}
@@ -26,13 +26,31 @@
 // #include <metadata_manager.h>
 #include <string_similarity_evaluator.h>
 
+#include <directory_index.hpp>
 #include <directory_manager.hpp>
 #include <file_manager.hpp>
-#include <fs_interface.hpp>
+#include <fs_Interface.hpp>
 #include <tree.hpp>
 #include <tree_tool.hpp>
+#include <write_behind_cache.hpp>
 
 class FileExplorer {
+   public:
+    // 目录树: 节点从内存池分配, 减少每次构建目录树时的堆碎片.
+    // 目录树每次查找都重新构建且只查找一次, 不启用全局哈希索引(建索引的开销大于一次线性遍历), 同时保证 findPath 按先序返回结果.
+    using FileTreePolicy = TreePoolPolicy;
+    using FileTree = Tree<std::string, FileTreePolicy>;
+    using FileTreeNode = TreeNode<std::string, FileTreePolicy>;
+
+    // 移动/重命名的结果统计
+    struct MoveStats {
+        bool success = false;    // 是否成功
+        bool native = false;     // 是否由文件系统原地重命名完成(未复制任何数据)
+        size_t files = 0;        // 移动的文件数(仅在请求统计时计算)
+        size_t bytes = 0;        // 移动的数据量, 单位字节(仅在请求统计时计算)
+        uint32_t elapsedMs = 0;  // 耗时(毫秒)
+    };
+
    public:
     FileExplorer(const std::string& metadatabase_path = "/.os/metadatabase.db");
     ~FileExplorer();
@@ -42,14 +60,17 @@ class FileExplorer {
     bool exists(const std::string& path);
 
     void copyPath(const std::string& sourcePath, const std::string& targetPath);
-    void movePath(const std::string& sourcePath, const std::string& targetPath);
-    void renamePath(const std::string& path, const std::string& newName);
+    MoveStats movePath(const std::string& sourcePath, const std::string& targetPath, bool measure = false);
+    MoveStats renamePath(const std::string& path, const std::string& newName, bool measure = false);
+    bool replaceFile(const std::string& sourcePath, const std::string& targetPath);
     void deletePath(const std::string& path);
 
     std::string readFileAsString(const std::string& filePath);
     std::vector<uint8_t> readFileAsBytes(const std::string& filePath);
     bool writeFileAsString(const std::string& filePath, const std::string& data, const char* mode = "a");
     bool writeFileAsBytes(const std::string& filePath, const std::vector<uint8_t>& data, const char* mode = "a");
+    bool readFileChunks(const std::string& filePath, const FileManager::ChunkReader& onChunk);
+    bool writeFileChunks(const std::string& filePath, const FileManager::ChunkWriter& produce, const char* mode = "a", size_t expectedSize = 0);
 
     std::vector<std::string> findPath(const std::string& targetName, const std::string& parentPath = "/");
     std::vector<std::string> searchPath(const std::string& targetName, const std::string& parentPath = "/", float similarityThreshold = 0.0f);
@@ -57,11 +78,19 @@ class FileExplorer {
     std::vector<std::string> listDir(const std::string& dirPath = "/");
     void printDir(const std::string& dirPath = "/");
 
-    std::unique_ptr<Tree<std::string>> getTree(const std::string& dirPath = "/");
+    std::unique_ptr<FileTree> getTree(const std::string& dirPath = "/");
     void printTree(const std::string& dirPath = "/");
 
+    void rebuildIndex();
+
+    static WriteBehindCache& writeCache();
+
    private:
-    void buildSubTree(const std::string& dirPath, TreeNode<std::string>& parent_ptr);
+    static DirectoryIndex& index();
+    bool isDirectory(const std::string& path);
+    MoveStats relocate(const std::string& sourcePath, const std::string& targetPath, bool measure);
+    void measurePath(const std::string& path, bool isDir, size_t& files, size_t& bytes);
+    bool useWriteCache(const std::string& filePath, const char* mode);
 
    private:
     TreeTool tree_tool;
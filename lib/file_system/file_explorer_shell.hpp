@@ -26,6 +26,7 @@
 #include <file_explorer.h>
 #include <ring_buffer.h>
 
+#include <iostream>
 #include <serial_warning.hpp>
 #include <sstream>
 #include <string_edit.hpp>
@@ -40,6 +41,22 @@ class FileExplorerShell {
      */
     void mount(const std::vector<std::string>& flags, const std::vector<std::string>& parameters) { fs_.mount(); }
 
+    /**
+     * @brief 将写回缓存中的全部缓冲数据写入闪存
+     *
+     * @param flags 命令标志位（未使用）
+     * @param parameters 命令参数（未使用）
+     */
+    void sync(const std::vector<std::string>& flags, const std::vector<std::string>& parameters) { FileExplorer::writeCache().sync(); }
+
+    /**
+     * @brief 重新扫描闪存并重建目录索引(tree/find/search 使用的内存镜像)
+     *
+     * @param flags 命令标志位（未使用）
+     * @param parameters 命令参数（未使用）
+     */
+    void reindex(const std::vector<std::string>& flags, const std::vector<std::string>& parameters) { file_.rebuildIndex(); }
+
     /**
      * @brief 切换当前工作目录
      *
@@ -286,9 +303,13 @@ class FileExplorerShell {
             (sourceCount == 1) && !isAbsolutePath(parameters[0]) && !isAbsolutePath(targetParam) && (!file_.exists(targetPath) || forceOverwrite);
 
         if (isSingleRename) {
+            // 重命名后的实际路径(源路径所在目录 + 新名称); 强制模式下先删除已存在的目标, 与下方移动逻辑一致
+            const std::string renamedPath = buildFullPath(targetParam, getParentPath(sourcePaths[0]));
+            if (forceOverwrite && renamedPath != sourcePaths[0] && file_.exists(renamedPath)) file_.deletePath(renamedPath);
+
             // 重命名文件或目录
-            file_.renamePath(sourcePaths[0], targetParam);
-            if (verbose) std::cout << "Renamed: " << sourcePaths[0] << " -> " << targetParam << "\n";
+            FileExplorer::MoveStats stats = file_.renamePath(sourcePaths[0], targetParam, verbose);
+            if (verbose && stats.success) std::cout << "Renamed: " << sourcePaths[0] << " -> " << targetParam << formatMoveStats(stats) << "\n";
 
             return;
         }
@@ -325,9 +346,9 @@ class FileExplorerShell {
             }
 
             // 执行移动操作
-            file_.movePath(sourcePath, fullTargetPath);
-            if (verbose) {
-                std::cout << "Moved: " << sourcePath << " -> " << fullTargetPath << "\n";
+            FileExplorer::MoveStats stats = file_.movePath(sourcePath, fullTargetPath, verbose);
+            if (verbose && stats.success) {
+                std::cout << "Moved: " << sourcePath << " -> " << fullTargetPath << formatMoveStats(stats) << "\n";
             }
         }
     }
@@ -430,7 +451,7 @@ class FileExplorerShell {
     }
 
     /**
-     * @brief 将指定文件的全部内容一次性输出到终端
+     * @brief 将指定文件的全部内容分块输出到终端
      *
      * @param flags      命令标志列表，本命令不使用任何标志
      * @param parameters 参数列表，唯一元素为要查看的文件路径或文件名称
@@ -455,13 +476,12 @@ class FileExplorerShell {
             return;  // 文件不存在，退出
         }
 
-        // ----- 4. 读取文件内容 -----
-        // 一次性将整个文件读入内存
-        std::string content = file_.readFileAsString(fullPath);
-
-        // ----- 5. 输出到终端 -----
-        // 将读取到的内容直接写入标准输出，不做额外处理
-        Serial.print(content.c_str());
+        // ----- 4. 分块读取并输出到终端 -----
+        // 每读到一块就直接写入串口，不做额外处理；内存占用与文件大小无关
+        file_.readFileChunks(fullPath, [](const uint8_t* data, size_t size) {
+            Serial.write(data, size);
+            return true;
+        });
     }
 
     /**
@@ -794,6 +814,19 @@ class FileExplorerShell {
         return path.substr(0, slashPos);
     }
 
+    /**
+     * @brief 将移动统计格式化为 mv -v 的附加信息
+     *
+     * @param stats movePath/renamePath 返回的统计
+     * @return 形如 " (3 files, 20480 bytes, renamed in place, 12 ms)" 的字符串
+     */
+    std::string formatMoveStats(const FileExplorer::MoveStats& stats) {
+        std::ostringstream out;
+        out << " (" << stats.files << " files, " << stats.bytes << " bytes, " << (stats.native ? "renamed in place" : "copied") << ", " << stats.elapsedMs
+            << " ms)";
+        return out.str();
+    }
+
     /**
      * @brief 判断路径是否为绝对路径
      * @param path 输入路径字符串
@@ -27,11 +27,20 @@
 #include <cctype>
 #include <dynamic_buffer_manager.hpp>
 #include <fs_Interface.hpp>
+#include <functional>
+#include <memory>
 #include <serial_warning.hpp>
 #include <string>
 #include <vector>
 
 class FileManager {
+   public:
+    // 分块读取回调: 参数为本块数据及其字节数, 返回 false 时提前结束读取
+    using ChunkReader = std::function<bool(const uint8_t* data, size_t size)>;
+
+    // 分块写入回调: 向缓冲区填充至多 capacity 字节并返回实际填充的字节数, 返回 0 表示数据已写完
+    using ChunkWriter = std::function<size_t(uint8_t* buffer, size_t capacity)>;
+
    public:
     /**
      * @brief 创建文件(不会自动创建目录)
@@ -118,18 +127,40 @@ class FileManager {
             return false;
         }
 
-        // 读取源文件内容为字节数组
-        std::vector<uint8_t> sourceData;
-        if (!readFileAsBytes(sourceFilePath, sourceData)) {
+        // 打开源文件, 目标文件由 fs 打开, 两者同时处于打开状态
+        FSInterface source;
+        if (!source.open(sourceFilePath, "r")) {
             WARN(WarningLevel::ERROR, "无法复制文件,读取源文件时出错: %s", sourceFilePath.c_str());
             return false;
         }
 
         // 若源文件内容为空,则不写入文件.
-        if (sourceData.empty()) return true;
+        size_t fileSize = source.getSize();
+        if (fileSize == 0) return source.close();
 
-        // 将字节数组写入目标文件
-        if (!writeFileAsBytes(targetFilePath, sourceData, "w")) {
+        if (!fs.open(targetFilePath, "w")) {
+            source.close();
+            WARN(WarningLevel::ERROR, "无法复制文件,写入目标文件时出错: %s", targetFilePath.c_str());
+            return false;
+        }
+
+        // 以固定大小的缓冲区逐块搬运数据, 内存占用只与缓冲区大小有关, 与文件大小无关
+        size_t bufferSize = DynamicBufferManager(fileSize).getBufferSize();
+        std::unique_ptr<uint8_t[]> buffer(new uint8_t[bufferSize]);
+
+        bool success = true;
+        size_t bytesRead = 0;
+        while ((bytesRead = source.read(buffer.get(), bufferSize)) > 0) {
+            if (fs.write(buffer.get(), bytesRead) != bytesRead) {
+                success = false;
+                break;
+            }
+        }
+
+        source.close();
+        fs.close();
+
+        if (!success) {
             WARN(WarningLevel::ERROR, "无法复制文件,写入目标文件时出错: %s", targetFilePath.c_str());
             return false;
         }
@@ -139,13 +170,22 @@ class FileManager {
 
     /**
      * @brief 移动文件
-     * 先将文件从源路径复制到目标路径，然后删除源文件。如果任何一步失败，整个操作都会失败。
+     * 优先原地重命名文件(不复制数据); 重命名失败时先将文件从源路径复制到目标路径，然后删除源文件。如果任何一步失败，整个操作都会失败。
      * @param sourceFilePath 源文件路径
      * @param targetFilePath 目标文件路径
      * @return 返回是否移动成功，成功返回 true，失败返回 false。
      */
     bool moveFile(const std::string& sourceFilePath, const std::string& targetFilePath) {
-        // 先复制文件到目标路径
+        // 检查目标文件是否已存在
+        if (fs.exists(targetFilePath)) {
+            WARN(WarningLevel::ERROR, "无法移动文件,目标文件已存在: %s", targetFilePath.c_str());
+            return false;
+        }
+
+        // 原地重命名只改写目录项
+        if (fs.exists(sourceFilePath) && fs.rename(sourceFilePath, targetFilePath)) return true;
+
+        // 重命名失败时复制文件到目标路径
         if (!copyFile(sourceFilePath, targetFilePath)) return false;
 
         // 删除源文件
@@ -225,6 +265,87 @@ class FileManager {
         return true;
     }
 
+    /**
+     * @brief 分块读取文件内容
+     * 以固定大小的缓冲区逐块读取文件，每读到一块就交给回调处理。内存占用只与缓冲区大小有关，与文件大小无关。
+     * @param filePath[in] 文件路径
+     * @param onChunk[in] 分块读取回调, 返回 false 时提前结束读取
+     * @param buffer[in] 调用者提供的缓冲区, 为空时按文件大小由 DynamicBufferManager 分配
+     * @param bufferSize[in] 调用者提供的缓冲区大小(字节)
+     * @return 成功读完(或被回调提前结束)返回 true, 文件不存在或打开失败返回 false
+     * @note 用法: file.readFileChunks("/log.csv", [](const uint8_t* data, size_t size) { Serial.write(data, size); return true; });
+     */
+    bool readFileChunks(const std::string& filePath, const ChunkReader& onChunk, uint8_t* buffer = nullptr, size_t bufferSize = 0) {
+        // 检查文件是否存在
+        if (!fs.exists(filePath)) {
+            WARN(WarningLevel::ERROR, "文件不存在: %s", filePath.c_str());
+            return false;  // 文件不存在
+        }
+
+        // 尝试打开文件
+        if (!fs.open(filePath, "r")) return false;
+
+        // 未提供缓冲区时根据文件大小分配
+        std::unique_ptr<uint8_t[]> ownedBuffer;
+        if (buffer == nullptr || bufferSize == 0) {
+            bufferSize = DynamicBufferManager(fs.getSize()).getBufferSize();
+            ownedBuffer.reset(new uint8_t[bufferSize]);
+            buffer = ownedBuffer.get();
+        }
+
+        size_t bytesRead = 0;
+        // 持续读取文件内容，直到文件结束或回调要求停止
+        while ((bytesRead = fs.read(buffer, bufferSize)) > 0) {
+            if (!onChunk(buffer, bytesRead)) break;
+        }
+
+        fs.close();  // 关闭文件
+        return true;
+    }
+
+    /**
+     * @brief 分块写入文件内容
+     * 反复调用回调向固定大小的缓冲区填充数据并写入文件，直到回调返回 0。
+     * @param filePath[in] 文件路径
+     * @param produce[in] 分块写入回调, 返回本次填充的字节数, 返回 0 表示数据已写完
+     * @param mode[in] 文件打开模式(w:覆写, a:追加), 默认为覆写
+     * @param expectedSize[in] 预计写入的总字节数(未知时为 0), 未提供缓冲区时据此由 DynamicBufferManager 选择缓冲区大小
+     * @param buffer[in] 调用者提供的缓冲区, 为空时自行分配
+     * @param bufferSize[in] 调用者提供的缓冲区大小(字节)
+     * @return 全部写入成功返回 true, 否则返回 false
+     */
+    bool writeFileChunks(const std::string& filePath, const ChunkWriter& produce, const char* mode = "w", size_t expectedSize = 0, uint8_t* buffer = nullptr,
+                         size_t bufferSize = 0) {
+        // 验证文件打开模式是否合法
+        if (std::string(mode) != "w" && std::string(mode) != "a") {
+            WARN(WarningLevel::ERROR, "文件打开模式非法,仅支持(w:覆写,a:追加): %s", mode);
+            return false;  // 返回 false 表示非法模式
+        }
+
+        // 尝试打开文件进行写入
+        if (!fs.open(filePath, mode)) return false;  // 打开文件失败
+
+        // 未提供缓冲区时根据预计写入的大小分配
+        std::unique_ptr<uint8_t[]> ownedBuffer;
+        if (buffer == nullptr || bufferSize == 0) {
+            bufferSize = DynamicBufferManager(expectedSize).getBufferSize();
+            ownedBuffer.reset(new uint8_t[bufferSize]);
+            buffer = ownedBuffer.get();
+        }
+
+        bool success = true;
+        size_t bytesFilled = 0;
+        while ((bytesFilled = produce(buffer, bufferSize)) > 0) {
+            if (fs.write(buffer, bytesFilled) != bytesFilled) {
+                success = false;
+                break;
+            }
+        }
+
+        fs.close();  // 关闭文件
+        return success;
+    }
+
     /**
      * @brief 向文件写入字符串数据
      * 该函数将字符串数据写入指定的文件。如果文件不存在，默认会创建文件；如果文件存在，按指定的模式写入。
@@ -22,14 +22,27 @@
  * Electronic Mail : asdfghjkl851@outlook.com
  */
 #pragma once
-#include <Arduino.h>
-#include <LittleFS.h>
-
+#include <cstdint>
 #include <cstring>
+#include <host_serial.hpp>
 #include <serial_warning.hpp>
 #include <string>
 #include <vector>
 
+/*
+ * 存储后端在编译期选择:
+ * - 定义 GSOS_FS_BACKEND_POSIX, 或不在 Arduino 环境下编译时, 使用主机端 POSIX 后端(PosixFSBackend);
+ * - 否则使用开发板上的 LittleFS 后端(LittleFSBackend).
+ * 后端只需提供与 LittleFSBackend 相同的一组原语即可接入.
+ */
+#if defined(GSOS_FS_BACKEND_POSIX) || !defined(ARDUINO)
+#include <fs_backend_posix.hpp>
+using FSBackend = PosixFSBackend;
+#else
+#include <fs_backend_littlefs.hpp>
+using FSBackend = LittleFSBackend;
+#endif
+
 /**
  * @brief 文件系统抽象接口层
  *
@@ -39,25 +52,59 @@
 class FSInterface {
    public:
     /**
-     * @brief 挂载LittleFS文件系统
-     * 该函数负责初始化并挂载LittleFS文件系统。若挂载失败，将打印错误信息。
+     * @brief 挂载文件系统
+     * 该函数负责初始化并挂载存储后端。若挂载失败，将打印错误信息。
      * @return true 挂载成功
      * @return false 挂载失败
      */
     bool mount() {
-        if (!LittleFS.begin()) {
-            WARN(WarningLevel::ERROR, "LittleFS文件系统挂载失败");
+        if (!backend.begin()) {
+            WARN(WarningLevel::ERROR, "文件系统挂载失败");
             return false;
         }
         return true;
     }
 
     /**
-     * @brief 卸载LittleFS文件系统
+     * @brief 卸载文件系统
      *
-     * 该函数负责卸载文件系统，释放相应的资源。
+     * 该函数负责卸载文件系统，释放相应的资源。卸载前会先调用 `beforeUnmount()` 回调(如写回缓存刷新缓冲数据)。
      */
-    void unmount() { LittleFS.end(); }
+    void unmount() {
+        if (beforeUnmount()) beforeUnmount()();
+        backend.end();
+    }
+
+    /**
+     * @brief 卸载前回调(所有实例共享)
+     * 使用函数指针而非 std::function, 保证程序退出时静态对象析构后仍可安全调用。
+     * @note 用法: FSInterface::beforeUnmount() = [] { cache.flush(); };
+     */
+    using UnmountHook = void (*)();
+    static UnmountHook& beforeUnmount() {
+        static UnmountHook hook = nullptr;
+        return hook;
+    }
+
+    // 命名空间变更类型
+    enum class Change : uint8_t {
+        CreateFile,  // 新建文件(path)
+        CreateDir,   // 新建目录(path)
+        Remove,      // 删除文件或目录及其子树(path); 格式化时 path 为 "/"
+        Rename,      // 重命名或移动(path -> target)
+    };
+
+    /**
+     * @brief 命名空间变更回调(所有实例共享)
+     * 每次成功创建、删除、重命名文件或目录后调用, 不论调用方是 FileExplorer、FileManager、DirectoryManager 还是直接使用 FSInterface,
+     * 使目录索引等内存镜像与闪存保持一致。使用函数指针的原因同 beforeUnmount()。
+     * @note 用法: FSInterface::onChange() = [](FSInterface::Change change, const std::string& path, const std::string& target) { ... };
+     */
+    using ChangeHook = void (*)(Change change, const std::string& path, const std::string& target);
+    static ChangeHook& onChange() {
+        static ChangeHook hook = nullptr;
+        return hook;
+    }
 
    public:
     /**
@@ -73,12 +120,14 @@ class FSInterface {
      * @return false 打开失败
      */
     bool open(const std::string& path, const char* mode) {
-        work_file = LittleFS.open(path.c_str(), mode);
-        if (!work_file || work_dir.isDirectory()) {
+        // 只有写入模式可能新建文件; 仅在安装了变更回调时才需要检查文件原先是否存在
+        const bool may_create = onChange() && (mode[0] == 'w' || mode[0] == 'a') && !backend.exists(path);
+        if (!backend.openFile(path, mode) || backend.fileIsDirectory()) {
             WARN(WarningLevel::ERROR, "打开文件失败: %s", path.c_str());
-            work_file.close();
+            backend.closeFile();
             return false;
         }
+        if (may_create) notify(Change::CreateFile, path);
         return true;
     }
 
@@ -89,10 +138,9 @@ class FSInterface {
      * @return false 打开失败
      */
     bool openDir(const std::string& path) {
-        work_dir = LittleFS.open(path.c_str());
-        if (!work_dir || !work_dir.isDirectory()) {
+        if (!backend.openDir(path) || !backend.dirIsDirectory()) {
             WARN(WarningLevel::ERROR, "打开目录失败: %s", path.c_str());
-            work_dir.close();
+            backend.closeDir();
             return false;
         }
         return true;
@@ -104,9 +152,9 @@ class FSInterface {
      * @return false 关闭失败
      */
     bool close() {
-        work_file.close();
-        if (work_file) WARN(WarningLevel::ERROR, "文件关闭失败: %s", work_file.name());
-        return !work_file;
+        backend.closeFile();
+        if (backend.fileIsOpen()) WARN(WarningLevel::ERROR, "文件关闭失败: %s", backend.fileName().c_str());
+        return !backend.fileIsOpen();
     }
 
     /**
@@ -117,7 +165,7 @@ class FSInterface {
      */
     size_t read(void* buffer, size_t size) {
         uint8_t* buf = static_cast<uint8_t*>(buffer);
-        return work_file.read(buf, size);
+        return backend.read(buf, size);
     }
 
     /**
@@ -126,14 +174,14 @@ class FSInterface {
      * @param size 要写入的数据量，单位是字节。
      * @return 实际写入的字节数。
      */
-    size_t write(const void* buffer, size_t size) { return work_file.write(reinterpret_cast<const uint8_t*>(buffer), size); }
+    size_t write(const void* buffer, size_t size) { return backend.write(reinterpret_cast<const uint8_t*>(buffer), size); }
 
     /**
      * @brief 获取文件大小(字节)
      * @return 文件大小，若文件不存在返回-1
      */
     size_t getSize() {
-        if (work_file) return work_file.size();
+        if (backend.fileIsOpen()) return backend.fileSize();
 
         return -1;  // 如果文件不存在，则返回-1
     }
@@ -144,11 +192,11 @@ class FSInterface {
      * @return 文件的最后修改时间,获取失败则返回0
      */
     uint32_t getLastWrite() {
-        if (!work_file) {
+        if (!backend.fileIsOpen()) {
             WARN(WarningLevel::ERROR, "没有打开文件");
             return 0;
         }
-        return work_file.getLastWrite();
+        return backend.lastWrite();
     }
 
     /**
@@ -156,11 +204,11 @@ class FSInterface {
      * @return 成功则返回文件名，失败则返回空字符串
      */
     std::string name() {
-        if (!work_file) {
+        if (!backend.fileIsOpen()) {
             WARN(WarningLevel::ERROR, "没有打开文件");
             return "";
         }
-        return work_file.name();
+        return backend.fileName();
     }
 
    public:
@@ -171,7 +219,8 @@ class FSInterface {
      * @return false 删除失败
      */
     bool remove(const std::string& path) {
-        if (LittleFS.remove(path.c_str())) {
+        if (backend.remove(path)) {
+            notify(Change::Remove, path);
             return true;
         } else {
             WARN(WarningLevel::ERROR, "删除失败: %s", path.c_str());
@@ -187,7 +236,8 @@ class FSInterface {
      * @return false 失败
      */
     bool rename(const std::string& old_path, const std::string& new_path) {
-        if (LittleFS.rename(old_path.c_str(), new_path.c_str())) {
+        if (backend.rename(old_path, new_path)) {
+            notify(Change::Rename, old_path, new_path);
             return true;
         } else {
             WARN(WarningLevel::ERROR, "重命名或移动失败: %s", old_path.c_str());
@@ -202,7 +252,8 @@ class FSInterface {
      * @return false 失败
      */
     bool mkdir(const std::string& path) {
-        if (LittleFS.mkdir(path.c_str())) {
+        if (backend.mkdir(path)) {
+            notify(Change::CreateDir, path);
             return true;
         } else {
             WARN(WarningLevel::ERROR, "目录创建失败: %s", path.c_str());
@@ -217,7 +268,8 @@ class FSInterface {
      * @return false 失败
      */
     bool rmdir(const std::string& path) {
-        if (LittleFS.rmdir(path.c_str())) {
+        if (backend.rmdir(path)) {
+            notify(Change::Remove, path);
             return true;
         } else {
             WARN(WarningLevel::ERROR, "目录删除失败: %s", path.c_str());
@@ -235,18 +287,12 @@ class FSInterface {
      */
     bool deletePath(const std::string& path) {
         // 检查路径是否存在
-        if (LittleFS.exists(path.c_str())) {
-            File file = LittleFS.open(path.c_str());
-
+        if (backend.exists(path)) {
             // 如果是目录，递归删除目录及其内容
-            if (file.isDirectory()) {
-                file.close();                     ///< 关闭文件
-                return deleteDirRecursive(path);  ///< 递归删除目录
-            } else {
-                // 如果是文件，直接删除文件
-                file.close();                          ///< 关闭文件
-                return LittleFS.remove(path.c_str());  ///< 删除文件
-            }
+            // 目录递归删除, 文件直接删除; 整棵子树只通知一次
+            const bool deleted = backend.isDirectory(path) ? deleteDirRecursive(path) : backend.remove(path);
+            if (deleted) notify(Change::Remove, path);
+            return deleted;
         }
 
         WARN(WarningLevel::ERROR, "路径不存在: %s", path.c_str());
@@ -265,15 +311,11 @@ class FSInterface {
      */
     bool isDirectory(const std::string& path = "") {
         if (path == "") {
-            return work_file.isDirectory();  ///< 如果未指定路径，判断当前工作文件是否为目录
+            return backend.fileIsDirectory();  ///< 如果未指定路径，判断当前工作文件是否为目录
         }
 
         ///< 如果指定路径，判断该路径是否为目录
-        File file = LittleFS.open(path.c_str());
-        bool result = file.isDirectory();
-        file.close();
-
-        return result;
+        return backend.isDirectory(path);
     }
 
     /**
@@ -281,12 +323,8 @@ class FSInterface {
      * @return 当前文件或目录的名称，若没有更多文件，返回空字符串
      */
     std::string dirNextName() {
-        if (work_dir) {
-            File file = work_dir.openNextFile();
-            if (file) {
-                return std::string(file.name());
-            }
-        }
+        std::string name;
+        if (backend.nextEntry(name)) return name;
         return "";
     }
 
@@ -296,13 +334,24 @@ class FSInterface {
      */
     std::vector<std::string> listFiles() {
         std::vector<std::string> list;
-        if (work_dir) {
-            File file = work_dir.openNextFile();
-            while (file) {
-                list.push_back(file.name());
-                file = work_dir.openNextFile();
-            }
-        }
+        std::string name;
+        while (backend.nextEntry(name)) list.push_back(name);
+        return list;
+    }
+
+    /**
+     * @brief 获取当前打开目录下的所有条目及其类型
+     *
+     * 与 `listFiles` 不同，该函数在遍历目录的同时取得每个条目是否为目录，
+     * 调用方无需再对每个条目调用 `isDirectory(path)` 重新打开文件。
+     *
+     * @return 条目列表, 每项为 (名称, 是否为目录)
+     */
+    std::vector<std::pair<std::string, bool>> listEntries() {
+        std::vector<std::pair<std::string, bool>> list;
+        std::string name;
+        bool is_dir = false;
+        while (backend.nextEntry(name, &is_dir)) list.emplace_back(name, is_dir);
         return list;
     }
 
@@ -310,7 +359,7 @@ class FSInterface {
      * @brief 重置目录遍历指针
      * 该函数将当前目录指针重置到目录的开头。
      */
-    void rewindDirectory() { work_dir.rewindDirectory(); }
+    void rewindDirectory() { backend.rewindDir(); }
 
     /**
      * @brief 检查指定路径的文件或目录是否存在
@@ -318,25 +367,25 @@ class FSInterface {
      * @return true 存在
      * @return false 不存在
      */
-    bool exists(const std::string& path) { return LittleFS.exists(path.c_str()); }
+    bool exists(const std::string& path) { return backend.exists(path); }
 
     /**
      * @brief 检查当前打开的文件中是否还有数据可读取
      * @return 返回从当前读取位置到文件末尾之间剩余的字节数; 为 0 时表示文件已读到末尾，没有更多数据可读取。
      */
-    int available() { return work_file.available(); }
+    int available() { return backend.available(); }
 
     /**
      * @brief 获取文件系统的总空间
      * @return 文件系统的总空间(字节)
      */
-    size_t totalSpace() { return LittleFS.totalBytes(); }
+    size_t totalSpace() { return backend.totalBytes(); }
 
     /**
      * @brief 获取文件系统的已用空间
      * @return 文件系统的已用空间(字节)
      */
-    size_t usedSpace() { return LittleFS.usedBytes(); }
+    size_t usedSpace() { return backend.usedBytes(); }
 
     /**
      * @brief 格式化文件系统。
@@ -345,7 +394,8 @@ class FSInterface {
      * @return false 格式化失败
      */
     bool format() {
-        if (LittleFS.format()) {
+        if (backend.format()) {
+            notify(Change::Remove, "/");
             return true;
         } else {
             WARN(WarningLevel::ERROR, "无法格式化文件系统");
@@ -356,9 +406,14 @@ class FSInterface {
     /**
      * @brief 强制将缓存中的数据写入文件
      */
-    void sync() { work_file.flush(); }
+    void sync() { backend.flush(); }
 
    private:
+    // 调用命名空间变更回调
+    static void notify(Change change, const std::string& path, const std::string& target = std::string()) {
+        if (onChange()) onChange()(change, path, target);
+    }
+
     /**
      * @brief 递归删除指定目录及其内容
      *
@@ -368,42 +423,40 @@ class FSInterface {
      * @return 如果删除成功返回true，失败时返回false
      */
     bool deleteDirRecursive(const std::string& dirPath) {
-        File dir = LittleFS.open(dirPath.c_str());  ///< 打开指定目录
-        if (!dir) {
+        FSBackend dir;  ///< 使用独立的后端句柄遍历目录，避免干扰当前工作目录
+        if (!dir.openDir(dirPath)) {
             WARN(WarningLevel::ERROR, "无法打开目录: %s", dirPath.c_str());
             return false;  ///< 目录打开失败，返回false
         }
 
-        // 遍历目录中的每一个文件或子目录
-        while (true) {
-            File entry = dir.openNextFile();  ///< 获取目录中的下一个文件或子目录
-            if (!entry) {
-                break;  ///< 如果没有更多条目，退出循环
-            }
+        // 先收集目录中的全部条目，再逐个删除，避免边遍历边删除导致跳项
+        std::vector<std::pair<std::string, bool>> entries;
+        std::string name;
+        bool is_dir = false;
+        while (dir.nextEntry(name, &is_dir)) entries.emplace_back(name, is_dir);
+        dir.closeDir();
 
-            std::string filePath = dirPath + "/" + entry.name();  ///< 获取文件或子目录的完整路径
+        // 遍历目录中的每一个文件或子目录
+        for (const auto& entry : entries) {
+            std::string filePath = dirPath + "/" + entry.first;  ///< 获取文件或子目录的完整路径
 
-            if (entry.isDirectory()) {
-                entry.close();  ///< 关闭文件
+            if (entry.second) {
                 // 如果是目录，递归删除该子目录
                 if (!deleteDirRecursive(filePath)) {  ///< 递归删除子目录
                     return false;                     ///< 删除失败，返回false
                 }
             } else {
-                entry.close();  ///< 关闭文件
                 // 如果是文件，直接删除
-                if (!LittleFS.remove(filePath.c_str())) {  ///< 删除文件
-                    return false;                          ///< 删除失败，返回false
+                if (!backend.remove(filePath)) {  ///< 删除文件
+                    return false;                 ///< 删除失败，返回false
                 }
             }
-            entry.close();  ///< 关闭当前文件或目录
         }
 
         // 删除空目录
-        return LittleFS.rmdir(dirPath.c_str());  ///< 删除当前空目录
+        return backend.rmdir(dirPath);  ///< 删除当前空目录
     }
 
    private:
-    File work_file;  // 当前操作的文件对象
-    File work_dir;   // 当前操作的目录对象
-};
\ No newline at end of file
+    FSBackend backend;  // 编译期选定的存储后端(持有当前操作的文件与目录句柄)
+};
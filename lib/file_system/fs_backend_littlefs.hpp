@@ -0,0 +1,106 @@
+/**
+ * @file fs_backend_littlefs.hpp
+ * @date 17.10.2026
+ * @author RMSHE
+ *
+ * < GasSensorOS >
+ * Copyright(C) 2026 RMSHE. All rights reserved.
+ *
+ * This program is free software : you can redistribute it and /or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.If not, see < https://www.gnu.org/licenses/>.
+ *
+ * Electronic Mail : asdfghjkl851@outlook.com
+ */
+#pragma once
+#include <Arduino.h>
+#include <LittleFS.h>
+
+#include <string>
+
+/**
+ * @brief LittleFS 存储后端
+ *
+ * 将 `FSInterface` 所需的底层原语映射到 ESP32 Arduino 的 `LittleFS` 对象上。
+ * 每个后端实例持有一个工作文件句柄和一个工作目录句柄，与原先 `FSInterface` 的行为一致。
+ */
+class LittleFSBackend {
+   public:
+    bool begin() { return LittleFS.begin(); }
+    void end() { LittleFS.end(); }
+
+   public:
+    // ---- 工作文件句柄 ----
+    bool openFile(const std::string& path, const char* mode) {
+        work_file = LittleFS.open(path.c_str(), mode);
+        return static_cast<bool>(work_file);
+    }
+    void closeFile() { work_file.close(); }
+    bool fileIsOpen() { return static_cast<bool>(work_file); }
+    bool fileIsDirectory() { return work_file.isDirectory(); }
+    size_t read(uint8_t* buffer, size_t size) { return work_file.read(buffer, size); }
+    size_t write(const uint8_t* buffer, size_t size) { return work_file.write(buffer, size); }
+    size_t fileSize() { return work_file.size(); }
+    uint32_t lastWrite() { return work_file.getLastWrite(); }
+    std::string fileName() { return work_file.name(); }
+    int available() { return work_file.available(); }
+    void flush() { work_file.flush(); }
+
+    // ---- 工作目录句柄 ----
+    bool openDir(const std::string& path) {
+        work_dir = LittleFS.open(path.c_str());
+        return static_cast<bool>(work_dir);
+    }
+    void closeDir() { work_dir.close(); }
+    bool dirIsOpen() { return static_cast<bool>(work_dir); }
+    bool dirIsDirectory() { return work_dir.isDirectory(); }
+    void rewindDir() { work_dir.rewindDirectory(); }
+
+    /**
+     * @brief 读取工作目录中的下一项
+     * @param name[out] 条目名称
+     * @param is_dir[out] 条目是否为目录(可为空)
+     * @return 若没有更多条目返回 false
+     */
+    bool nextEntry(std::string& name, bool* is_dir = nullptr) {
+        if (!work_dir) return false;
+        File entry = work_dir.openNextFile();
+        if (!entry) return false;
+        name = entry.name();
+        if (is_dir) *is_dir = entry.isDirectory();
+        entry.close();
+        return true;
+    }
+
+   public:
+    // ---- 路径级操作 ----
+    bool exists(const std::string& path) { return LittleFS.exists(path.c_str()); }
+    bool isDirectory(const std::string& path) {
+        File file = LittleFS.open(path.c_str());
+        bool result = file.isDirectory();
+        file.close();
+        return result;
+    }
+    bool remove(const std::string& path) { return LittleFS.remove(path.c_str()); }
+    bool rename(const std::string& old_path, const std::string& new_path) { return LittleFS.rename(old_path.c_str(), new_path.c_str()); }
+    bool mkdir(const std::string& path) { return LittleFS.mkdir(path.c_str()); }
+    bool rmdir(const std::string& path) { return LittleFS.rmdir(path.c_str()); }
+
+    // ---- 文件系统管理 ----
+    size_t totalBytes() { return LittleFS.totalBytes(); }
+    size_t usedBytes() { return LittleFS.usedBytes(); }
+    bool format() { return LittleFS.format(); }
+
+   private:
+    File work_file;  // 当前操作的文件对象
+    File work_dir;   // 当前操作的目录对象
+};
@@ -0,0 +1,236 @@
+/**
+ * @file fs_backend_posix.hpp
+ * @date 17.10.2026
+ * @author RMSHE
+ *
+ * < GasSensorOS >
+ * Copyright(C) 2026 RMSHE. All rights reserved.
+ *
+ * This program is free software : you can redistribute it and /or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.If not, see < https://www.gnu.org/licenses/>.
+ *
+ * Electronic Mail : asdfghjkl851@outlook.com
+ */
+#pragma once
+#include <dirent.h>
+#include <sys/stat.h>
+#include <sys/statvfs.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+/**
+ * @brief POSIX 存储后端
+ *
+ * 在主机(Linux/macOS)上用标准 C 文件流与 POSIX 目录接口模拟 `LittleFS` 的行为，
+ * 使 `FileManager`、`DirectoryManager`、`FileExplorer` 等上层组件无需开发板即可运行与测量。
+ * 所有设备路径都被映射到 `root()` 指定的主机目录之下。
+ */
+class PosixFSBackend {
+   public:
+    PosixFSBackend() = default;
+
+    // 句柄不随对象复制, 副本从关闭状态开始(避免两个对象重复关闭同一个文件流)
+    PosixFSBackend(const PosixFSBackend&) {}
+    PosixFSBackend& operator=(const PosixFSBackend& other) {
+        if (this != &other) end();
+        return *this;
+    }
+
+    ~PosixFSBackend() {
+        closeFile();
+        closeDir();
+    }
+
+    /**
+     * @brief 设置主机端根目录(所有实例共享, 默认为 "./gsos_fs"), 设备路径 "/a/b" 会映射到 "<root>/a/b"
+     * @note 应在挂载文件系统之前调用. 用法: PosixFSBackend::setRoot("/tmp/gsos");
+     */
+    static void setRoot(const std::string& path) { rootPath() = path; }
+    static const std::string& root() { return rootPath(); }
+
+    bool begin() { return makeHostDir(root()); }
+    void end() {
+        closeFile();
+        closeDir();
+    }
+
+   public:
+    // ---- 工作文件句柄 ----
+    bool openFile(const std::string& path, const char* mode) {
+        closeFile();
+        work_file_path = path;
+        work_file = std::fopen(hostPath(path).c_str(), mode);
+        return work_file != nullptr;
+    }
+    void closeFile() {
+        if (work_file) std::fclose(work_file);
+        work_file = nullptr;
+    }
+    bool fileIsOpen() { return work_file != nullptr; }
+    bool fileIsDirectory() {
+        struct stat st;
+        return work_file && fstat(fileno(work_file), &st) == 0 && S_ISDIR(st.st_mode);
+    }
+    size_t read(uint8_t* buffer, size_t size) { return work_file ? std::fread(buffer, 1, size, work_file) : 0; }
+    size_t write(const uint8_t* buffer, size_t size) { return work_file ? std::fwrite(buffer, 1, size, work_file) : 0; }
+    size_t fileSize() {
+        struct stat st;
+        if (!work_file) return 0;
+        std::fflush(work_file);
+        return fstat(fileno(work_file), &st) == 0 ? static_cast<size_t>(st.st_size) : 0;
+    }
+    uint32_t lastWrite() {
+        struct stat st;
+        return work_file && fstat(fileno(work_file), &st) == 0 ? static_cast<uint32_t>(st.st_mtime) : 0;
+    }
+    std::string fileName() { return baseName(work_file_path); }
+    int available() {
+        if (!work_file) return 0;
+        long pos = std::ftell(work_file);
+        return pos < 0 ? 0 : static_cast<int>(fileSize() - static_cast<size_t>(pos));
+    }
+    void flush() {
+        if (work_file) std::fflush(work_file);
+    }
+
+    // ---- 工作目录句柄 ----
+    bool openDir(const std::string& path) {
+        closeDir();
+        work_dir_path = path;
+        work_dir = opendir(hostPath(path).c_str());
+        return work_dir != nullptr;
+    }
+    void closeDir() {
+        if (work_dir) closedir(work_dir);
+        work_dir = nullptr;
+    }
+    bool dirIsOpen() { return work_dir != nullptr; }
+    bool dirIsDirectory() { return work_dir != nullptr; }
+    void rewindDir() {
+        if (work_dir) rewinddir(work_dir);
+    }
+
+    /**
+     * @brief 读取工作目录中的下一项(跳过 "." 与 "..")
+     * @param name[out] 条目名称
+     * @param is_dir[out] 条目是否为目录(可为空)
+     * @return 若没有更多条目返回 false
+     */
+    bool nextEntry(std::string& name, bool* is_dir = nullptr) {
+        if (!work_dir) return false;
+        while (struct dirent* entry = readdir(work_dir)) {
+            if (std::strcmp(entry->d_name, ".") == 0 || std::strcmp(entry->d_name, "..") == 0) continue;
+            name = entry->d_name;
+            if (is_dir) *is_dir = isDirectory(joinPath(work_dir_path, name));
+            return true;
+        }
+        return false;
+    }
+
+   public:
+    // ---- 路径级操作 ----
+    bool exists(const std::string& path) {
+        struct stat st;
+        return stat(hostPath(path).c_str(), &st) == 0;
+    }
+    bool isDirectory(const std::string& path) {
+        struct stat st;
+        return stat(hostPath(path).c_str(), &st) == 0 && S_ISDIR(st.st_mode);
+    }
+    bool remove(const std::string& path) { return std::remove(hostPath(path).c_str()) == 0; }
+    bool rename(const std::string& old_path, const std::string& new_path) { return std::rename(hostPath(old_path).c_str(), hostPath(new_path).c_str()) == 0; }
+    bool mkdir(const std::string& path) { return ::mkdir(hostPath(path).c_str(), 0755) == 0; }
+    bool rmdir(const std::string& path) { return ::rmdir(hostPath(path).c_str()) == 0; }
+
+    // ---- 文件系统管理 ----
+    size_t totalBytes() {
+        struct statvfs vfs;
+        return statvfs(root().c_str(), &vfs) == 0 ? static_cast<size_t>(vfs.f_blocks) * vfs.f_frsize : 0;
+    }
+    size_t usedBytes() { return treeBytes(root()); }
+    bool format() {
+        if (!clearHostDir(root())) return false;
+        return makeHostDir(root());
+    }
+
+   private:
+    // 主机端根目录(函数内静态变量在所有翻译单元中只有一份)
+    static std::string& rootPath() {
+        static std::string root_path = "./gsos_fs";
+        return root_path;
+    }
+
+    // 将设备路径映射为主机路径
+    static std::string hostPath(const std::string& path) {
+        if (path.empty() || path == "/") return root();
+        return path[0] == '/' ? root() + path : root() + "/" + path;
+    }
+
+    static std::string joinPath(const std::string& dir, const std::string& name) { return (!dir.empty() && dir.back() == '/') ? dir + name : dir + "/" + name; }
+
+    static std::string baseName(const std::string& path) {
+        size_t pos = path.find_last_of('/');
+        return pos == std::string::npos ? path : path.substr(pos + 1);
+    }
+
+    // 逐层创建主机目录(已存在视为成功)
+    static bool makeHostDir(const std::string& host_path) {
+        struct stat st;
+        if (stat(host_path.c_str(), &st) == 0) return S_ISDIR(st.st_mode);
+        size_t pos = host_path.find_last_of('/');
+        if (pos != std::string::npos && pos > 0 && !makeHostDir(host_path.substr(0, pos))) return false;
+        return ::mkdir(host_path.c_str(), 0755) == 0;
+    }
+
+    // 递归删除主机目录下的全部内容及其自身
+    static bool clearHostDir(const std::string& host_path) {
+        DIR* dir = opendir(host_path.c_str());
+        if (!dir) return false;
+        bool ok = true;
+        while (struct dirent* entry = readdir(dir)) {
+            if (std::strcmp(entry->d_name, ".") == 0 || std::strcmp(entry->d_name, "..") == 0) continue;
+            std::string child = host_path + "/" + entry->d_name;
+            struct stat st;
+            if (stat(child.c_str(), &st) != 0) continue;
+            ok = (S_ISDIR(st.st_mode) ? clearHostDir(child) : std::remove(child.c_str()) == 0) && ok;
+        }
+        closedir(dir);
+        return ::rmdir(host_path.c_str()) == 0 && ok;
+    }
+
+    // 统计主机目录下所有文件的字节数
+    static size_t treeBytes(const std::string& host_path) {
+        DIR* dir = opendir(host_path.c_str());
+        if (!dir) return 0;
+        size_t total = 0;
+        while (struct dirent* entry = readdir(dir)) {
+            if (std::strcmp(entry->d_name, ".") == 0 || std::strcmp(entry->d_name, "..") == 0) continue;
+            std::string child = host_path + "/" + entry->d_name;
+            struct stat st;
+            if (stat(child.c_str(), &st) != 0) continue;
+            total += S_ISDIR(st.st_mode) ? treeBytes(child) : static_cast<size_t>(st.st_size);
+        }
+        closedir(dir);
+        return total;
+    }
+
+   private:
+    FILE* work_file = nullptr;  // 当前操作的文件流
+    DIR* work_dir = nullptr;    // 当前操作的目录流
+    std::string work_file_path;  // 当前文件的设备路径
+    std::string work_dir_path;   // 当前目录的设备路径
+};
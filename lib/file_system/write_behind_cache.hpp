@@ -0,0 +1,269 @@
+/**
+ * @file write_behind_cache.hpp
+ * @date 17.10.2026
+ * @author RMSHE
+ *
+ * < GasSensorOS >
+ * Copyright(C) 2026 RMSHE. All rights reserved.
+ *
+ * This program is free software : you can redistribute it and /or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.If not, see < https://www.gnu.org/licenses/>.
+ *
+ * Electronic Mail : asdfghjkl851@outlook.com
+ */
+
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <fs_Interface.hpp>
+#include <map>
+#include <mutex>
+#include <serial_warning.hpp>
+#include <string>
+
+/**
+ * @brief 追加写回缓存(write-behind)
+ *
+ * 以文件路径为键缓存尚未写入闪存的追加数据。频繁的小块追加(例如每次一行 CSV)先在内存中合并，
+ * 满足以下任一条件时才打开文件一次性写回，从而把多次"打开-写几个字节-关闭"合并为一次接近页大小的写入，
+ * 大幅减少 LittleFS 的元数据提交次数：
+ * - 单个文件缓冲的数据达到 `Config::flushBytes`；
+ * - 所有文件缓冲的数据总量超过 `Config::maxBytes`；
+ * - 缓冲数据滞留时间超过 `Config::maxAgeMs`(在 `append()` 或 `poll()` 时检查, 内核任务周期性调用 `poll()`)；
+ * - 显式调用 `flush()`/`sync()`，或文件系统卸载。
+ *
+ * @note 缓冲中的数据在写回前只存在于 RAM，掉电会丢失最多 `maxBytes` 字节或 `maxAgeMs` 毫秒的数据。
+ * @note 公共接口由内部互斥锁保护, 可以在后台任务中调用 `poll()` 的同时在主循环中追加数据。
+ */
+class WriteBehindCache {
+   public:
+    // 缓存配置
+    struct Config {
+        bool enabled = false;     // 是否启用缓存; 关闭时 append() 直接写入闪存
+        size_t flushBytes = 4096;  // 单个文件缓冲达到该字节数时写回(约一个闪存块)
+        size_t maxBytes = 16384;   // 所有文件缓冲总量上限, 超过时全部写回
+        uint32_t maxAgeMs = 2000;  // 缓冲数据的最长滞留时间(毫秒)
+    };
+
+    // 运行统计
+    struct Stats {
+        size_t appends = 0;       // append() 调用次数
+        size_t writeBacks = 0;    // 实际打开文件写回的次数
+        size_t bytesWritten = 0;  // 写回的总字节数
+    };
+
+    WriteBehindCache() = default;
+    explicit WriteBehindCache(const Config& config) : config_(config) {}
+    WriteBehindCache(const WriteBehindCache&) = delete;
+    WriteBehindCache& operator=(const WriteBehindCache&) = delete;
+
+    // 析构时写回所有缓冲数据
+    ~WriteBehindCache() { flush(); }
+
+    /**
+     * @brief 修改缓存配置
+     * 关闭缓存时会先写回所有缓冲数据。
+     */
+    void setConfig(const Config& config) {
+        std::lock_guard<std::recursive_mutex> lock(mutex_);
+        if (!config.enabled) flush();
+        config_ = config;
+    }
+    Config config() const {
+        std::lock_guard<std::recursive_mutex> lock(mutex_);
+        return config_;
+    }
+    bool enabled() const {
+        std::lock_guard<std::recursive_mutex> lock(mutex_);
+        return config_.enabled;
+    }
+
+    Stats stats() const {
+        std::lock_guard<std::recursive_mutex> lock(mutex_);
+        return stats_;
+    }
+    // 尚未写回的总字节数
+    size_t pendingBytes() const {
+        std::lock_guard<std::recursive_mutex> lock(mutex_);
+        return pending_bytes_;
+    }
+    // 有缓冲数据的文件数
+    size_t pendingFiles() const {
+        std::lock_guard<std::recursive_mutex> lock(mutex_);
+        return pending_.size();
+    }
+
+    // 指定文件是否有尚未写回的数据(有缓冲数据说明该文件在缓冲时已存在)
+    bool pending(const std::string& path) {
+        std::lock_guard<std::recursive_mutex> lock(mutex_);
+        return pending_.count(path) != 0;
+    }
+
+    /**
+     * @brief 追加数据到文件
+     * 启用缓存时数据先进入缓冲区，按阈值写回；未启用时直接追加写入文件。
+     * @param path 文件路径
+     * @param data 数据指针
+     * @param size 数据字节数
+     * @return 成功返回 true; 写回失败返回 false
+     */
+    bool append(const std::string& path, const void* data, size_t size) {
+        std::lock_guard<std::recursive_mutex> lock(mutex_);
+        ++stats_.appends;
+        if (!config_.enabled) return writeBack(path, data, size);
+
+        auto it = pending_.find(path);
+
+        // 没有缓冲数据且单次写入已达阈值时直接写入, 避免无意义的复制
+        if (it == pending_.end() && size >= config_.flushBytes) return writeBack(path, data, size);
+
+        if (it == pending_.end()) it = pending_.emplace(path, Pending{std::string(), nowMs()}).first;
+        it->second.data.append(static_cast<const char*>(data), size);
+        pending_bytes_ += size;
+
+        bool success = true;
+        if (it->second.data.size() >= config_.flushBytes) success = flushEntry(it);
+        if (pending_bytes_ > config_.maxBytes) success = flush() && success;
+        return poll() && success;
+    }
+    bool append(const std::string& path, const std::string& data) { return append(path, data.data(), data.size()); }
+
+    /**
+     * @brief 写回滞留时间超过 maxAgeMs 的缓冲数据
+     * 缓存只在 append() 时检查滞留时间, 追加停止后依靠内核任务定期调用本函数写回。
+     * @return 全部写回成功返回 true
+     */
+    bool poll() {
+        std::lock_guard<std::recursive_mutex> lock(mutex_);
+        if (pending_.empty()) return true;
+
+        bool success = true;
+        uint32_t now = nowMs();
+        for (auto it = pending_.begin(); it != pending_.end();) {
+            if (now - it->second.since_ms >= config_.maxAgeMs) {
+                success = flushEntry(it++) && success;
+            } else {
+                ++it;
+            }
+        }
+        return success;
+    }
+
+    /**
+     * @brief 写回指定路径(及其子路径)的缓冲数据
+     * 读取、复制、移动路径前调用，保证看到的是完整的文件内容。
+     * @return 全部写回成功返回 true
+     */
+    bool flush(const std::string& path) {
+        std::lock_guard<std::recursive_mutex> lock(mutex_);
+        bool success = true;
+        for (auto it = pending_.lower_bound(path); it != pending_.end() && hasPrefix(it->first, path);) {
+            if (isUnder(it->first, path)) {
+                success = flushEntry(it++) && success;
+            } else {
+                ++it;
+            }
+        }
+        return success;
+    }
+
+    /**
+     * @brief 写回所有缓冲数据
+     * @return 全部写回成功返回 true
+     */
+    bool flush() {
+        std::lock_guard<std::recursive_mutex> lock(mutex_);
+        bool success = true;
+        for (auto it = pending_.begin(); it != pending_.end();) success = flushEntry(it++) && success;
+        return success;
+    }
+
+    /**
+     * @brief 写回所有缓冲数据并确保已提交到闪存
+     * 每次写回都会关闭文件, LittleFS 在关闭文件时提交元数据, 因此 sync() 返回后数据可在掉电后保留。
+     * @return 全部写回成功返回 true
+     */
+    bool sync() { return flush(); }
+
+    /**
+     * @brief 丢弃指定路径(及其子路径)的缓冲数据
+     * 删除或覆写文件前调用，避免旧的缓冲数据之后被追加到新文件中。
+     */
+    void discard(const std::string& path) {
+        std::lock_guard<std::recursive_mutex> lock(mutex_);
+        for (auto it = pending_.lower_bound(path); it != pending_.end() && hasPrefix(it->first, path);) {
+            if (isUnder(it->first, path)) {
+                pending_bytes_ -= it->second.data.size();
+                it = pending_.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+   private:
+    // 一个文件的缓冲数据
+    struct Pending {
+        std::string data;   // 待追加的数据
+        uint32_t since_ms;  // 最早一笔缓冲数据的时间
+    };
+    using PendingMap = std::map<std::string, Pending>;
+
+    // 写回一个条目并将其移出缓存
+    bool flushEntry(PendingMap::iterator it) {
+        bool success = writeBack(it->first, it->second.data.data(), it->second.data.size());
+        pending_bytes_ -= it->second.data.size();
+        pending_.erase(it);
+        return success;
+    }
+
+    // 打开文件一次并追加写入
+    bool writeBack(const std::string& path, const void* data, size_t size) {
+        if (size == 0) return true;
+        if (!fs.open(path, "a")) {
+            WARN(WarningLevel::ERROR, "写回缓存数据失败, 已丢弃 %u 字节: %s", static_cast<unsigned>(size), path.c_str());
+            return false;
+        }
+        size_t written = fs.write(data, size);
+        fs.close();
+
+        ++stats_.writeBacks;
+        stats_.bytesWritten += written;
+        if (written != size) {
+            WARN(WarningLevel::ERROR, "写回缓存数据不完整(%u/%u 字节): %s", static_cast<unsigned>(written), static_cast<unsigned>(size), path.c_str());
+            return false;
+        }
+        return true;
+    }
+
+    // path 是否以 prefix 开头(有序容器中 prefix 的所有子路径都落在这一区间内)
+    static bool hasPrefix(const std::string& path, const std::string& prefix) { return path.compare(0, prefix.size(), prefix) == 0; }
+
+    // path 是否等于 prefix 或位于 prefix 目录之下
+    static bool isUnder(const std::string& path, const std::string& prefix) {
+        if (!hasPrefix(path, prefix)) return false;
+        return path.size() == prefix.size() || prefix == "/" || path[prefix.size()] == '/';
+    }
+
+    static uint32_t nowMs() {
+        return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+   private:
+    FSInterface fs;
+    Config config_;
+    Stats stats_;
+    PendingMap pending_;                  // 按路径有序, 便于按目录前缀批量写回
+    size_t pending_bytes_ = 0;            // 所有缓冲数据的总字节数
+    mutable std::recursive_mutex mutex_;  // append()/flush() 内部会相互调用, 因此使用可重入锁
+};
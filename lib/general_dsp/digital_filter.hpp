@@ -0,0 +1,386 @@
+/**
+ * @file digital_filter.hpp
+ * @date 17.10.2026
+ * @author RMSHE
+ *
+ * < GasSensorOS >
+ * Copyright(C) 2026 RMSHE. All rights reserved.
+ *
+ * This program is free software : you can redistribute it and /or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.If not, see < https://www.gnu.org/licenses/>.
+ *
+ * Electronic Mail : asdfghjkl851@outlook.com
+ */
+
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <ring_buffer.h>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+/*
+ * 数字滤波器库
+ *
+ * 抽头数、级数、窗口长度与样本类型都是模板参数，内层循环的次数在编译期确定，编译器可以完全展开；
+ * 所有状态保存在对象内的定长数组中，不分配堆内存。
+ *
+ * 每个滤波器都提供三种处理接口：
+ * - T process(T sample)                                  逐样本处理
+ * - void process(const T* in, T* out, size_t count)      块处理(in 与 out 可以是同一数组)
+ * - size_t process(RingSpan<const T> in, RingSpan<T> out) 按视图块处理，返回处理的样本数(两者长度的较小值)；
+ *                                                        可以直接处理 RingBuffer::segments() 返回的两段数据
+ */
+
+/**
+ * @brief 为滤波器派生类提供块处理与视图接口(CRTP)
+ * @tparam Derived 派生类, 需实现 T process(T sample)
+ */
+template <typename Derived, typename T>
+class FilterBase {
+   public:
+    using Sample = T;
+
+    void process(const T *in, T *out, size_t count) {
+        Derived &self = static_cast<Derived &>(*this);
+        for (size_t i = 0; i < count; ++i) out[i] = self.process(in[i]);
+    }
+
+    size_t process(RingSpan<const T> in, RingSpan<T> out) {
+        const size_t count = std::min(in.size, out.size);
+        process(in.data, out.data, count);
+        return count;
+    }
+};
+
+/**
+ * @brief FIR 滤波器
+ *
+ * 延迟线长度为 2×Taps，每个样本同时写入两处，卷积始终在一段连续内存上进行，无需取模；
+ * 抽头数是编译期常量，卷积循环可以完全展开。
+ *
+ * @tparam T 样本类型(float/double)
+ * @tparam Taps 抽头数
+ */
+template <typename T, size_t Taps>
+class FIRFilter : public FilterBase<FIRFilter<T, Taps>, T> {
+    static_assert(Taps > 0, "FIRFilter 抽头数必须大于0");
+
+   public:
+    using FilterBase<FIRFilter<T, Taps>, T>::process;
+
+    /**
+     * @brief 构造函数
+     * @param coefficients 系数 h[0..Taps-1], y(n) = Σ h[i]·x(n-i)
+     */
+    explicit FIRFilter(const std::array<T, Taps> &coefficients) {
+        for (size_t i = 0; i < Taps; ++i) coeffs_[i] = coefficients[Taps - 1 - i];  // 倒序存放, 与延迟线中从旧到新的顺序对应
+        reset();
+    }
+
+    T process(T sample) {
+        delay_[pos_] = delay_[pos_ + Taps] = sample;
+        pos_ = (pos_ + 1 == Taps) ? 0 : pos_ + 1;
+
+        // delay_[pos_ .. pos_+Taps) 依次为最旧到最新的样本
+        const T *x = delay_.data() + pos_;
+        T acc = 0;
+        for (size_t i = 0; i < Taps; ++i) acc += coeffs_[i] * x[i];
+        return acc;
+    }
+
+    void reset() {
+        delay_.fill(0);
+        pos_ = 0;
+    }
+
+   private:
+    std::array<T, Taps> coeffs_;
+    std::array<T, 2 * Taps> delay_;  // 双倍长度的延迟线
+    size_t pos_ = 0;                 // 最旧样本的位置
+};
+
+// 二阶节系数, H(z) = (b0 + b1·z⁻¹ + b2·z⁻²) / (1 + a1·z⁻¹ + a2·z⁻²)
+template <typename T>
+struct BiquadCoefficients {
+    T b0 = 1, b1 = 0, b2 = 0, a1 = 0, a2 = 0;
+
+    // 常用二阶节设计(RBJ Audio EQ Cookbook), fs 为采样率, fc 为截止/中心频率, q 为品质因数
+    static BiquadCoefficients lowPass(double fs, double fc, double q = 0.7071067811865476) { return design(fs, fc, q, Type::LowPass); }
+    static BiquadCoefficients highPass(double fs, double fc, double q = 0.7071067811865476) { return design(fs, fc, q, Type::HighPass); }
+    static BiquadCoefficients bandPass(double fs, double fc, double q) { return design(fs, fc, q, Type::BandPass); }
+    static BiquadCoefficients notch(double fs, double fc, double q) { return design(fs, fc, q, Type::Notch); }
+
+   private:
+    enum class Type { LowPass, HighPass, BandPass, Notch };
+
+    static BiquadCoefficients design(double fs, double fc, double q, Type type) {
+        const double w = 2.0 * 3.14159265358979323846 * fc / fs;
+        const double cw = std::cos(w), alpha = std::sin(w) / (2.0 * q);
+        double b0, b1, b2;
+        switch (type) {
+            case Type::LowPass:
+                b0 = b2 = (1 - cw) / 2, b1 = 1 - cw;
+                break;
+            case Type::HighPass:
+                b0 = b2 = (1 + cw) / 2, b1 = -(1 + cw);
+                break;
+            case Type::BandPass:
+                b0 = alpha, b1 = 0, b2 = -alpha;
+                break;
+            default:
+                b0 = b2 = 1, b1 = -2 * cw;
+                break;
+        }
+        const double a0 = 1 + alpha;
+        BiquadCoefficients c;
+        c.b0 = static_cast<T>(b0 / a0);
+        c.b1 = static_cast<T>(b1 / a0);
+        c.b2 = static_cast<T>(b2 / a0);
+        c.a1 = static_cast<T>(-2 * cw / a0);
+        c.a2 = static_cast<T>((1 - alpha) / a0);
+        return c;
+    }
+};
+
+/**
+ * @brief 二阶节级联 IIR 滤波器(直接 II 型转置)
+ *
+ * 高阶 IIR 拆成若干二阶节级联，数值上比单个高阶直接型稳定；每个二阶节只保存 2 个状态。
+ *
+ * @tparam T 样本类型(float/double)
+ * @tparam Stages 二阶节个数
+ */
+template <typename T, size_t Stages>
+class BiquadCascade : public FilterBase<BiquadCascade<T, Stages>, T> {
+    static_assert(Stages > 0, "BiquadCascade 级数必须大于0");
+
+   public:
+    using Coefficients = BiquadCoefficients<T>;
+    using FilterBase<BiquadCascade<T, Stages>, T>::process;
+
+    explicit BiquadCascade(const std::array<Coefficients, Stages> &stages) : stages_(stages) { reset(); }
+
+    T process(T sample) {
+        for (size_t s = 0; s < Stages; ++s) {
+            const Coefficients &c = stages_[s];
+            T(&z)[2] = state_[s];
+            const T y = c.b0 * sample + z[0];
+            z[0] = c.b1 * sample - c.a1 * y + z[1];
+            z[1] = c.b2 * sample - c.a2 * y;
+            sample = y;
+        }
+        return sample;
+    }
+
+    void reset() {
+        for (auto &z : state_) z[0] = z[1] = 0;
+    }
+
+   private:
+    std::array<Coefficients, Stages> stages_;
+    T state_[Stages][2];
+};
+
+/**
+ * @brief 滑动平均滤波器
+ *
+ * 维护窗口内的累加和，每样本 O(1)。浮点类型每满一个窗口从缓冲区重新求和一次，避免加减误差长期累积。
+ *
+ * @tparam T 样本类型
+ * @tparam Window 窗口长度
+ */
+template <typename T, size_t Window>
+class MovingAverage : public FilterBase<MovingAverage<T, Window>, T> {
+    static_assert(Window > 0, "MovingAverage 窗口长度必须大于0");
+    using Sum = typename std::conditional<std::is_integral<T>::value, int64_t, T>::type;
+
+   public:
+    using FilterBase<MovingAverage<T, Window>, T>::process;
+
+    MovingAverage() { reset(); }
+
+    /**
+     * @brief 处理一个样本
+     * @return 最近 min(已处理样本数, Window) 个样本的平均值
+     */
+    T process(T sample) {
+        sum_ += static_cast<Sum>(sample) - static_cast<Sum>(window_[pos_]);
+        window_[pos_] = sample;
+        pos_ = (pos_ + 1 == Window) ? 0 : pos_ + 1;
+        if (count_ < Window) ++count_;
+
+        if (!std::is_integral<T>::value && pos_ == 0) {
+            sum_ = 0;
+            for (const T &v : window_) sum_ += v;
+        }
+        return static_cast<T>(sum_ / static_cast<Sum>(count_));
+    }
+
+    void reset() {
+        window_.fill(0);
+        sum_ = 0;
+        pos_ = count_ = 0;
+    }
+
+   private:
+    std::array<T, Window> window_;
+    Sum sum_ = 0;
+    size_t pos_ = 0;    // 最旧样本的位置
+    size_t count_ = 0;  // 窗口内的样本数
+};
+
+/**
+ * @brief 滑动中值滤波器
+ *
+ * 同时维护按时间排列的环形窗口和有序窗口；每个样本在有序窗口中二分查找删除最旧值、插入新值，
+ * 对脉冲干扰(如 ADC 偶发的尖峰)比平均滤波更鲁棒。
+ *
+ * @tparam T 样本类型
+ * @tparam Window 窗口长度(建议为奇数)
+ */
+template <typename T, size_t Window>
+class MovingMedian : public FilterBase<MovingMedian<T, Window>, T> {
+    static_assert(Window > 0, "MovingMedian 窗口长度必须大于0");
+
+   public:
+    using FilterBase<MovingMedian<T, Window>, T>::process;
+
+    /**
+     * @brief 处理一个样本
+     * @return 最近 min(已处理样本数, Window) 个样本的中值(偶数个时取较小的中间值)
+     */
+    T process(T sample) {
+        T *first = sorted_.data(), *last = sorted_.data() + count_;
+        if (count_ == Window) {
+            // 删除最旧的样本
+            T *old = std::lower_bound(first, last, window_[pos_]);
+            std::copy(old + 1, last, old);
+            --last;
+        } else {
+            ++count_;
+        }
+        // 插入新样本
+        T *at = std::upper_bound(first, last, sample);
+        std::copy_backward(at, last, last + 1);
+        *at = sample;
+
+        window_[pos_] = sample;
+        pos_ = (pos_ + 1 == Window) ? 0 : pos_ + 1;
+        return sorted_[(count_ - 1) / 2];
+    }
+
+    void reset() { pos_ = count_ = 0; }
+
+   private:
+    std::array<T, Window> window_{};  // 按时间排列(环形)
+    std::array<T, Window> sorted_{};  // 按数值排列, 前 count_ 个有效
+    size_t pos_ = 0;                  // 最旧样本的位置
+    size_t count_ = 0;                // 窗口内的样本数
+};
+
+/**
+ * @brief 指数平滑(一阶 IIR 低通)
+ * y(n) = y(n-1) + α·(x(n) - y(n-1))，第一个样本直接作为初值。
+ * @tparam T 样本类型(float/double)
+ */
+template <typename T>
+class ExponentialSmoothing : public FilterBase<ExponentialSmoothing<T>, T> {
+   public:
+    using FilterBase<ExponentialSmoothing<T>, T>::process;
+
+    /**
+     * @brief 构造函数
+     * @param alpha 平滑系数 (0, 1]，越小越平滑
+     */
+    explicit ExponentialSmoothing(T alpha) : alpha_(alpha) {}
+
+    // 由时间常数构造: α = 1 - e^{-Δt/τ}
+    static ExponentialSmoothing fromTimeConstant(double sampleRate, double tau) { return ExponentialSmoothing(static_cast<T>(1.0 - std::exp(-1.0 / (sampleRate * tau)))); }
+
+    T process(T sample) {
+        y_ = primed_ ? y_ + alpha_ * (sample - y_) : sample;
+        primed_ = true;
+        return y_;
+    }
+
+    void reset() { primed_ = false; }
+
+   private:
+    T alpha_;
+    T y_ = 0;
+    bool primed_ = false;  // 是否已经收到第一个样本
+};
+
+/**
+ * @brief 滤波器链: 按顺序串联多个滤波器, 链的组成在编译期确定
+ *
+ * 块处理时每个滤波器依次处理整块数据(原地)，比逐样本穿过整条链有更好的指令局部性。
+ *
+ * @code
+ * FilterChain<MovingMedian<float, 5>, BiquadCascade<float, 2>> chain(MovingMedian<float, 5>(), BiquadCascade<float, 2>(stages));
+ * @endcode
+ */
+template <typename... Filters>
+class FilterChain {
+    static_assert(sizeof...(Filters) > 0, "FilterChain 至少需要一个滤波器");
+    using T = typename std::tuple_element<0, std::tuple<Filters...>>::type::Sample;
+
+   public:
+    explicit FilterChain(Filters... filters) : filters_(std::move(filters)...) {}
+
+    T process(T sample) {
+        processEach(sample, std::index_sequence_for<Filters...>());
+        return sample;
+    }
+
+    void process(const T *in, T *out, size_t count) {
+        if (in != out) std::copy(in, in + count, out);
+        processBlock(out, count, std::index_sequence_for<Filters...>());
+    }
+
+    size_t process(RingSpan<const T> in, RingSpan<T> out) {
+        const size_t count = std::min(in.size, out.size);
+        process(in.data, out.data, count);
+        return count;
+    }
+
+    void reset() { resetEach(std::index_sequence_for<Filters...>()); }
+
+    // 访问第 I 个滤波器
+    template <size_t I>
+    typename std::tuple_element<I, std::tuple<Filters...>>::type &get() {
+        return std::get<I>(filters_);
+    }
+
+   private:
+    template <size_t... I>
+    void processEach(T &sample, std::index_sequence<I...>) {
+        ((sample = std::get<I>(filters_).process(sample)), ...);
+    }
+
+    template <size_t... I>
+    void processBlock(T *data, size_t count, std::index_sequence<I...>) {
+        (std::get<I>(filters_).process(static_cast<const T *>(data), data, count), ...);
+    }
+
+    template <size_t... I>
+    void resetEach(std::index_sequence<I...>) {
+        (std::get<I>(filters_).reset(), ...);
+    }
+
+    std::tuple<Filters...> filters_;
+};
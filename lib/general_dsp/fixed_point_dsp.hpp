@@ -0,0 +1,392 @@
+/**
+ * @file fixed_point_dsp.hpp
+ * @date 17.10.2026
+ * @author RMSHE
+ *
+ * < GasSensorOS >
+ * Copyright(C) 2026 RMSHE. All rights reserved.
+ *
+ * This program is free software : you can redistribute it and /or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.If not, see < https://www.gnu.org/licenses/>.
+ *
+ * Electronic Mail : asdfghjkl851@outlook.com
+ */
+
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <type_traits>
+#include <vector>
+
+/*
+ * 定点(Q15/Q31)信号处理路径
+ *
+ * Q15 用 int16_t 表示 [-1, 1) 内的数(值 = 整数 / 2^15)，Q31 用 int32_t(值 = 整数 / 2^31)。
+ * 所有运算只使用整数加减、乘法与移位，乘积一律四舍五入(加 2^(Q-1) 后算术右移)并饱和，
+ * 因此同一输入在主机与 ESP32 上得到逐位相同的结果，可以在主机上与逐位参考值或浮点实现(按量化误差界)对照测试。
+ */
+namespace fixed_point {
+using q15 = int16_t;
+using q31 = int32_t;
+
+// 定点格式参数: Wide 为乘积/累加使用的宽类型;
+// kGuardBits 为滤波器在 int64_t 中累加前每个乘积先右移的位数(q31 的乘积已占 62 位, 不预留保护位时满量程下 2 项相加即会溢出)
+template <typename T>
+struct Traits;
+
+template <>
+struct Traits<q15> {
+    using Wide = int32_t;
+    static constexpr int kFracBits = 15;
+    static constexpr int kGuardBits = 0;
+    static constexpr int32_t kMax = INT16_MAX;
+    static constexpr int32_t kMin = INT16_MIN;
+};
+
+template <>
+struct Traits<q31> {
+    using Wide = int64_t;
+    static constexpr int kFracBits = 31;
+    static constexpr int kGuardBits = 8;
+    static constexpr int64_t kMax = INT32_MAX;
+    static constexpr int64_t kMin = INT32_MIN;
+};
+
+// 宽类型饱和到 T
+template <typename T, typename W>
+inline T saturate(W value) {
+    return static_cast<T>(std::min<W>(std::max<W>(value, Traits<T>::kMin), Traits<T>::kMax));
+}
+
+// 宽类型四舍五入右移 shift 位(shift > 0)
+template <typename W>
+inline W roundShift(W value, int shift) {
+    return (value + (W(1) << (shift - 1))) >> shift;
+}
+
+// 定点乘法: a·b, 结果仍为 T 的 Q 格式(四舍五入并饱和)
+template <typename T>
+inline T multiply(T a, T b) {
+    using W = typename Traits<T>::Wide;
+    return saturate<T>(roundShift<W>(static_cast<W>(a) * b, Traits<T>::kFracBits));
+}
+
+// 浮点 → 定点(四舍五入并饱和), 浮点值按 [-1, 1) 解释; 以 double 计算, q31 不会受 float 精度限制
+template <typename T>
+inline T fromFloat(double value) {
+    const double scaled = std::nearbyint(value * std::ldexp(1.0, Traits<T>::kFracBits));
+    return static_cast<T>(std::min<double>(std::max<double>(scaled, Traits<T>::kMin), Traits<T>::kMax));
+}
+
+// 定点 → 浮点
+template <typename T>
+inline float toFloat(T value) {
+    return static_cast<float>(std::ldexp(static_cast<double>(value), -Traits<T>::kFracBits));
+}
+
+/**
+ * @brief 将 ADC 原始读数转换为定点样本(不经过浮点)
+ * 减去中点后左移到 T 的满量程，12 位 ADC 的 0..4095 对应 Q15 的 -32768..32752。
+ * @param raw ADC 原始读数
+ * @param count 样本数
+ * @param out 输出数组
+ * @param bits ADC 分辨率(位)
+ */
+template <typename T>
+inline void fromADC(const uint16_t *raw, size_t count, T *out, int bits = 12) {
+    const int32_t mid = 1 << (bits - 1);
+    const int shift = Traits<T>::kFracBits + 1 - bits;
+    for (size_t i = 0; i < count; ++i) {
+        const int32_t centered = static_cast<int32_t>(raw[i]) - mid;
+        out[i] = static_cast<T>(static_cast<typename Traits<T>::Wide>(centered) * (typename Traits<T>::Wide(1) << shift));
+    }
+}
+
+// 定点复数
+template <typename T>
+struct Complex {
+    T re = 0;
+    T im = 0;
+};
+}  // namespace fixed_point
+
+/**
+ * @brief 定点基 2 FFT(块浮点)
+ *
+ * 接口与 `FastFourierTransform` 相同：原地迭代、旋转因子按级缓存、`reserve()` 之后不再分配内存。
+ * 每一级蝶形运算前检查整块数据的最大幅值，余量不足时整块右移(最多 2 位)以避免溢出，
+ * 移位次数累计为块指数 `exponent()`：真实结果 = 输出 × 2^exponent(相对于输入的定点刻度)。
+ * 反变换的 1/n 也只计入块指数，不额外损失精度。
+ *
+ * @tparam T fixed_point::q15 或 fixed_point::q31
+ * @note 非线程安全。
+ */
+template <typename T>
+class FixedPointFFT {
+    static_assert(std::is_same<T, fixed_point::q15>::value || std::is_same<T, fixed_point::q31>::value, "FixedPointFFT 只支持 q15 与 q31");
+    using Traits = fixed_point::Traits<T>;
+    using Wide = typename Traits::Wide;
+
+   public:
+    using Complex = fixed_point::Complex<T>;
+
+    /**
+     * @brief 原地复数 FFT
+     * @param data 长度为 n 的复数数组, 结果覆盖输入
+     * @param n 变换长度, 必须是 2 的幂
+     * @param inverse false 为正变换, true 为反变换
+     * @return n 不是 2 的幂时返回 false 且不修改数据
+     */
+    bool transform(Complex *data, size_t n, bool inverse = false) {
+        if (!isPowerOfTwo(n)) return false;
+        reserve(n);
+        exponent_ = 0;
+        bitReversePermute(data, n);
+        butterflies(data, n, inverse);
+        if (inverse) exponent_ -= log2(n);
+        return true;
+    }
+    bool transform(std::vector<Complex> &data, bool inverse = false) { return transform(data.data(), data.size(), inverse); }
+
+    /**
+     * @brief 实数输入 FFT
+     * 与 `FastFourierTransform::realFFT` 相同的打包/拆分方法，输出 0..n/2 共 n/2+1 个频点，真实值同样需乘以 2^exponent()。
+     * @param input 长度为 n 的定点实数数组
+     * @param n 变换长度, 必须是 2 的幂且不小于 2
+     * @param output 至少能容纳 n/2+1 个复数
+     * @return n 不合法时返回 false
+     */
+    bool realFFT(const T *input, size_t n, Complex *output) {
+        if (n < 2 || !isPowerOfTwo(n)) return false;
+        reserve(n);
+        exponent_ = 0;
+
+        // 1. 打包为 n/2 点复数 FFT
+        const size_t half = n / 2;
+        for (size_t k = 0; k < half; ++k) output[k] = Complex{input[2 * k], input[2 * k + 1]};
+        bitReversePermute(output, half);
+        butterflies(output, half, false);
+
+        // 2. 拆分前保证余量: X[k] 的幅值不超过 (1+√2)·max
+        scaleForHeadroom(output, half);
+        const Complex *w = stageTwiddles(n);
+        const Complex z0 = output[0];
+        output[0] = Complex{fixed_point::saturate<T>(Wide(z0.re) + z0.im), 0};
+        output[half] = Complex{fixed_point::saturate<T>(Wide(z0.re) - z0.im), 0};
+        for (size_t k = 1; k <= half / 2; ++k) {
+            const Complex a = output[k], b = output[half - k];
+            // even = (a + conj(b)) / 2, odd = -i·(a - conj(b)) / 2
+            const Wide er = roundHalf(Wide(a.re) + b.re), ei = roundHalf(Wide(a.im) - b.im);
+            const Wide orr = roundHalf(Wide(a.im) + b.im), oi = roundHalf(Wide(b.re) - a.re);
+            const Wide tr = mulRe(orr, oi, w[k].re, w[k].im), ti = mulIm(orr, oi, w[k].re, w[k].im);
+            const Wide ur = mulRe(orr, -oi, w[half - k].re, w[half - k].im), ui = mulIm(orr, -oi, w[half - k].re, w[half - k].im);
+            output[k] = Complex{fixed_point::saturate<T>(er + tr), fixed_point::saturate<T>(ei + ti)};
+            output[half - k] = Complex{fixed_point::saturate<T>(er + ur), fixed_point::saturate<T>(-ei + ui)};
+        }
+        return true;
+    }
+    bool realFFT(const std::vector<T> &input, std::vector<Complex> &output) {
+        output.resize(input.size() / 2 + 1);
+        return realFFT(input.data(), input.size(), output.data());
+    }
+
+    /**
+     * @brief 预先计算长度不超过 n 的变换所需的旋转因子
+     * @param n 最大变换长度(2 的幂)
+     */
+    void reserve(size_t n) {
+        if (n <= table_size_) return;
+        twiddles_.resize(n - 1);
+        for (size_t half = 1; half < n; half <<= 1) {
+            for (size_t k = 0; k < half; ++k) {
+                const double angle = -3.14159265358979323846 * static_cast<double>(k) / static_cast<double>(half);
+                twiddles_[half - 1 + k] = Complex{fixed_point::fromFloat<T>(std::cos(angle)), fixed_point::fromFloat<T>(std::sin(angle))};
+            }
+        }
+        table_size_ = n;
+    }
+
+    // 最近一次变换的块指数: 真实结果 = 输出 × 2^exponent()
+    int exponent() const { return exponent_; }
+
+    static bool isPowerOfTwo(size_t n) { return n != 0 && (n & (n - 1)) == 0; }
+
+   private:
+    // 一级蝶形运算前要求 max < kHeadroom, 使 (1+√2)·max 不超过满量程
+    static constexpr Wide kHeadroom = static_cast<Wide>(Traits::kMax * 0.4);
+
+    static int log2(size_t n) {
+        int bits = 0;
+        while (n > 1) n >>= 1, ++bits;
+        return bits;
+    }
+
+    static Wide roundHalf(Wide value) { return (value + 1) >> 1; }
+
+    // (re + i·im)·(wr + i·wi) 的实部与虚部, 四舍五入到 Q 格式(旋转因子以宽类型传入, 取共轭时 -1 不会溢出)
+    static Wide mulRe(Wide re, Wide im, Wide wr, Wide wi) { return fixed_point::roundShift<Wide>(re * wr - im * wi, Traits::kFracBits); }
+    static Wide mulIm(Wide re, Wide im, Wide wr, Wide wi) { return fixed_point::roundShift<Wide>(re * wi + im * wr, Traits::kFracBits); }
+
+    const Complex *stageTwiddles(size_t len) const { return twiddles_.data() + (len / 2 - 1); }
+
+    // 整块数据的最大幅值不小于 kHeadroom 时整块右移, 并计入块指数
+    void scaleForHeadroom(Complex *data, size_t n) {
+        Wide peak = 0;
+        for (size_t i = 0; i < n; ++i) peak = std::max(peak, std::max(std::abs(Wide(data[i].re)), std::abs(Wide(data[i].im))));
+        int shift = 0;
+        while ((peak >> shift) >= kHeadroom) ++shift;
+        if (shift == 0) return;
+        for (size_t i = 0; i < n; ++i) {
+            data[i].re = static_cast<T>(fixed_point::roundShift<Wide>(data[i].re, shift));
+            data[i].im = static_cast<T>(fixed_point::roundShift<Wide>(data[i].im, shift));
+        }
+        exponent_ += shift;
+    }
+
+    static void bitReversePermute(Complex *data, size_t n) {
+        for (size_t i = 1, j = 0; i < n; ++i) {
+            size_t bit = n >> 1;
+            for (; j & bit; bit >>= 1) j ^= bit;
+            j ^= bit;
+            if (i < j) std::swap(data[i], data[j]);
+        }
+    }
+
+    void butterflies(Complex *data, size_t n, bool inverse) {
+        for (size_t len = 2; len <= n; len <<= 1) {
+            scaleForHeadroom(data, n);
+            const size_t half = len >> 1;
+            const Complex *w = stageTwiddles(len);
+            for (size_t start = 0; start < n; start += len) {
+                Complex *a = data + start;
+                Complex *b = a + half;
+                for (size_t k = 0; k < half; ++k) {
+                    const Wide wr = w[k].re, wi = inverse ? -Wide(w[k].im) : Wide(w[k].im);
+                    const Wide tr = mulRe(b[k].re, b[k].im, wr, wi), ti = mulIm(b[k].re, b[k].im, wr, wi);
+                    b[k] = Complex{fixed_point::saturate<T>(Wide(a[k].re) - tr), fixed_point::saturate<T>(Wide(a[k].im) - ti)};
+                    a[k] = Complex{fixed_point::saturate<T>(Wide(a[k].re) + tr), fixed_point::saturate<T>(Wide(a[k].im) + ti)};
+                }
+            }
+        }
+    }
+
+    std::vector<Complex> twiddles_;  // 按级存放的定点旋转因子
+    size_t table_size_ = 0;
+    int exponent_ = 0;
+};
+
+/**
+ * @brief 定点 FIR 滤波器
+ *
+ * 系数与样本均为 T 的 Q 格式，乘积在 int64_t 中累加，最后四舍五入并饱和。
+ * q31 的乘积先右移 kGuardBits 位再累加，满量程输入下最多 511 阶不会溢出，舍去的低位远小于 1 LSB。
+ * 延迟线长度为 2×taps，每个样本同时写入两处，卷积始终在一段连续内存上进行，无需取模。
+ *
+ * @tparam T fixed_point::q15 或 fixed_point::q31
+ */
+template <typename T>
+class FixedPointFIR {
+    using Acc = int64_t;
+    static constexpr int kGuardBits = fixed_point::Traits<T>::kGuardBits;
+
+   public:
+    explicit FixedPointFIR(const std::vector<T> &coefficients) : coeffs_(coefficients.rbegin(), coefficients.rend()), delay_(2 * std::max<size_t>(1, coefficients.size()), 0) {
+        if (coeffs_.empty()) coeffs_.push_back(0);
+    }
+
+    // 由浮点系数构造(系数按 [-1, 1) 量化)
+    static FixedPointFIR fromFloat(const std::vector<float> &coefficients) {
+        std::vector<T> q(coefficients.size());
+        for (size_t i = 0; i < q.size(); ++i) q[i] = fixed_point::fromFloat<T>(coefficients[i]);
+        return FixedPointFIR(q);
+    }
+
+    T process(T sample) {
+        const size_t taps = coeffs_.size();
+        delay_[pos_] = delay_[pos_ + taps] = sample;
+        pos_ = (pos_ + 1 == taps) ? 0 : pos_ + 1;
+
+        // delay_[pos_ .. pos_+taps) 依次为最旧到最新的样本, 系数已按相反顺序存放
+        const T *x = delay_.data() + pos_;
+        Acc acc = 0;
+        for (size_t i = 0; i < taps; ++i) acc += (static_cast<Acc>(coeffs_[i]) * x[i]) >> kGuardBits;
+        return fixed_point::saturate<T>(fixed_point::roundShift<Acc>(acc, fixed_point::Traits<T>::kFracBits - kGuardBits));
+    }
+
+    // 块处理, in 与 out 可以是同一数组
+    void process(const T *in, T *out, size_t count) {
+        for (size_t i = 0; i < count; ++i) out[i] = process(in[i]);
+    }
+
+    void reset() {
+        std::fill(delay_.begin(), delay_.end(), 0);
+        pos_ = 0;
+    }
+
+   private:
+    std::vector<T> coeffs_;  // 倒序存放的系数
+    std::vector<T> delay_;   // 双倍长度的延迟线
+    size_t pos_ = 0;         // 最旧样本的位置
+};
+
+/**
+ * @brief 定点二阶 IIR(直接 I 型 biquad)
+ *
+ * 传递函数 H(z) = (b0 + b1·z⁻¹ + b2·z⁻²) / (1 + a1·z⁻¹ + a2·z⁻²)。
+ * 系数常超出 [-1, 1)，因此以少 1 位小数的格式(q15 为 Q2.14，q31 为 Q2.30)存放，取值范围 [-2, 2)。
+ * 直接 I 型的状态为输入/输出样本本身，累加在 int64_t 中进行(q31 同样预留 kGuardBits 位保护位)，只在输出时舍入一次。
+ *
+ * @tparam T fixed_point::q15 或 fixed_point::q31
+ */
+template <typename T>
+class FixedPointBiquad {
+    using Acc = int64_t;
+    static constexpr int kCoeffFracBits = fixed_point::Traits<T>::kFracBits - 1;
+    static constexpr int kGuardBits = fixed_point::Traits<T>::kGuardBits;
+
+   public:
+    // 由浮点系数构造(a0 已归一化为 1)
+    FixedPointBiquad(float b0, float b1, float b2, float a1, float a2) {
+        const double scale = std::ldexp(1.0, kCoeffFracBits);
+        const float coeffs[5] = {b0, b1, b2, -a1, -a2};
+        for (int i = 0; i < 5; ++i) {
+            const double q = std::nearbyint(static_cast<double>(coeffs[i]) * scale);
+            coeffs_[i] = static_cast<T>(std::min<double>(std::max<double>(q, fixed_point::Traits<T>::kMin), fixed_point::Traits<T>::kMax));
+        }
+    }
+
+    T process(T x) {
+        const Acc acc = ((static_cast<Acc>(coeffs_[0]) * x) >> kGuardBits) + ((static_cast<Acc>(coeffs_[1]) * x1_) >> kGuardBits) +
+                        ((static_cast<Acc>(coeffs_[2]) * x2_) >> kGuardBits) + ((static_cast<Acc>(coeffs_[3]) * y1_) >> kGuardBits) +
+                        ((static_cast<Acc>(coeffs_[4]) * y2_) >> kGuardBits);
+        const T y = fixed_point::saturate<T>(fixed_point::roundShift<Acc>(acc, kCoeffFracBits - kGuardBits));
+        x2_ = x1_;
+        x1_ = x;
+        y2_ = y1_;
+        y1_ = y;
+        return y;
+    }
+
+    // 块处理, in 与 out 可以是同一数组
+    void process(const T *in, T *out, size_t count) {
+        for (size_t i = 0; i < count; ++i) out[i] = process(in[i]);
+    }
+
+    void reset() { x1_ = x2_ = y1_ = y2_ = 0; }
+
+   private:
+    T coeffs_[5] = {};  // b0, b1, b2, -a1, -a2 (Q2.14 / Q2.30)
+    T x1_ = 0, x2_ = 0, y1_ = 0, y2_ = 0;
+};
@@ -26,128 +26,426 @@
 #include <algorithm>
 #include <cmath>
 #include <complex>
+#include <cstdint>
 #include <vector>
 
+#if defined(ESP_PLATFORM) && __has_include(<sdkconfig.h>)
+#include <sdkconfig.h>
+#endif
+
+/*
+ * 蝶形运算与 DFT 累加核按编译目标在编译期选择:
+ * - ESP32-S3 上框架提供 esp-dsp 组件时, 复数 FFT 交给 esp-dsp 的 dsps_fft2r_fc32(S3 上为使用 PIE 向量指令的汇编实现),
+ *   超出 esp-dsp 旋转因子表长度(CONFIG_DSP_MAX_FFT_SIZE)的变换与 DFT 累加仍使用标量核;
+ * - 主机端开启 AVX(-mavx 或 -march=native)时使用 256 位 AVX 核, 每次处理 4 个复数;
+ * - 其余 x86-64 主机使用 128 位 SSE2 核(x86-64 的基础指令集), 每次处理 2 个复数;
+ * - ESP32 等其他目标使用标量核, 其循环按连续数组编写, 编译器可以自动向量化。
+ * 定义 FFT_FORCE_SCALAR 可以强制使用标量核(用于对照测试)。
+ */
+#if !defined(FFT_FORCE_SCALAR) && defined(CONFIG_IDF_TARGET_ESP32S3) && __has_include(<esp_dsp.h>)
+#define FFT_KERNEL_ESP_DSP
+#include <esp_dsp.h>
+#ifndef CONFIG_DSP_MAX_FFT_SIZE
+#define CONFIG_DSP_MAX_FFT_SIZE 4096
+#endif
+#elif !defined(FFT_FORCE_SCALAR) && defined(__AVX__)
+#define FFT_KERNEL_AVX
+#include <immintrin.h>
+#elif !defined(FFT_FORCE_SCALAR) && (defined(__SSE2__) || defined(_M_X64))
+#define FFT_KERNEL_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace fft_kernel {
+using Complex = std::complex<float>;
+
+// 当前编译目标使用的核
+inline const char *name() {
+#if defined(FFT_KERNEL_ESP_DSP)
+    return "esp-dsp";
+#elif defined(FFT_KERNEL_AVX)
+    return "avx";
+#elif defined(FFT_KERNEL_SSE2)
+    return "sse2";
+#else
+    return "scalar";
+#endif
+}
+
+/**
+ * @brief 一组蝶形运算的标量参考实现: a[k], b[k] ← a[k] ± w[k]·b[k]
+ * @param a 上半部分
+ * @param b 下半部分
+ * @param w 连续的旋转因子
+ * @param count 蝶形个数
+ * @param inverse 使用共轭旋转因子
+ */
+inline void butterflyScalar(Complex *a, Complex *b, const Complex *w, size_t count, bool inverse) {
+    for (size_t k = 0; k < count; ++k) {
+        const Complex wk = inverse ? std::conj(w[k]) : w[k];
+        const Complex t = wk * b[k];
+        b[k] = a[k] - t;
+        a[k] += t;
+    }
+}
+
+// 一组蝶形运算(std::complex<float> 与 float[2] 布局兼容, 按交错的实部/虚部直接装载)
+inline void butterfly(Complex *a, Complex *b, const Complex *w, size_t count, bool inverse) {
+    size_t k = 0;
+#if defined(FFT_KERNEL_AVX)
+    const __m256 conj = inverse ? _mm256_set1_ps(-0.0f) : _mm256_setzero_ps();
+    for (; k + 4 <= count; k += 4) {
+        float *pa = reinterpret_cast<float *>(a + k);
+        float *pb = reinterpret_cast<float *>(b + k);
+        const __m256 va = _mm256_loadu_ps(pa), vb = _mm256_loadu_ps(pb);
+        const __m256 vw = _mm256_loadu_ps(reinterpret_cast<const float *>(w + k));
+        const __m256 wr = _mm256_moveldup_ps(vw);                     // (wr, wr)
+        const __m256 wi = _mm256_xor_ps(_mm256_movehdup_ps(vw), conj);  // (wi, wi)
+        const __m256 bs = _mm256_permute_ps(vb, 0xB1);                // (bi, br)
+        const __m256 t = _mm256_addsub_ps(_mm256_mul_ps(vb, wr), _mm256_mul_ps(bs, wi));
+        _mm256_storeu_ps(pa, _mm256_add_ps(va, t));
+        _mm256_storeu_ps(pb, _mm256_sub_ps(va, t));
+    }
+#elif defined(FFT_KERNEL_SSE2)
+    const __m128 conj = inverse ? _mm_set1_ps(-0.0f) : _mm_setzero_ps();
+    const __m128 negReal = _mm_set_ps(0.0f, -0.0f, 0.0f, -0.0f);  // 对实部位置取反, 代替 SSE3 的 addsub
+    for (; k + 2 <= count; k += 2) {
+        float *pa = reinterpret_cast<float *>(a + k);
+        float *pb = reinterpret_cast<float *>(b + k);
+        const __m128 va = _mm_loadu_ps(pa), vb = _mm_loadu_ps(pb);
+        const __m128 vw = _mm_loadu_ps(reinterpret_cast<const float *>(w + k));
+        const __m128 wr = _mm_shuffle_ps(vw, vw, _MM_SHUFFLE(2, 2, 0, 0));
+        const __m128 wi = _mm_xor_ps(_mm_shuffle_ps(vw, vw, _MM_SHUFFLE(3, 3, 1, 1)), conj);
+        const __m128 bs = _mm_shuffle_ps(vb, vb, _MM_SHUFFLE(2, 3, 0, 1));
+        const __m128 t = _mm_add_ps(_mm_mul_ps(vb, wr), _mm_xor_ps(_mm_mul_ps(bs, wi), negReal));
+        _mm_storeu_ps(pa, _mm_add_ps(va, t));
+        _mm_storeu_ps(pb, _mm_sub_ps(va, t));
+    }
+#endif
+    butterflyScalar(a + k, b + k, w + k, count - k, inverse);
+}
+
+/**
+ * @brief DFT 的一步累加(分离存储的实部/虚部)
+ * 对每个频点 k: y[k] += x·p[k]，然后相量前进一步 p[k] ← p[k]·c[k]。
+ * @param yr, yi 频谱累加值
+ * @param pr, pi 各频点当前的相量 W^{kn}
+ * @param cr, ci 各频点每步的旋转 W^k
+ * @param xr, xi 当前样本
+ * @param count 频点个数
+ */
+inline void dftAccumulateScalar(float *yr, float *yi, float *pr, float *pi, const float *cr, const float *ci, float xr, float xi, size_t count) {
+    for (size_t k = 0; k < count; ++k) {
+        yr[k] += xr * pr[k] - xi * pi[k];
+        yi[k] += xr * pi[k] + xi * pr[k];
+        const float r = pr[k] * cr[k] - pi[k] * ci[k];
+        pi[k] = pr[k] * ci[k] + pi[k] * cr[k];
+        pr[k] = r;
+    }
+}
+
+inline void dftAccumulate(float *yr, float *yi, float *pr, float *pi, const float *cr, const float *ci, float xr, float xi, size_t count) {
+    size_t k = 0;
+#if defined(FFT_KERNEL_AVX)
+    const __m256 vxr = _mm256_set1_ps(xr), vxi = _mm256_set1_ps(xi);
+    for (; k + 8 <= count; k += 8) {
+        const __m256 vpr = _mm256_loadu_ps(pr + k), vpi = _mm256_loadu_ps(pi + k);
+        const __m256 vcr = _mm256_loadu_ps(cr + k), vci = _mm256_loadu_ps(ci + k);
+        _mm256_storeu_ps(yr + k, _mm256_add_ps(_mm256_loadu_ps(yr + k), _mm256_sub_ps(_mm256_mul_ps(vxr, vpr), _mm256_mul_ps(vxi, vpi))));
+        _mm256_storeu_ps(yi + k, _mm256_add_ps(_mm256_loadu_ps(yi + k), _mm256_add_ps(_mm256_mul_ps(vxr, vpi), _mm256_mul_ps(vxi, vpr))));
+        _mm256_storeu_ps(pr + k, _mm256_sub_ps(_mm256_mul_ps(vpr, vcr), _mm256_mul_ps(vpi, vci)));
+        _mm256_storeu_ps(pi + k, _mm256_add_ps(_mm256_mul_ps(vpr, vci), _mm256_mul_ps(vpi, vcr)));
+    }
+#elif defined(FFT_KERNEL_SSE2)
+    const __m128 vxr = _mm_set1_ps(xr), vxi = _mm_set1_ps(xi);
+    for (; k + 4 <= count; k += 4) {
+        const __m128 vpr = _mm_loadu_ps(pr + k), vpi = _mm_loadu_ps(pi + k);
+        const __m128 vcr = _mm_loadu_ps(cr + k), vci = _mm_loadu_ps(ci + k);
+        _mm_storeu_ps(yr + k, _mm_add_ps(_mm_loadu_ps(yr + k), _mm_sub_ps(_mm_mul_ps(vxr, vpr), _mm_mul_ps(vxi, vpi))));
+        _mm_storeu_ps(yi + k, _mm_add_ps(_mm_loadu_ps(yi + k), _mm_add_ps(_mm_mul_ps(vxr, vpi), _mm_mul_ps(vxi, vpr))));
+        _mm_storeu_ps(pr + k, _mm_sub_ps(_mm_mul_ps(vpr, vcr), _mm_mul_ps(vpi, vci)));
+        _mm_storeu_ps(pi + k, _mm_add_ps(_mm_mul_ps(vpr, vci), _mm_mul_ps(vpi, vcr)));
+    }
+#endif
+    dftAccumulateScalar(yr + k, yi + k, pr + k, pi + k, cr + k, ci + k, xr, xi, count - k);
+}
+}  // namespace fft_kernel
+
+/**
+ * @brief 基 2 快速傅里叶变换
+ *
+ * 原地迭代实现：先按位反转顺序重排，再逐级做蝶形运算，不递归、不分配临时数组。
+ * 旋转因子按级连续存放(长度为 len 的一级使用 W_len^0..W_len^{len/2-1})，与变换长度无关，
+ * 表按遇到的最大变换长度计算一次并缓存，较短的变换直接复用。蝶形运算由 `fft_kernel::butterfly` 完成，
+ * 主机端使用 SSE2/AVX 向量核，ESP32-S3 上交给 esp-dsp。在 `reserve()` 之后(或第一次变换之后)，同长度及更短的变换不再分配任何内存。
+ *
+ * @note 旋转因子表属于对象本身，非线程安全；多个任务并发变换时应各自持有一个对象。
+ */
 class FastFourierTransform {
    public:
+    using Complex = std::complex<float>;
+
     /**
      * @brief 快速傅里叶变换
+     * 长度不是 2 的幂时在末尾补零到下一个 2 的幂。
      * @param input_sequence std::vector<float>类型实数域数据
      * @param inverse false 为正变换, true 为反变换(默认为正变换)
+     * @return 变换结果(长度为补零后的长度)
      */
-    std::vector<std::complex<float>> FFT(std::vector<float> input_sequence, bool inverse = false) {
-        /*
-         * 首先，n & (n - 1) 的结果为0，当且仅当n是2的幂次方。如果n是2的幂次方，则m直接取n，不需要进行补零或截断操作。
-         * 否则，m需要取离n最近的较小的2的幂次方或较大的2的幂次方。
-         * 使用 builtin_clz 函数来计算n的二进制表示中前导零的个数，然后通过移位运算来得到最接近的2的幂次方。
-         * 最后，使用三目运算符来判断是否需要进行补零或截断操作，直接resize到m即可。
-         */
-        uint32_t n = input_sequence.size();
-        uint32_t m = n & (n - 1) ? 1 << (32 - CountLeadingZeros(n)) : n;
-        input_sequence.resize(std::min(m, n));
+    std::vector<Complex> FFT(const std::vector<float> &input_sequence, bool inverse = false) {
+        // 这里将实数域转为复数域, 并补零到 2 的幂;
+        std::vector<Complex> data(nextPowerOfTwo(input_sequence.size()));
+        std::copy(input_sequence.begin(), input_sequence.end(), data.begin());
 
-        // 这里将实数域转为复数域;
-        std::vector<std::complex<float>> data(input_sequence.begin(), input_sequence.end());
+        transform(data.data(), data.size(), inverse);
+        return data;
+    }
 
-        // 若反转为 false 则进行FFT正变换, 若反转为 true 则进行FFT逆变换;
-        inverse == false ? fast_fourier_transform(data) : inverse_fast_fourier_transform(data);
+    /**
+     * @brief 原地复数 FFT
+     * @param data 长度为 n 的复数数组, 结果覆盖输入
+     * @param n 变换长度, 必须是 2 的幂
+     * @param inverse false 为正变换, true 为反变换(结果已除以 n)
+     * @return n 不是 2 的幂时返回 false 且不修改数据
+     */
+    bool transform(Complex *data, size_t n, bool inverse = false) { return run(data, n, inverse, fft_kernel::butterfly); }
+    bool transform(std::vector<Complex> &data, bool inverse = false) { return transform(data.data(), data.size(), inverse); }
 
-        return data;
+    /**
+     * @brief 与 transform() 相同, 但始终使用标量蝶形核
+     * 用作向量核的对照参考。
+     */
+    bool transformReference(Complex *data, size_t n, bool inverse = false) { return run(data, n, inverse, fft_kernel::butterflyScalar); }
+
+    /**
+     * @brief 实数输入 FFT
+     * 将 n 个实数两两打包为 n/2 个复数做一次 n/2 点 FFT，再拆分出实数序列的频谱，计算量约为复数 FFT 的一半。
+     * 实数序列的频谱共轭对称，只输出 0..n/2 共 n/2+1 个频点。
+     * @param input 长度为 n 的实数数组
+     * @param n 变换长度, 必须是 2 的幂且不小于 2
+     * @param output 至少能容纳 n/2+1 个复数, 可以与 input 不重叠的任意缓冲区
+     * @return n 不合法时返回 false
+     */
+    bool realFFT(const float *input, size_t n, Complex *output) {
+        if (n < 2 || !isPowerOfTwo(n)) return false;
+        reserve(n);
+
+        // 1. 打包: z[k] = x[2k] + i·x[2k+1], 做 n/2 点 FFT
+        const size_t half = n / 2;
+        for (size_t k = 0; k < half; ++k) output[k] = Complex(input[2 * k], input[2 * k + 1]);
+        forward(output, half);
+
+        // 2. 拆分: X[k] = (Z[k] + conj(Z[h-k])) / 2 - i·W^k·(Z[k] - conj(Z[h-k])) / 2
+        const Complex *w = stageTwiddles(n);
+        const Complex z0 = output[0];
+        output[0] = Complex(z0.real() + z0.imag(), 0.0f);
+        output[half] = Complex(z0.real() - z0.imag(), 0.0f);
+        for (size_t k = 1; k <= half / 2; ++k) {
+            const Complex a = output[k], b = std::conj(output[half - k]);
+            const Complex even = 0.5f * (a + b);
+            const Complex odd = Complex(0.0f, -0.5f) * (a - b);
+            output[k] = even + w[k] * odd;
+            output[half - k] = std::conj(even) + w[half - k] * std::conj(odd);  // 对称位置 h-k 的值由同一对 Z 得到
+        }
+        return true;
+    }
+    bool realFFT(const std::vector<float> &input, std::vector<Complex> &output) {
+        output.resize(input.size() / 2 + 1);
+        return realFFT(input.data(), input.size(), output.data());
+    }
+
+    /**
+     * @brief 预先计算长度不超过 n 的变换所需的旋转因子
+     * 在实时路径之外调用一次，之后的变换不再分配内存。
+     * @param n 最大变换长度(2 的幂)
+     */
+    void reserve(size_t n) {
+        if (n <= table_size_) return;
+
+        // 各级依次存放, 长度为 len 的一级从下标 len/2-1 开始, 共 n-1 个
+        twiddles_.resize(n - 1);
+        for (size_t half = 1; half < n; half <<= 1) {
+            for (size_t k = 0; k < half; ++k) {
+                const double angle = -kPi * static_cast<double>(k) / static_cast<double>(half);  // 用 double 计算, 避免大 n 时的累积误差
+                twiddles_[half - 1 + k] = Complex(static_cast<float>(std::cos(angle)), static_cast<float>(std::sin(angle)));
+            }
+        }
+        table_size_ = n;
+    }
+
+    // 当前编译目标使用的蝶形核("esp-dsp"/"avx"/"sse2"/"scalar")
+    static const char *kernelName() { return fft_kernel::name(); }
+
+    static bool isPowerOfTwo(size_t n) { return n != 0 && (n & (n - 1)) == 0; }
+
+    // 不小于 n 的最小 2 的幂
+    static size_t nextPowerOfTwo(size_t n) {
+        size_t m = 1;
+        while (m < n) m <<= 1;
+        return m;
     }
 
    private:
-    // 计算一个32位无符号整数的二进制表示中前导零的个数;
-    static uint32_t CountLeadingZeros(uint32_t x) {
-        uint32_t n = 0;
-        if (x == 0) return 32;
-        if (x <= 0x0000FFFF) n += 16, x <<= 16;
-        if (x <= 0x00FFFFFF) n += 8, x <<= 8;
-        if (x <= 0x0FFFFFFF) n += 4, x <<= 4;
-        if (x <= 0x3FFFFFFF) n += 2, x <<= 2;
-        if (x <= 0x7FFFFFFF) n += 1;
-        return n;
-    }
-
-    // 快速傅里叶变换
-    static void fast_fourier_transform(std::vector<std::complex<float>> &input_sequence) {
-        const uint32_t sequence_size = input_sequence.size();
-
-        // 如果序列长度小于等于1，则不需要继续计算
-        if (sequence_size <= 1) return;
-
-        // 缓存计算结果，避免重复计算
-        std::vector<std::complex<float>> even_sequence(sequence_size / 2), odd_sequence(sequence_size / 2);
-        for (uint32_t i = 0; i < sequence_size / 2; ++i) {
-            even_sequence[i] = input_sequence[2 * i];     // 偶数序列
-            odd_sequence[i] = input_sequence[2 * i + 1];  // 奇数序列
+    using Butterfly = void (*)(Complex *, Complex *, const Complex *, size_t, bool);
+
+    static constexpr double kPi = 3.14159265358979323846;
+
+    bool run(Complex *data, size_t n, bool inverse, Butterfly kernel) {
+        if (!isPowerOfTwo(n)) return false;
+#if defined(FFT_KERNEL_ESP_DSP)
+        if (kernel == fft_kernel::butterfly && espDspTransform(data, n, inverse)) return true;
+#endif
+        reserve(n);
+        bitReversePermute(data, n);
+        butterflies(data, n, inverse, kernel);
+
+        if (inverse) {
+            const float scale = 1.0f / static_cast<float>(n);
+            for (size_t i = 0; i < n; ++i) data[i] *= scale;
         }
+        return true;
+    }
+
+    // 原地正变换(不缩放), 调用前已 reserve(n)
+    void forward(Complex *data, size_t n) {
+#if defined(FFT_KERNEL_ESP_DSP)
+        if (espDspTransform(data, n, false)) return;
+#endif
+        bitReversePermute(data, n);
+        butterflies(data, n, false, fft_kernel::butterfly);
+    }
+
+#if defined(FFT_KERNEL_ESP_DSP)
+    /**
+     * @brief 使用 esp-dsp 做原地复数 FFT
+     * esp-dsp 只提供正变换, 反变换按 IFFT(x) = conj(FFT(conj(x))) / n 计算。
+     * esp-dsp 的旋转因子表是全局的, 首次调用时初始化一次(已被其他代码初始化时直接复用)。
+     * @return esp-dsp 不可用或 n 超出其旋转因子表时返回 false, 由调用者回退到标量核
+     */
+    static bool espDspTransform(Complex *data, size_t n, bool inverse) {
+        static const bool ready = [] {
+            esp_err_t err = dsps_fft2r_init_fc32(nullptr, CONFIG_DSP_MAX_FFT_SIZE);
+            return err == ESP_OK || err == ESP_ERR_DSP_REINITIALIZED;
+        }();
+        if (!ready || n < 2 || n > CONFIG_DSP_MAX_FFT_SIZE) return false;
+
+        float *samples = reinterpret_cast<float *>(data);  // std::complex<float> 与交错的 float[2] 布局兼容
+        if (inverse)
+            for (size_t i = 0; i < n; ++i) data[i] = std::conj(data[i]);
+        dsps_fft2r_fc32(samples, static_cast<int>(n));
+        dsps_bit_rev_fc32(samples, static_cast<int>(n));
+        if (inverse) {
+            const float scale = 1.0f / static_cast<float>(n);
+            for (size_t i = 0; i < n; ++i) data[i] = std::conj(data[i]) * scale;
+        }
+        return true;
+    }
+#endif
+
+    // 长度为 len 的一级使用的旋转因子 W_len^k, k ∈ [0, len/2)
+    const Complex *stageTwiddles(size_t len) const { return twiddles_.data() + (len / 2 - 1); }
 
-        // 递归计算偶数和奇数序列的FFT
-        fast_fourier_transform(even_sequence);
-        fast_fourier_transform(odd_sequence);
-
-        // 合并偶数和奇数序列的FFT结果
-        const auto twiddle_factor = std::polar(1.0, -2 * PI / sequence_size);
-        std::complex<float> factor(1, 0);
-        for (uint32_t i = 0; i < sequence_size / 2; ++i) {
-            input_sequence[i] = even_sequence[i] + factor * odd_sequence[i];
-            input_sequence[i + sequence_size / 2] = even_sequence[i] - factor * odd_sequence[i];
-            factor *= twiddle_factor;  // 更新旋转因子
+    // 按位反转顺序原地重排(逐次递增反转后的下标, 不需要查表)
+    static void bitReversePermute(Complex *data, size_t n) {
+        for (size_t i = 1, j = 0; i < n; ++i) {
+            size_t bit = n >> 1;
+            for (; j & bit; bit >>= 1) j ^= bit;
+            j ^= bit;
+            if (i < j) std::swap(data[i], data[j]);
         }
     }
 
-    // 快速傅里叶逆变换
-    static void inverse_fast_fourier_transform(std::vector<std::complex<float>> &input_sequence) {
-        // 先计算FFT，然后对结果取共轭并除以n即可得到逆变换的结果
-        fast_fourier_transform(input_sequence);
-        const uint32_t sequence_size = input_sequence.size();
-        for (auto &element : input_sequence) {
-            element = std::conj(element) * static_cast<float>(1.0 / sequence_size);  // 取共轭并除以n
+    // 逐级蝶形运算, 每一组的旋转因子在表中连续
+    void butterflies(Complex *data, size_t n, bool inverse, Butterfly kernel) const {
+        for (size_t len = 2; len <= n; len <<= 1) {
+            const size_t half = len >> 1;
+            const Complex *w = stageTwiddles(len);
+            for (size_t start = 0; start < n; start += len) kernel(data + start, data + start + half, w, half, inverse);
         }
     }
+
+    std::vector<Complex> twiddles_;  // 按级存放的旋转因子, 覆盖长度不超过 table_size_ 的变换
+    size_t table_size_ = 0;          // 旋转因子表支持的最大变换长度
 };
 
+/**
+ * @brief 离散傅里叶变换(任意长度)
+ *
+ * 对每个样本 n，所有频点的相量 W^{kn} 同时前进一步，内层循环在连续的实部/虚部数组上进行，
+ * 由 `fft_kernel::dftAccumulate` 向量化；每隔 kResyncInterval 个样本从精确的余弦表重置相量，限制累积误差。
+ * 中间数组缓存在对象中，同一长度重复变换时不再分配内存(返回值除外)。
+ *
+ * @note 非线程安全。长度为 2 的幂时应使用 `FastFourierTransform`。
+ */
 class DiscreteFourierTransform {
    public:
-    std::vector<std::complex<float>> DFT(std::vector<float> input_sequence, bool inverse = false) {
-        // 这里将实数域转为复数域;
-        std::vector<std::complex<float>> data(input_sequence.begin(), input_sequence.end());
+    using Complex = std::complex<float>;
 
-        // 若反转为 false 则进行DFT正变换, 若反转为 true 则进行DFT逆变换;
-        if (inverse == false)
-            return discrete_fourier_transform(data);
-        else
-            return inverse_discrete_fourier_transform(data);
+    std::vector<Complex> DFT(std::vector<float> input_sequence, bool inverse = false) {
+        // 这里将实数域转为复数域;
+        std::vector<Complex> data(input_sequence.begin(), input_sequence.end());
+        std::vector<Complex> output(data.size());
+        transform(data.data(), output.data(), data.size(), inverse);
+        return output;
     }
 
-   private:
-    // 计算离散傅里叶变换
-    std::vector<std::complex<float>> discrete_fourier_transform(const std::vector<std::complex<float>> &input_vector) const {
-        uint32_t N = input_vector.size();
-        std::vector<std::complex<float>> output_vector(N);
-        for (uint32_t k = 0; k < N; k++) {
-            // 对于每个频率 k，计算对应的和
-            for (uint32_t n = 0; n < N; n++) {
-                // 对于每个样本 n，计算频率为 k 的分量
-                output_vector[k] += input_vector[n] * std::exp(std::complex<float>(0, -2 * M_PI * k * n / N));
-            }
+    /**
+     * @brief 复数 DFT
+     * @param input 长度为 n 的输入
+     * @param output 长度为 n 的输出, 不能与 input 重叠
+     * @param n 变换长度
+     * @param inverse false 为正变换, true 为反变换(结果已除以 n)
+     */
+    void transform(const Complex *input, Complex *output, size_t n, bool inverse = false) {
+        if (n == 0) return;
+        prepare(n);
+        const float sign = inverse ? 1.0f : -1.0f;
+
+        std::fill(yr_.begin(), yr_.end(), 0.0f);
+        std::fill(yi_.begin(), yi_.end(), 0.0f);
+        for (size_t k = 0; k < n; ++k) {
+            cr_[k] = cos_[k];
+            ci_[k] = sign * sin_[k];
         }
-        return output_vector;
-    }
-
-    // 计算离散傅里叶逆变换
-    std::vector<std::complex<float>> inverse_discrete_fourier_transform(const std::vector<std::complex<float>> &input_vector) const {
-        uint32_t N = input_vector.size();
-        std::vector<std::complex<float>> output_vector(N);
-        for (uint32_t n = 0; n < N; n++) {
-            // 对于每个样本 n，计算对应的和
-            for (uint32_t k = 0; k < N; k++) {
-                // 对于每个频率 k，计算样本为 n 的分量
-                output_vector[n] += input_vector[k] * std::exp(std::complex<float>(0, 2 * M_PI * k * n / N));
+
+        for (size_t j = 0; j < n; ++j) {
+            // 定期从余弦表重置相量 W^{kj}
+            if (j % kResyncInterval == 0) {
+                size_t m = 0;  // (k·j) mod n, 逐次累加避免乘法溢出
+                for (size_t k = 0; k < n; ++k) {
+                    pr_[k] = cos_[m];
+                    pi_[k] = sign * sin_[m];
+                    m += j;
+                    if (m >= n) m -= n;
+                }
             }
-            // 对和进行缩放，得到正确的输出
-            output_vector[n] /= N;
+            fft_kernel::dftAccumulate(yr_.data(), yi_.data(), pr_.data(), pi_.data(), cr_.data(), ci_.data(), input[j].real(), input[j].imag(), n);
+        }
+
+        const float scale = inverse ? 1.0f / static_cast<float>(n) : 1.0f;
+        for (size_t k = 0; k < n; ++k) output[k] = Complex(yr_[k] * scale, yi_[k] * scale);
+    }
+
+   private:
+    static constexpr size_t kResyncInterval = 32;
+
+    // 按长度 n 准备余弦/正弦表与中间数组
+    void prepare(size_t n) {
+        if (n == size_) return;
+        size_ = n;
+        cos_.resize(n);
+        sin_.resize(n);
+        for (size_t m = 0; m < n; ++m) {
+            const double angle = 2.0 * 3.14159265358979323846 * static_cast<double>(m) / static_cast<double>(n);
+            cos_[m] = static_cast<float>(std::cos(angle));
+            sin_[m] = static_cast<float>(std::sin(angle));
         }
-        return output_vector;
+        for (auto *v : {&yr_, &yi_, &pr_, &pi_, &cr_, &ci_}) v->resize(n);
     }
-};
\ No newline at end of file
+
+    size_t size_ = 0;
+    std::vector<float> cos_, sin_;  // cos/sin(2πm/n)
+    std::vector<float> yr_, yi_;    // 频谱累加值
+    std::vector<float> pr_, pi_;    // 各频点当前相量
+    std::vector<float> cr_, ci_;    // 各频点每步的旋转
+};
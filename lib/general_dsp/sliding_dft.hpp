@@ -0,0 +1,234 @@
+/**
+ * @file sliding_dft.hpp
+ * @date 17.10.2026
+ * @author RMSHE
+ *
+ * < GasSensorOS >
+ * Copyright(C) 2026 RMSHE. All rights reserved.
+ *
+ * This program is free software : you can redistribute it and /or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.If not, see < https://www.gnu.org/licenses/>.
+ *
+ * Electronic Mail : asdfghjkl851@outlook.com
+ */
+
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <functional>
+#include <vector>
+
+/**
+ * @brief 滑动 DFT: 以每样本 O(1) 的代价跟踪少数几个频点
+ *
+ * 对最近 N 个样本(最旧的样本相位为 0)的 DFT，第 k 个频点满足递推：
+ *     X_k(n) = e^{j2πk/N} · (X_k(n-1) - x(n-N) + x(n))
+ * 每个样本对每个频点只需一次复数乘法。
+ *
+ * 递推中的舍入误差会随时间累积。为此每个频点同时按定义直接累加当前窗口的 DFT(影子值，查余弦表，误差不随运行时间增长)，
+ * 每满 N 个样本用影子值替换递推值并重新开始累加，使递推值定期重新锚定到精确结果；
+ * 代价是每样本多一次复数乘加，没有周期性的计算尖峰。
+ *
+ * @note 非线程安全。
+ */
+class SlidingDFT {
+   public:
+    using Complex = std::complex<float>;
+
+    /**
+     * @brief 构造函数
+     * @param windowSize 窗口长度 N(不要求是 2 的幂)
+     * @param bins 要跟踪的频点序号 k (0 ≤ k < N), 频率为 k·fs/N
+     */
+    SlidingDFT(size_t windowSize, std::vector<size_t> bins) : size_(std::max<size_t>(1, windowSize)), bins_(std::move(bins)) {
+        history_.assign(size_, 0.0f);
+        cos_.resize(size_);
+        sin_.resize(size_);
+        for (size_t m = 0; m < size_; ++m) {
+            const double angle = 2.0 * 3.14159265358979323846 * static_cast<double>(m) / static_cast<double>(size_);
+            cos_[m] = static_cast<float>(std::cos(angle));
+            sin_[m] = static_cast<float>(std::sin(angle));
+        }
+        for (auto &k : bins_) k %= size_;
+
+        rotation_.resize(bins_.size());
+        for (size_t i = 0; i < bins_.size(); ++i) rotation_[i] = Complex(cos_[bins_[i]], sin_[bins_[i]]);  // e^{j2πk/N}
+        state_.assign(bins_.size(), Complex());
+        shadow_.assign(bins_.size(), Complex());
+        phase_.assign(bins_.size(), 0);
+    }
+
+    // 送入一个样本
+    void push(float sample) {
+        const float delta = sample - history_[pos_];
+        history_[pos_] = sample;
+        pos_ = (pos_ + 1 == size_) ? 0 : pos_ + 1;
+
+        const bool anchor = (++shadow_count_ == size_);
+        for (size_t i = 0; i < bins_.size(); ++i) {
+            // 递推值
+            state_[i] = rotation_[i] * (state_[i] + delta);
+
+            // 影子值: 样本在本窗口中的位置为 m 时乘以 e^{-j2πkm/N}
+            shadow_[i] += sample * Complex(cos_[phase_[i]], -sin_[phase_[i]]);
+            phase_[i] += bins_[i];
+            if (phase_[i] >= size_) phase_[i] -= size_;
+
+            if (anchor) {
+                state_[i] = shadow_[i];
+                shadow_[i] = Complex();
+                phase_[i] = 0;
+            }
+        }
+        if (anchor) shadow_count_ = 0;
+        if (filled_ < size_) ++filled_;
+    }
+
+    void push(const float *samples, size_t count) {
+        for (size_t i = 0; i < count; ++i) push(samples[i]);
+    }
+
+    // 清除所有样本
+    void reset() {
+        std::fill(history_.begin(), history_.end(), 0.0f);
+        std::fill(state_.begin(), state_.end(), Complex());
+        std::fill(shadow_.begin(), shadow_.end(), Complex());
+        std::fill(phase_.begin(), phase_.end(), 0);
+        pos_ = filled_ = shadow_count_ = 0;
+    }
+
+    // 第 i 个跟踪频点的 DFT 值 X_k
+    Complex value(size_t i) const { return state_[i]; }
+
+    // 第 i 个跟踪频点的功率 |X_k|²
+    float power(size_t i) const { return std::norm(state_[i]); }
+
+    // 第 i 个跟踪频点对应正弦分量的幅值(2|X_k|/N, 直流与奈奎斯特频点为 |X_k|/N)
+    float amplitude(size_t i) const {
+        const bool edge = bins_[i] == 0 || 2 * bins_[i] == size_;
+        return std::abs(state_[i]) * (edge ? 1.0f : 2.0f) / static_cast<float>(size_);
+    }
+
+    size_t bin(size_t i) const { return bins_[i]; }  // 第 i 个跟踪频点的序号 k
+    size_t bins() const { return bins_.size(); }      // 跟踪的频点数
+    size_t windowSize() const { return size_; }
+    bool ready() const { return filled_ == size_; }  // 是否已经收到一整个窗口的样本
+
+   private:
+    size_t size_;
+    std::vector<size_t> bins_;
+    std::vector<float> cos_, sin_;   // cos/sin(2πm/N)
+    std::vector<float> history_;     // 最近 N 个样本(环形)
+    size_t pos_ = 0;                 // 最旧样本的位置, 也是下一个样本的写入位置
+    size_t filled_ = 0;              // 已收到的样本数(不超过 N)
+
+    std::vector<Complex> rotation_;  // e^{j2πk/N}
+    std::vector<Complex> state_;     // 递推值
+    std::vector<Complex> shadow_;    // 当前窗口内直接累加的 DFT
+    std::vector<size_t> phase_;      // 影子值下一个样本的相位 (k·m) mod N
+    size_t shadow_count_ = 0;        // 影子值已累加的样本数
+};
+
+/**
+ * @brief Goertzel 滤波器组: 按块检测任意频率的分量
+ *
+ * 每个频率一个二阶谐振器 s(n) = x(n) + 2cos(ω)·s(n-1) - s(n-2)，每样本一次实数乘法；
+ * 每满 blockSize 个样本输出一次各频率的 DFT 值并清零状态。频率不必落在 fs/N 的整数倍上，
+ * 且每块重新开始，不存在误差累积。
+ *
+ * @note 非线程安全。
+ */
+class GoertzelBank {
+   public:
+    using Complex = std::complex<float>;
+    using BlockHandler = std::function<void(const GoertzelBank &bank)>;
+
+    /**
+     * @brief 构造函数
+     * @param sampleRate 采样率(Hz)
+     * @param blockSize 每块样本数
+     * @param frequencies 要检测的频率(Hz)
+     * @param onBlock 每完成一块时调用, 可通过 value()/power()/amplitude() 读取结果
+     */
+    GoertzelBank(float sampleRate, size_t blockSize, const std::vector<float> &frequencies, BlockHandler onBlock = nullptr)
+        : block_size_(std::max<size_t>(1, blockSize)), on_block_(std::move(onBlock)) {
+        channels_.reserve(frequencies.size());
+        for (float hz : frequencies) {
+            Channel ch;
+            ch.frequency = hz;
+            const double omega = 2.0 * 3.14159265358979323846 * hz / sampleRate;
+            ch.coeff = static_cast<float>(2.0 * std::cos(omega));
+            ch.cosw = static_cast<float>(std::cos(omega));
+            ch.sinw = static_cast<float>(std::sin(omega));
+            ch.anchor = std::polar(1.0f, static_cast<float>(std::fmod(-omega * static_cast<double>(block_size_ - 1), 2.0 * 3.14159265358979323846)));
+            channels_.push_back(ch);
+        }
+    }
+
+    /**
+     * @brief 送入一个样本
+     * @return 本次完成一块时返回 true
+     */
+    bool push(float sample) {
+        for (auto &ch : channels_) {
+            const float s = sample + ch.coeff * ch.s1 - ch.s2;
+            ch.s2 = ch.s1;
+            ch.s1 = s;
+        }
+        if (++count_ < block_size_) return false;
+
+        // 块结束: X = e^{-jω(N-1)}·(s(N-1) - e^{-jω}·s(N-2)), 相位以块首样本为参考点
+        for (auto &ch : channels_) {
+            ch.value = ch.anchor * Complex(ch.s1 - ch.cosw * ch.s2, ch.sinw * ch.s2);
+            ch.s1 = ch.s2 = 0.0f;
+        }
+        count_ = 0;
+        ++blocks_;
+        if (on_block_) on_block_(*this);
+        return true;
+    }
+
+    // 送入一段样本, 返回期间完成的块数
+    size_t push(const float *samples, size_t count) {
+        size_t blocks = 0;
+        for (size_t i = 0; i < count; ++i) blocks += push(samples[i]);
+        return blocks;
+    }
+
+    Complex value(size_t i) const { return channels_[i].value; }          // 最近一块中第 i 个频率的 DFT 值
+    float power(size_t i) const { return std::norm(channels_[i].value); }  // |X|²
+    float amplitude(size_t i) const { return 2.0f * std::abs(channels_[i].value) / static_cast<float>(block_size_); }  // 正弦分量幅值
+    float frequency(size_t i) const { return channels_[i].frequency; }
+
+    size_t channels() const { return channels_.size(); }
+    size_t blockSize() const { return block_size_; }
+    size_t blocks() const { return blocks_; }  // 已完成的块数
+
+   private:
+    struct Channel {
+        float frequency = 0;
+        float coeff = 0;       // 2cos(ω)
+        float cosw = 0;        // cos(ω)
+        float sinw = 0;        // sin(ω)
+        Complex anchor;        // e^{-jω(N-1)}
+        float s1 = 0, s2 = 0;  // 谐振器状态 s(n-1), s(n-2)
+        Complex value;         // 最近一块的结果
+    };
+
+    size_t block_size_;
+    BlockHandler on_block_;
+    std::vector<Channel> channels_;
+    size_t count_ = 0;   // 当前块已收到的样本数
+    size_t blocks_ = 0;  // 已完成的块数
+};
@@ -0,0 +1,230 @@
+/**
+ * @file spectral_analyzer.hpp
+ * @date 17.10.2026
+ * @author RMSHE
+ *
+ * < GasSensorOS >
+ * Copyright(C) 2026 RMSHE. All rights reserved.
+ *
+ * This program is free software : you can redistribute it and /or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.If not, see < https://www.gnu.org/licenses/>.
+ *
+ * Electronic Mail : asdfghjkl851@outlook.com
+ */
+
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <fourier_transform.hpp>
+#include <functional>
+#include <vector>
+
+/**
+ * @brief 流式频谱分析(分帧加窗 + Welch 功率谱密度 + 频带功率)
+ *
+ * 样本逐个或成块送入 `push()`，每累积 `hopSize` 个新样本就对最近的 `frameSize` 个样本做一帧分析：
+ * 1. 乘以预先计算好的窗函数(Hann/Hamming/Blackman/矩形)；
+ * 2. 实数 FFT 得到本帧的单边功率谱密度(周期图)；
+ * 3. 更新 Welch 平均(累计平均，或按 `smoothing` 做指数平均以跟踪缓慢变化)；
+ * 4. 按配置的频带对本帧周期图积分，得到每帧的频带功率特征，并调用帧回调。
+ *
+ * 所有缓冲区在构造时分配，之后每个样本的开销固定，不再分配内存。
+ *
+ * @note 非线程安全。
+ */
+class SpectralAnalyzer {
+   public:
+    using Complex = FastFourierTransform::Complex;
+
+    // 窗函数
+    enum class Window : uint8_t { Rectangular, Hann, Hamming, Blackman };
+
+    // 频带 [lowHz, highHz)
+    struct Band {
+        float lowHz;
+        float highHz;
+    };
+
+    // 分析配置
+    struct Config {
+        float sampleRate = 100.0f;      // 采样率(Hz)
+        size_t frameSize = 256;         // 帧长, 不是 2 的幂时向上取整
+        size_t hopSize = 128;           // 帧移(相邻两帧起点相隔的样本数), 取值 1..frameSize; frameSize/2 即 50% 重叠
+        Window window = Window::Hann;   // 窗函数
+        float smoothing = 0.0f;         // Welch 平均方式: 0 为所有帧的累计平均; (0, 1) 为指数平均中新帧的权重
+        std::vector<Band> bands;        // 每帧输出功率的频带
+    };
+
+    // 一帧的分析结果(指针指向分析器内部缓冲区, 在下一帧前有效)
+    struct Frame {
+        size_t index;             // 帧序号, 从 0 开始
+        const float *psd;         // 本帧的单边功率谱密度, 共 bins() 个频点(单位: 输入单位²/Hz)
+        const float *bandPowers;  // 本帧各频带的功率, 与 Config::bands 一一对应(单位: 输入单位²)
+    };
+
+    using FrameHandler = std::function<void(const Frame &frame)>;
+
+    explicit SpectralAnalyzer(const Config &config, FrameHandler onFrame = nullptr) : config_(config), on_frame_(std::move(onFrame)) {
+        config_.frameSize = std::max<size_t>(2, FastFourierTransform::nextPowerOfTwo(config_.frameSize));
+        config_.hopSize = std::min(std::max<size_t>(1, config_.hopSize), config_.frameSize);
+
+        const size_t n = config_.frameSize;
+        samples_.assign(n, 0.0f);
+        frame_.assign(n, 0.0f);
+        spectrum_.assign(n / 2 + 1, Complex());
+        psd_.assign(bins(), 0.0f);
+        welch_.assign(bins(), 0.0f);
+        band_powers_.assign(config_.bands.size(), 0.0f);
+        welch_band_powers_.assign(config_.bands.size(), 0.0f);
+        fft_.reserve(n);
+
+        // 窗函数系数与 PSD 归一化系数只计算一次
+        window_.resize(n);
+        double energy = 0;
+        for (size_t i = 0; i < n; ++i) {
+            window_[i] = windowCoefficient(config_.window, i, n);
+            energy += static_cast<double>(window_[i]) * window_[i];
+        }
+        psd_scale_ = static_cast<float>(1.0 / (config_.sampleRate * energy));
+
+        // 频带换算为频点区间 [first, last)
+        band_bins_.reserve(config_.bands.size());
+        for (const auto &band : config_.bands) band_bins_.push_back({binOf(band.lowHz), binOf(band.highHz)});
+    }
+
+    /**
+     * @brief 送入一个样本
+     * @return 本次完成一帧分析时返回 true
+     */
+    bool push(float sample) {
+        samples_[write_pos_] = sample;
+        write_pos_ = (write_pos_ + 1 == config_.frameSize) ? 0 : write_pos_ + 1;
+        if (filled_ < config_.frameSize) ++filled_;
+        if (++since_frame_ < config_.hopSize || filled_ < config_.frameSize) return false;
+
+        since_frame_ = 0;
+        analyze();
+        return true;
+    }
+
+    /**
+     * @brief 送入一段样本
+     * @return 期间完成的帧数
+     */
+    size_t push(const float *samples, size_t count) {
+        size_t frames = 0;
+        for (size_t i = 0; i < count; ++i) frames += push(samples[i]);
+        return frames;
+    }
+
+    // 清除所有样本与平均结果(保留配置与预计算的表)
+    void reset() {
+        std::fill(samples_.begin(), samples_.end(), 0.0f);
+        std::fill(welch_.begin(), welch_.end(), 0.0f);
+        write_pos_ = filled_ = since_frame_ = frames_ = 0;
+    }
+
+    const Config &config() const { return config_; }
+    size_t bins() const { return config_.frameSize / 2 + 1; }                              // 单边频谱的频点数
+    float binWidth() const { return config_.sampleRate / static_cast<float>(config_.frameSize); }  // 频率分辨率(Hz)
+    float binFrequency(size_t bin) const { return bin * binWidth(); }
+    size_t frames() const { return frames_; }  // 已分析的帧数
+
+    const std::vector<float> &framePsd() const { return psd_; }           // 最近一帧的功率谱密度
+    const std::vector<float> &bandPowers() const { return band_powers_; }  // 最近一帧的频带功率
+    const std::vector<float> &welchPsd() const { return welch_; }         // Welch 平均功率谱密度
+
+    // 按 Welch 平均功率谱密度计算的频带功率
+    const std::vector<float> &welchBandPowers() {
+        integrateBands(welch_.data(), welch_band_powers_.data());
+        return welch_band_powers_;
+    }
+
+   private:
+    // 窗函数第 i 个系数(周期型, 适用于频谱分析)
+    static float windowCoefficient(Window window, size_t i, size_t n) {
+        const double x = 2.0 * 3.14159265358979323846 * static_cast<double>(i) / static_cast<double>(n);
+        switch (window) {
+            case Window::Hann:
+                return static_cast<float>(0.5 - 0.5 * std::cos(x));
+            case Window::Hamming:
+                return static_cast<float>(0.54 - 0.46 * std::cos(x));
+            case Window::Blackman:
+                return static_cast<float>(0.42 - 0.5 * std::cos(x) + 0.08 * std::cos(2 * x));
+            default:
+                return 1.0f;
+        }
+    }
+
+    // 频率对应的频点(向上取整, 限制在 [0, bins()])
+    size_t binOf(float hz) const {
+        if (hz <= 0) return 0;
+        return std::min(bins(), static_cast<size_t>(std::ceil(hz / binWidth())));
+    }
+
+    void analyze() {
+        const size_t n = config_.frameSize;
+
+        // 1. 从最旧的样本开始展开为一帧并加窗(write_pos_ 处即最旧的样本)
+        const size_t tail = n - write_pos_;
+        for (size_t i = 0; i < tail; ++i) frame_[i] = samples_[write_pos_ + i] * window_[i];
+        for (size_t i = tail; i < n; ++i) frame_[i] = samples_[i - tail] * window_[i];
+
+        // 2. 单边功率谱密度: |X|² / (fs·Σw²), 除直流与奈奎斯特频点外乘 2
+        fft_.realFFT(frame_.data(), n, spectrum_.data());
+        for (size_t k = 0; k < bins(); ++k) psd_[k] = std::norm(spectrum_[k]) * psd_scale_;
+        for (size_t k = 1; k + 1 < bins(); ++k) psd_[k] *= 2.0f;
+
+        // 3. Welch 平均
+        const float weight = config_.smoothing > 0.0f && frames_ > 0 ? config_.smoothing : 1.0f / static_cast<float>(frames_ + 1);
+        for (size_t k = 0; k < bins(); ++k) welch_[k] += weight * (psd_[k] - welch_[k]);
+
+        // 4. 频带功率
+        integrateBands(psd_.data(), band_powers_.data());
+
+        if (on_frame_) on_frame_(Frame{frames_, psd_.data(), band_powers_.data()});
+        ++frames_;
+    }
+
+    // 对功率谱密度在各频带内积分
+    void integrateBands(const float *psd, float *powers) const {
+        const float df = binWidth();
+        for (size_t b = 0; b < band_bins_.size(); ++b) {
+            float sum = 0.0f;
+            for (size_t k = band_bins_[b].first; k < band_bins_[b].second; ++k) sum += psd[k];
+            powers[b] = sum * df;
+        }
+    }
+
+    Config config_;
+    FrameHandler on_frame_;
+    FastFourierTransform fft_;
+
+    std::vector<float> window_;                           // 窗函数系数
+    float psd_scale_ = 0;                                 // 1 / (fs·Σw²)
+    std::vector<std::pair<size_t, size_t>> band_bins_;    // 各频带的频点区间 [first, last)
+
+    std::vector<float> samples_;  // 最近 frameSize 个样本(环形)
+    size_t write_pos_ = 0;        // 下一个样本的写入位置
+    size_t filled_ = 0;           // 已有的样本数(不超过 frameSize)
+    size_t since_frame_ = 0;      // 距上一帧的新样本数
+    size_t frames_ = 0;           // 已分析的帧数
+
+    std::vector<float> frame_;                  // 加窗后的一帧
+    std::vector<Complex> spectrum_;             // 本帧频谱
+    std::vector<float> psd_;                    // 本帧功率谱密度
+    std::vector<float> welch_;                  // Welch 平均功率谱密度
+    std::vector<float> band_powers_;            // 本帧频带功率
+    std::vector<float> welch_band_powers_;      // Welch 频带功率
+};
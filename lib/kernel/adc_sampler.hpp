@@ -0,0 +1,368 @@
+/**
+ * @file adc_sampler.hpp
+ * @date 17.10.2026
+ * @author RMSHE
+ *
+ * < GasSensorOS >
+ * Copyright(C) 2026 RMSHE. All rights reserved.
+ *
+ * This program is free software : you can redistribute it and /or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.If not, see < https://www.gnu.org/licenses/>.
+ *
+ * Electronic Mail : asdfghjkl851@outlook.com
+ */
+
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <ring_buffer.h>
+#include <serial_warning.hpp>
+#include <thread>
+#include <vector>
+
+#if defined(ARDUINO)
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#endif
+
+/**
+ * @brief 连续采样源接口
+ *
+ * 采样源在 begin() 时一次性配置所有通道，之后以固定帧率连续采样；每一帧按 pins 的顺序包含每个通道一个样本。
+ * 硬件实现见 `ESP32S3ADCSource`(adc_source_esp32_s3.h)，主机上可用 `SyntheticADCSource` 代替。
+ */
+class ADCSampleSource {
+   public:
+    virtual ~ADCSampleSource() = default;
+
+    /**
+     * @brief 配置通道并开始连续采样
+     * @param pins 采样的 GPIO 引脚, 顺序即帧内样本的顺序
+     * @param sampleRate 每个通道的采样率(Hz)
+     * @return 成功返回 true
+     */
+    virtual bool begin(const std::vector<uint8_t> &pins, uint32_t sampleRate) = 0;
+
+    /**
+     * @brief 读取已完成的帧
+     * @param frames 接收帧的数组(交错存放), 至少能容纳 maxFrames × 通道数 个样本
+     * @param maxFrames 最多读取的帧数
+     * @param timeoutMs 没有数据时最多等待的时间(毫秒)
+     * @return 读取的帧数
+     */
+    virtual size_t read(uint16_t *frames, size_t maxFrames, uint32_t timeoutMs) = 0;
+
+    // 停止采样
+    virtual void end() = 0;
+
+    // 将第 channel 个通道的原始读数换算为电压(mV)
+    virtual uint32_t toMillivolts(size_t channel, uint16_t raw) const = 0;
+};
+
+/**
+ * @brief 多通道连续采样引擎(多缓冲)
+ *
+ * 采集端(后台任务或调用方循环调用 pump())从采样源读取数据，按通道拆分后写入当前的填充缓冲区；
+ * 缓冲区写满一块后放入就绪队列，并从空闲队列取出下一个缓冲区继续填充。
+ * 消费端调用 poll() 取出就绪的块交给回调处理，处理完毕后缓冲区回到空闲队列。
+ * 两个队列都是 `SPSCRingBuffer`，采集端与消费端之间无需加锁；缓冲区在构造时全部分配，运行时不再分配内存。
+ *
+ * 消费端跟不上时(没有空闲缓冲区)，刚写满的块被丢弃并计入 droppedBlocks()，采集本身不会阻塞，
+ * 块序号 Block::index 会出现相应的跳跃。
+ *
+ * @note 只能有一个采集端与一个消费端。
+ */
+class ADCSampler {
+   public:
+    static constexpr size_t kMaxBuffers = 8;  // 缓冲区个数上限
+
+    struct Config {
+        std::vector<uint8_t> pins;  // 采样的 GPIO 引脚
+        uint32_t sampleRate = 1000;  // 每个通道的采样率(Hz)
+        size_t blockFrames = 256;    // 每块的帧数(每个通道的样本数)
+        size_t buffers = 2;          // 缓冲区个数, 取值 2..kMaxBuffers; 2 即双缓冲
+    };
+
+    // 一块采样数据(指针指向引擎内部的缓冲区, 仅在回调期间有效)
+    struct Block {
+        size_t index;          // 块序号(从 0 开始, 被丢弃的块也占用序号)
+        size_t channels;       // 通道数
+        size_t frames;         // 每个通道的样本数
+        const uint16_t *data;  // 按通道分开存放: 第 ch 个通道的样本为 data[ch × frames .. (ch + 1) × frames)
+
+        // 第 ch 个通道的样本
+        RingSpan<const uint16_t> channel(size_t ch) const { return RingSpan<const uint16_t>{data + ch * frames, frames}; }
+    };
+
+    using BlockHandler = std::function<void(const Block &block)>;
+
+    /**
+     * @brief 构造函数
+     * @param source 采样源(生命周期必须长于采样引擎)
+     * @param config 采样配置
+     * @param onBlock 每取出一块时在 poll() 的调用者中调用
+     */
+    ADCSampler(ADCSampleSource &source, const Config &config, BlockHandler onBlock = nullptr) : source_(source), config_(config), on_block_(std::move(onBlock)) {
+        config_.blockFrames = std::max<size_t>(1, config_.blockFrames);
+        config_.buffers = std::min(std::max<size_t>(2, config_.buffers), kMaxBuffers);
+
+        const size_t channels = config_.pins.size();
+        buffers_.assign(config_.buffers * channels * config_.blockFrames, 0);
+        sequence_.assign(config_.buffers, 0);
+        scratch_.assign(kReadFrames * channels, 0);
+    }
+
+    ~ADCSampler() { stop(); }
+
+    ADCSampler(const ADCSampler &) = delete;
+    ADCSampler &operator=(const ADCSampler &) = delete;
+
+    /**
+     * @brief 开始采样
+     * @param background 为 true 时创建后台采集任务; 为 false 时由调用方循环调用 pump()
+     * @return 成功返回 true
+     */
+    bool start(bool background = true) {
+        if (running_) return true;
+        if (config_.pins.empty()) {
+            WARN(WarningLevel::ERROR, "ADCSampler: no channels configured");
+            return false;
+        }
+        if (!source_.begin(config_.pins, config_.sampleRate)) return false;
+
+        // 0 号缓冲区开始填充, 其余缓冲区进入空闲队列
+        uint8_t index;
+        while (ready_.tryPop(index)) {
+        }
+        while (free_.tryPop(index)) {
+        }
+        for (uint8_t i = 1; i < config_.buffers; ++i) free_.tryPush(i);
+        fill_ = 0;
+        fill_frames_ = 0;
+        next_index_ = 0;
+        running_ = true;
+
+        if (background) launchWorker();
+        return true;
+    }
+
+    // 停止采样(已就绪的块仍可通过 poll() 取出)
+    void stop() {
+        if (!running_) return;
+        running_ = false;
+        joinWorker();
+        source_.end();
+    }
+
+    /**
+     * @brief 采集: 从采样源读取一段数据到当前的填充缓冲区(仅采集端调用)
+     * @param timeoutMs 没有数据时最多等待的时间(毫秒)
+     * @return 本次写满的块数(0 或 1)
+     */
+    size_t pump(uint32_t timeoutMs = 0) {
+        if (!running_) return 0;
+
+        const size_t channels = config_.pins.size();
+        const size_t blockFrames = config_.blockFrames;
+        const size_t got = source_.read(scratch_.data(), std::min(kReadFrames, blockFrames - fill_frames_), timeoutMs);
+
+        // 交错的帧拆分为按通道存放
+        uint16_t *block = buffers_.data() + fill_ * channels * blockFrames;
+        for (size_t ch = 0; ch < channels; ++ch) {
+            uint16_t *dest = block + ch * blockFrames + fill_frames_;
+            for (size_t f = 0; f < got; ++f) dest[f] = scratch_[f * channels + ch];
+        }
+        fill_frames_ += got;
+        frames_.fetch_add(got, std::memory_order_relaxed);
+        if (fill_frames_ < blockFrames) return 0;
+
+        // 块已写满: 有空闲缓冲区时发布本块, 否则丢弃本块并重新填充同一缓冲区
+        fill_frames_ = 0;
+        uint8_t next;
+        if (!free_.tryPop(next)) {
+            ++next_index_;
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return 0;
+        }
+        sequence_[fill_] = next_index_++;
+        ready_.tryPush(fill_);
+        fill_ = next;
+        return 1;
+    }
+
+    /**
+     * @brief 消费: 取出所有就绪的块交给回调处理(仅消费端调用)
+     * @return 处理的块数
+     */
+    size_t poll() {
+        size_t count = 0;
+        uint8_t index;
+        while (ready_.tryPop(index)) {
+            if (on_block_) on_block_(blockAt(index));
+            free_.tryPush(index);
+            ++count;
+        }
+        return count;
+    }
+
+    // 将第 channel 个通道的原始读数换算为电压(mV)
+    uint32_t toMillivolts(size_t channel, uint16_t raw) const { return source_.toMillivolts(channel, raw); }
+
+    const Config &config() const { return config_; }
+    bool running() const { return running_; }
+    size_t frames() const { return frames_.load(std::memory_order_relaxed); }          // 已采集的帧数
+    size_t droppedBlocks() const { return dropped_.load(std::memory_order_relaxed); }  // 因消费端跟不上而丢弃的块数
+
+   private:
+    static constexpr size_t kReadFrames = 64;        // 每次从采样源读取的最大帧数
+    static constexpr uint32_t kWorkerTimeoutMs = 10;  // 后台任务每次读取的等待时间, 也是 stop() 的最长响应时间
+
+    Block blockAt(uint8_t index) const {
+        const size_t channels = config_.pins.size();
+        return Block{sequence_[index], channels, config_.blockFrames, buffers_.data() + index * channels * config_.blockFrames};
+    }
+
+    void workerLoop() {
+        while (running_) pump(kWorkerTimeoutMs);
+    }
+
+#if defined(ARDUINO)
+    static void workerEntry(void *self) {
+        ADCSampler *sampler = static_cast<ADCSampler *>(self);
+        sampler->workerLoop();
+        sampler->worker_active_ = false;
+        vTaskDelete(NULL);
+    }
+
+    void launchWorker() {
+        worker_active_ = true;
+        if (xTaskCreate(workerEntry, "ADCSampler", 4096, this, configMAX_PRIORITIES - 2, NULL) != pdPASS) {
+            worker_active_ = false;
+            WARN(WarningLevel::ERROR, "ADCSampler: failed to create sampling task");
+        }
+    }
+
+    void joinWorker() {
+        while (worker_active_) vTaskDelay(1);
+    }
+#else
+    void launchWorker() { worker_ = std::thread([this] { workerLoop(); }); }
+
+    void joinWorker() {
+        if (worker_.joinable()) worker_.join();
+    }
+#endif
+
+    ADCSampleSource &source_;
+    Config config_;
+    BlockHandler on_block_;
+
+    std::vector<uint16_t> buffers_;     // config_.buffers 个缓冲区, 每个 通道数 × blockFrames 个样本
+    std::vector<size_t> sequence_;      // 各缓冲区中块的序号
+    std::vector<uint16_t> scratch_;     // 从采样源读取的交错帧
+    SPSCRingBuffer<uint8_t, kMaxBuffers> free_;   // 空闲缓冲区(消费端 → 采集端)
+    SPSCRingBuffer<uint8_t, kMaxBuffers> ready_;  // 已写满的缓冲区(采集端 → 消费端)
+
+    // 以下仅由采集端访问
+    uint8_t fill_ = 0;        // 正在填充的缓冲区
+    size_t fill_frames_ = 0;  // 正在填充的缓冲区已写入的帧数
+    size_t next_index_ = 0;   // 下一块的序号
+
+    std::atomic<bool> running_{false};
+    std::atomic<size_t> frames_{0};
+    std::atomic<size_t> dropped_{0};
+#if defined(ARDUINO)
+    std::atomic<bool> worker_active_{false};
+#else
+    std::thread worker_;
+#endif
+};
+
+/**
+ * @brief 合成采样源: 在主机上代替 ADC 硬件驱动采样引擎
+ *
+ * 由信号函数给出每个通道在任意时刻的电压，按 12 位满量程量化为原始读数。
+ * 实时模式下按 begin() 指定的采样率随时间产生数据(与硬件一样需要等待)；非实时模式下每次读取立即返回所请求的帧数。
+ */
+class SyntheticADCSource : public ADCSampleSource {
+   public:
+    using Signal = std::function<float(size_t channel, double seconds)>;  // 返回第 channel 个通道在 seconds 时刻的电压(mV)
+
+    /**
+     * @brief 构造函数
+     * @param signal 信号函数
+     * @param realTime 是否按实际时间产生数据
+     * @param fullScaleMv 满量程电压(mV), 对应原始读数 4095
+     */
+    explicit SyntheticADCSource(Signal signal, bool realTime = false, uint32_t fullScaleMv = 3300)
+        : signal_(std::move(signal)), real_time_(realTime), full_scale_mv_(fullScaleMv) {}
+
+    bool begin(const std::vector<uint8_t> &pins, uint32_t sampleRate) override {
+        if (pins.empty() || sampleRate == 0) return false;
+        channels_ = pins.size();
+        sample_rate_ = sampleRate;
+        produced_ = 0;
+        start_ = std::chrono::steady_clock::now();
+        return true;
+    }
+
+    size_t read(uint16_t *frames, size_t maxFrames, uint32_t timeoutMs) override {
+        if (channels_ == 0) return 0;
+
+        size_t count = maxFrames;
+        if (real_time_) {
+            // 只返回按采样率到目前为止应当完成的帧, 没有时等待下一帧或超时
+            const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+            for (;;) {
+                const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_).count();
+                const size_t due = static_cast<size_t>(elapsed * sample_rate_);
+                if (due > produced_) {
+                    count = std::min(maxFrames, due - produced_);
+                    break;
+                }
+                if (std::chrono::steady_clock::now() >= deadline) return 0;
+                const auto next = start_ + std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>((produced_ + 1.0) / sample_rate_));
+                std::this_thread::sleep_until(std::min(next, deadline));
+            }
+        }
+
+        for (size_t f = 0; f < count; ++f) {
+            const double t = static_cast<double>(produced_ + f) / sample_rate_;
+            for (size_t ch = 0; ch < channels_; ++ch) {
+                const double raw = std::round(signal_(ch, t) * 4095.0 / full_scale_mv_);
+                frames[f * channels_ + ch] = static_cast<uint16_t>(std::min(4095.0, std::max(0.0, raw)));
+            }
+        }
+        produced_ += count;
+        return count;
+    }
+
+    void end() override { channels_ = 0; }
+
+    uint32_t toMillivolts(size_t, uint16_t raw) const override { return static_cast<uint32_t>(raw) * full_scale_mv_ / 4095; }
+
+    size_t produced() const { return produced_; }  // 已产生的帧数
+
+   private:
+    Signal signal_;
+    bool real_time_;
+    uint32_t full_scale_mv_;
+    size_t channels_ = 0;
+    uint32_t sample_rate_ = 0;
+    size_t produced_ = 0;
+    std::chrono::steady_clock::time_point start_;
+};
@@ -0,0 +1,194 @@
+/**
+ * @file adc_source_esp32_s3.cpp
+ * @date 17.10.2026
+ * @author RMSHE
+ *
+ * < GasSensorOS >
+ * Copyright(C) 2026 RMSHE. All rights reserved.
+ *
+ * This program is free software : you can redistribute it and /or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.If not, see < https://www.gnu.org/licenses/>.
+ *
+ * Electronic Mail : asdfghjkl851@outlook.com
+ */
+
+#include <adc_source_esp32_s3.h>
+
+#include <algorithm>
+#include <serial_warning.hpp>
+
+constexpr uint32_t ADC_DMA_STORE_BYTES = 4096;  // 驱动内部缓冲区大小
+constexpr uint32_t ADC_DMA_INTR_BYTES = 256;    // 每次 DMA 中断搬运的字节数
+constexpr size_t ADC_READ_BYTES = 1024;         // read() 每次最多取出的字节数
+
+/**
+ * @brief 配置 ADC1 采样模式表并开始连续采样
+ * @param pins ADC1 引脚(GPIO1 ~ GPIO10), 顺序即帧内样本的顺序
+ * @param sampleRate 每个通道的采样率(Hz), 乘以通道数后须在 SOC_ADC_SAMPLE_FREQ_THRES_LOW ~ SOC_ADC_SAMPLE_FREQ_THRES_HIGH 之间
+ * @return 成功返回 true; ADC1 已被另一个连续采样源占用时返回 false
+ */
+bool ESP32S3ADCSource::begin(const std::vector<uint8_t> &pins, uint32_t sampleRate) {
+    end();
+
+    // ADC1 同一时刻只能有一个连续采样源
+    bool expected = false;
+    if (!ADC::adc1_continuous.compare_exchange_strong(expected, true)) {
+        WARN(WarningLevel::ERROR, "ADC1 continuous sampling is already in use");
+        return false;
+    }
+    if (!configure(pins, sampleRate)) {
+        ADC::adc1_continuous = false;
+        return false;
+    }
+    running_ = true;
+    return true;
+}
+
+/**
+ * @brief 校验引脚与采样率, 初始化驱动并启动数字控制器
+ * @return 成功返回 true(失败时已释放驱动)
+ */
+bool ESP32S3ADCSource::configure(const std::vector<uint8_t> &pins, uint32_t sampleRate) {
+    if (pins.empty() || pins.size() > SOC_ADC_PATT_LEN_MAX) {
+        WARN(WarningLevel::ERROR, "invalid ADC channel count: %d", (int)pins.size());
+        return false;
+    }
+
+    const uint32_t conversionRate = sampleRate * pins.size();  // 数字控制器轮流转换各通道, 总转换频率 = 采样率 × 通道数
+    if (conversionRate < SOC_ADC_SAMPLE_FREQ_THRES_LOW || conversionRate > SOC_ADC_SAMPLE_FREQ_THRES_HIGH) {
+        WARN(WarningLevel::ERROR, "ADC conversion rate out of range: %u Hz", (unsigned)conversionRate);
+        return false;
+    }
+
+    // ESP32-S3 上 GPIO1 ~ GPIO10 依次对应 ADC1_CHANNEL_0 ~ ADC1_CHANNEL_9
+    std::vector<adc_digi_pattern_config_t> pattern(pins.size());
+    slot_of_channel_.assign(SOC_ADC_CHANNEL_NUM(0), -1);
+    uint32_t channelMask = 0;
+    for (size_t i = 0; i < pins.size(); ++i) {
+        if (pins[i] < 1 || pins[i] > 10) {
+            WARN(WarningLevel::ERROR, "continuous sampling only supports ADC1 pins (GPIO1-GPIO10), pin:%d", pins[i]);
+            return false;
+        }
+        const uint8_t channel = pins[i] - 1;
+        if (slot_of_channel_[channel] >= 0) {
+            WARN(WarningLevel::ERROR, "duplicate ADC pin:%d", pins[i]);
+            return false;
+        }
+        slot_of_channel_[channel] = static_cast<int8_t>(i);
+        channelMask |= 1u << channel;
+
+        pattern[i].atten = atten_;
+        pattern[i].channel = channel;
+        pattern[i].unit = 0;  // ADC1
+        pattern[i].bit_width = SOC_ADC_DIGI_MAX_BITWIDTH;
+    }
+
+    adc_digi_init_config_t init_config = {};
+    init_config.max_store_buf_size = ADC_DMA_STORE_BYTES;
+    init_config.conv_num_each_intr = ADC_DMA_INTR_BYTES;
+    init_config.adc1_chan_mask = channelMask;
+    init_config.adc2_chan_mask = 0;
+    if (adc_digi_initialize(&init_config) != ESP_OK) {
+        WARN(WarningLevel::ERROR, "adc_digi_initialize failed");
+        return false;
+    }
+
+    adc_digi_configuration_t digi_config = {};
+    digi_config.conv_limit_en = false;
+    digi_config.conv_limit_num = 250;
+    digi_config.pattern_num = pattern.size();
+    digi_config.adc_pattern = pattern.data();
+    digi_config.sample_freq_hz = conversionRate;
+    digi_config.conv_mode = ADC_CONV_SINGLE_UNIT_1;
+    digi_config.format = ADC_DIGI_OUTPUT_FORMAT_TYPE2;
+    if (adc_digi_controller_configure(&digi_config) != ESP_OK) {
+        adc_digi_deinitialize();
+        WARN(WarningLevel::ERROR, "adc_digi_controller_configure failed");
+        return false;
+    }
+
+    // 衰减系数固定, 校准参数只需计算一次
+    esp_adc_cal_characterize(ADC_UNIT_1, atten_, ADC_WIDTH_BIT_12, 3300, &adc_chars_);
+
+    channels_ = pins.size();
+    partial_.assign(channels_, 0);
+    next_slot_ = 0;
+    dma_.resize(ADC_READ_BYTES);
+
+    if (adc_digi_start() != ESP_OK) {
+        adc_digi_deinitialize();
+        WARN(WarningLevel::ERROR, "adc_digi_start failed");
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief 取出 DMA 转换结果并拼装成帧
+ * @param frames 接收帧的数组(交错存放)
+ * @param maxFrames 最多读取的帧数
+ * @param timeoutMs 没有数据时最多等待的时间(毫秒)
+ * @return 读取的帧数
+ * @note 转换结果有丢失时(通道顺序不连续)丢弃不完整的帧，从下一帧的第一个通道重新开始拼装。
+ */
+size_t ESP32S3ADCSource::read(uint16_t *frames, size_t maxFrames, uint32_t timeoutMs) {
+    if (!running_ || maxFrames == 0) return 0;
+
+    // 至多取出能拼成 maxFrames 帧的转换结果(算上正在拼装的帧也不会超出)
+    const size_t wanted = std::min(dma_.size() / SOC_ADC_DIGI_RESULT_BYTES, maxFrames * channels_ - next_slot_);
+    uint32_t length = 0;
+    const esp_err_t err = adc_digi_read_bytes(dma_.data(), wanted * SOC_ADC_DIGI_RESULT_BYTES, &length, timeoutMs);
+    if (err == ESP_ERR_INVALID_STATE) {
+        ++overflows_;  // 驱动缓冲区已满, 仍会返回数据
+    } else if (err != ESP_OK) {
+        return 0;  // 超时
+    }
+
+    size_t count = 0;
+    for (uint32_t i = 0; i + SOC_ADC_DIGI_RESULT_BYTES <= length; i += SOC_ADC_DIGI_RESULT_BYTES) {
+        const adc_digi_output_data_t *result = reinterpret_cast<const adc_digi_output_data_t *>(&dma_[i]);
+        if (result->type2.unit != 0 || result->type2.channel >= slot_of_channel_.size()) continue;
+
+        const int8_t slot = slot_of_channel_[result->type2.channel];
+        if (slot < 0) continue;
+        if (static_cast<size_t>(slot) != next_slot_) {
+            next_slot_ = 0;
+            if (slot != 0) continue;
+        }
+
+        partial_[slot] = result->type2.data;
+        if (++next_slot_ == channels_) {
+            std::copy(partial_.begin(), partial_.end(), frames + count * channels_);
+            ++count;
+            next_slot_ = 0;
+        }
+    }
+    return count;
+}
+
+/**
+ * @brief 停止连续采样并释放驱动资源
+ */
+void ESP32S3ADCSource::end() {
+    if (!running_) return;
+    adc_digi_stop();
+    adc_digi_deinitialize();
+    running_ = false;
+    ADC::adc1_continuous = false;  // 恢复 ADC1 单次读取
+}
+
+/**
+ * @brief 将原始读数换算为电压
+ * @return 电压(mV)
+ */
+uint32_t ESP32S3ADCSource::toMillivolts(size_t, uint16_t raw) const { return esp_adc_cal_raw_to_voltage(raw, &adc_chars_); }
@@ -0,0 +1,83 @@
+/**
+ * @file adc_source_esp32_s3.h
+ * @date 17.10.2026
+ * @author RMSHE
+ *
+ * < GasSensorOS >
+ * Copyright(C) 2026 RMSHE. All rights reserved.
+ *
+ * This program is free software : you can redistribute it and /or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.If not, see < https://www.gnu.org/licenses/>.
+ *
+ * Electronic Mail : asdfghjkl851@outlook.com
+ */
+
+#pragma once
+
+#include <adc_sampler.hpp>
+#include <driver/adc.h>
+#include <esp32_s3_pin_defi.h>
+#include <esp_adc_cal.h>
+#include <esp_idf_version.h>
+#include <io_esp32_s3.h>
+
+// adc_digi_* 连续采样接口与 type2 输出格式属于 ESP-IDF 4.4(arduino-esp32 2.x), 5.x 中已被 adc_continuous_* 取代;
+// platformio.ini 将 platform 固定在 espressif32 6.x, 升级框架前需改写本文件
+#if ESP_IDF_VERSION_MAJOR != 4
+#error "ESP32S3ADCSource requires ESP-IDF 4.4 (arduino-esp32 2.x, platform espressif32 6.x)"
+#endif
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief ESP32-S3 ADC1 连续(DMA)采样源
+ *
+ * begin() 时一次性配置采样模式表、衰减系数与 esp_adc_cal 校准参数，之后由 ADC 数字控制器按固定频率轮流转换各通道，
+ * 结果经 DMA 写入驱动的缓冲区，read() 只是取出并按通道拼装成帧，不再有逐次读取的配置与校准开销。
+ *
+ * @note 连续模式只支持 ADC1(GPIO1 ~ GPIO10)；所有通道使用同一个固定的衰减系数，不做逐次自动量程。
+ * @note 采样期间 ADC1 由数字控制器独占: ADC::gpioReadAnalogBit() 对 ADC1 引脚的单次读取会被拒绝(告警并保持默认读数),
+ *       ADC2 引脚不受影响；同一时刻只能有一个 ESP32S3ADCSource 处于运行状态。
+ */
+class ESP32S3ADCSource : public ADCSampleSource {
+   public:
+    /**
+     * @brief 构造函数
+     * @param atten 衰减系数, 默认 ADC_ATTEN_DB_11(量程约 0 ~ 3100mV)
+     */
+    explicit ESP32S3ADCSource(adc_atten_t atten = ADC_ATTEN_DB_11) : atten_(atten) {}
+    ~ESP32S3ADCSource() override { end(); }
+
+    bool begin(const std::vector<uint8_t> &pins, uint32_t sampleRate) override;
+    size_t read(uint16_t *frames, size_t maxFrames, uint32_t timeoutMs) override;
+    void end() override;
+    uint32_t toMillivolts(size_t channel, uint16_t raw) const override;
+
+    // 驱动缓冲区溢出(有转换结果被丢弃)的次数
+    size_t overflows() const { return overflows_; }
+
+   private:
+    bool configure(const std::vector<uint8_t> &pins, uint32_t sampleRate);
+
+    adc_atten_t atten_;
+    bool running_ = false;
+    esp_adc_cal_characteristics_t adc_chars_ = {};  // 校准参数(begin() 时计算一次)
+
+    std::vector<int8_t> slot_of_channel_;  // ADC1 通道号 -> 帧内位置(-1 表示未使用)
+    size_t channels_ = 0;                  // 每帧的通道数
+    std::vector<uint8_t> dma_;             // 转换结果的读取缓冲区
+    std::vector<uint16_t> partial_;        // 正在拼装的一帧
+    size_t next_slot_ = 0;                 // 正在拼装的帧中下一个样本的位置
+    size_t overflows_ = 0;
+};
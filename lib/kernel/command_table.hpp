@@ -183,6 +183,12 @@ class COMMAND_TABLE {
         // 挂载文件系统
         add_cmd("mount", {}, std::bind(&FileExplorerShell::mount, &file_explorer_shell, std::placeholders::_1, std::placeholders::_2));
 
+        // 写回文件缓存
+        add_cmd("sync", {}, std::bind(&FileExplorerShell::sync, &file_explorer_shell, std::placeholders::_1, std::placeholders::_2));
+
+        // 重建目录索引
+        add_cmd("reindex", {}, std::bind(&FileExplorerShell::reindex, &file_explorer_shell, std::placeholders::_1, std::placeholders::_2));
+
         // 切换当前工作目录
         add_cmd("cd", {}, std::bind(&FileExplorerShell::cd, &file_explorer_shell, std::placeholders::_1, std::placeholders::_2));
 
@@ -99,6 +99,8 @@ uint32_t ADC::gpioReadVoltage() { return voltage; };
  */
 void ADC::setAnalogOutputMode(bool mode) { OUTPUT_MODE = mode; }
 
+std::atomic<bool> ADC::adc1_continuous{false};
+
 /**
  * @brief 读取模拟数值和电压
  * @param pin: 拥有 ADC1 和 ADC2 单元的GPIO引脚
@@ -150,6 +152,12 @@ void ADC::gpioReadAnalogBit(uint8_t pin) {
     } else if ((esp32_s3_wroom_1_gpios.find(pin)->second).find(ADC1) != (esp32_s3_wroom_1_gpios.find(pin)->second).end()) {
         /*若用户使用的引脚属于 ADC1 单元*/
 
+        // 连续采样期间 ADC1 由数字控制器独占, 单次读取会打乱其配置
+        if (adc1_continuous) {
+            WARN(WarningLevel::WARNING, "ADC1 is in continuous sampling, one-shot read refused, pin:%d", pin);
+            return;
+        }
+
         // 通过 GPIO 编号来查找对应的 ADC1 通道;
         adc1_channel_t channel = gpio_to_adc1_channel.find(pin)->second;
 
@@ -28,6 +28,7 @@
 #include <driver/gpio.h>
 #include <driver/ledc.h>
 
+#include <atomic>
 #include <cstdint>
 #include <map>
 #include <unordered_map>
@@ -39,6 +40,7 @@ constexpr bool ADC_OUT_VOLTAGE = true;     // ADC电压输出
 
 class ADC {
     friend class GPIOs;
+    friend class ESP32S3ADCSource;
 
    public:
     // 获取模拟引脚读取的模拟数值
@@ -59,6 +61,9 @@ class ADC {
 
     int32_t raw_value = 4095;  // ADC 数值(0-4095)
     uint32_t voltage = 3300;   // ADC 电压(0-3300mv)
+
+    // ADC1 是否正被 ESP32S3ADCSource 连续(DMA)采样占用; 占用期间拒绝 ADC1 引脚的单次读取
+    static std::atomic<bool> adc1_continuous;
 };
 
 class GPIOs : public ADC {
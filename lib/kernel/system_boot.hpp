@@ -4,6 +4,8 @@
 #include <freertos/task.h>
 #include <systime.h>
 
+#include <file_explorer.h>
+
 // 时间更新任务
 void update_time_task(void* pvParameters) {
     while (true) {
@@ -12,6 +14,14 @@ void update_time_task(void* pvParameters) {
     }
 }
 
+// 写回缓存轮询任务: 追加停止后按 maxAgeMs 把滞留的缓冲数据写回闪存
+void write_cache_task(void* pvParameters) {
+    while (true) {
+        FileExplorer::writeCache().poll();
+        vTaskDelay(pdMS_TO_TICKS(250));  // 轮询周期远小于默认的 maxAgeMs(2000ms)
+    }
+}
+
 void system_boot() {
     // 初始化系统时间为 2025-01-01 00:00:00
     time_t initial_time = 1672531200;  // 2025-01-01 00:00:00 的 UNIX 时间戳
@@ -19,4 +29,7 @@ void system_boot() {
 
     // 创建时间更新任务
     xTaskCreate(update_time_task, "UpdateTimeTask", 2048, NULL, 1, NULL);
+
+    // 创建写回缓存轮询任务(写回时会打开 LittleFS 文件, 需要较大的栈)
+    xTaskCreate(write_cache_task, "WriteCacheTask", 4096, NULL, 1, NULL);
 }
\ No newline at end of file
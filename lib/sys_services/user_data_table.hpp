@@ -37,7 +37,9 @@
 class USER_DATA {
    public:
     // 构造函数，初始化迭代次数和盐长度
-    USER_DATA(uint32_t iterations = 10000, size_t salt_len = 64) : iterations_(iterations), salt_len_(salt_len), pbkdf2(iterations, 64) {}
+    USER_DATA(uint32_t iterations = 10000, size_t salt_len = 64) : iterations_(iterations), salt_len_(salt_len), pbkdf2(iterations, 64) {
+        table.createIndex(0);  // 用户名列建立哈希索引, 查找用户为 O(1)
+    }
 
     /**
      * @brief 添加用户
@@ -113,12 +115,8 @@ class USER_DATA {
      * @return true: 存在; false: 不存在;
      */
     bool query_user(const std::string& username, size_t& row) {
-        // 查询用户名并获取行号
-        auto result = table.query(username);
-        if (!result.empty()) {
-            row = result[0].first;
-            return true;  // 用户存在
-        }
+        // 只在用户名列中查找(避免与密钥、盐值列中的内容误匹配)
+        if (table.findRow(username, 0, row)) return true;  // 用户存在
         row = -1;  // 用户不存在
         return false;
     }
@@ -0,0 +1,51 @@
+/**
+ * @file host_serial.hpp
+ * @date 17.10.2026
+ * @author RMSHE
+ *
+ * < GasSensorOS >
+ * Copyright(C) 2026 RMSHE. All rights reserved.
+ *
+ * This program is free software : you can redistribute it and /or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.If not, see < https://www.gnu.org/licenses/>.
+ *
+ * Electronic Mail : asdfghjkl851@outlook.com
+ */
+#pragma once
+
+// 在开发板上直接使用 Arduino 提供的 Serial 对象
+#ifdef ARDUINO
+#include <Arduino.h>
+#else
+#include <cstdint>
+#include <cstdio>
+
+/**
+ * @brief 主机端串口替身
+ *
+ * 在非 Arduino 环境下(主机编译)提供与 `Serial.print`/`Serial.println`/`Serial.write` 相同的调用形式，
+ * 输出重定向到标准输出，使依赖串口打印的组件可以在主机上运行。
+ */
+class HostSerial {
+   public:
+    void begin(unsigned long) {}
+    void print(const char* str) { std::fputs(str, stdout); }
+    void println(const char* str = "") {
+        std::fputs(str, stdout);
+        std::fputs("\r\n", stdout);
+    }
+    size_t write(const uint8_t* data, size_t size) { return std::fwrite(data, 1, size, stdout); }
+};
+
+inline HostSerial Serial;
+#endif
@@ -22,8 +22,7 @@
  * Electronic Mail : asdfghjkl851@outlook.com
  */
 
-#include <Arduino.h>
-
+#include <host_serial.hpp>
 #include <serial_warning.hpp>
 
 // 根据警告等级返回对应的字符串表示，用于在日志输出中显示
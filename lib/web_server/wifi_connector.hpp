@@ -183,49 +183,27 @@ class WiFiConnector {
             return;
         }
 
-        // 统一的 WifiList 保存步骤（写临时文件 -> 校验 -> 原子替换）
-        // 使用 lambda 局部封装，避免重复代码，同时便于将来扩展（例如增加校验、备份等）
-        auto writeWifiList = [this](DataTable& table) -> bool {
-            // 写入临时文件
-            table.saveTable(wifi_list_temp_path_, "w");
-            if (!file_.exists(wifi_list_temp_path_)) {
-                WARN(WarningLevel::ERROR, "Failed to write WifiList file, path: %s", wifi_list_temp_path_.c_str());
-                return false;
-            }
-
-            // 删除旧文件（存在则删）
-            if (file_.exists(wifi_list_path_)) file_.deletePath(wifi_list_path_);
-
-            // 原子替换：重命名临时文件为正式文件
-            file_.renamePath(wifi_list_temp_path_, "wifi_list.csv");
-            return true;
-        };
-
         // 加载或初始化凭据表
         DataTable wifi_list(1, 2);
         if (!file_.exists(wifi_list_path_)) {
             // 凭据文件不存在：创建并写入首条记录
             wifi_list.replaceRow({ssid_, password_}, 0);
-            writeWifiList(wifi_list);
+            wifi_list.syncTable(wifi_list_path_);  // 写临时文件后原子替换
             return;
         }
 
         // 文件存在：加载并处理
         wifi_list.loadTable(wifi_list_path_);
 
-        // 查询是否已有相同 SSID
-        std::vector<std::pair<size_t, size_t>> locations = wifi_list.query(ssid_);
-
-        if (locations.empty()) {
+        // 查询是否已有相同 SSID(只查 SSID 列, 避免与密码列误匹配)
+        size_t rowIndex = 0;
+        if (!wifi_list.findRow(ssid_, 0, rowIndex)) {
             // 无相同 SSID：在第一行插入新条目
             wifi_list.insertRow({ssid_, password_}, 0);
-            writeWifiList(wifi_list);
+            wifi_list.syncTable(wifi_list_path_);  // 写临时文件后原子替换
             return;
         }
 
-        // 已存在相同 SSID，定位相同 SSID 的所在行
-        size_t rowIndex = locations[0].first;
-
         // 如已在第一行则避免不必要的闪存写入；否则仅上移以提升优先级
         if (rowIndex == 0) return;
 
@@ -233,7 +211,7 @@ class WiFiConnector {
         wifi_list.deleteRow(rowIndex);
         wifi_list.insertRow({ssid_, password_}, 0);
 
-        writeWifiList(wifi_list);
+        wifi_list.syncTable(wifi_list_path_);  // 写临时文件后原子替换
     }
 
     /**
@@ -317,7 +295,6 @@ class WiFiConnector {
 
     FileExplorer file_;
     const std::string wifi_list_path_ = "/.os/wifi_list.csv";            // Wi-Fi列表文件路径
-    const std::string wifi_list_temp_path_ = "/.os/wifi_list_temp.csv";  // Wi-Fi列表临时文件路径(用于安全替换)
 };
 
 inline void WiFiConnector::setWifiCredentials(const std::string& ssid, const std::string& password) {
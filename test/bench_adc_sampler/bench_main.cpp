@@ -0,0 +1,64 @@
+/**
+ * @file bench_main.cpp
+ * @date 17.10.2026
+ * @author RMSHE
+ *
+ * < GasSensorOS >
+ * Copyright(C) 2026 RMSHE. All rights reserved.
+ *
+ * This program is free software : you can redistribute it and /or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.If not, see < https://www.gnu.org/licenses/>.
+ *
+ * Electronic Mail : asdfghjkl851@outlook.com
+ */
+
+// ADCSampler 引擎自身的吞吐量(拆分通道、缓冲区交接与回调, 含合成采样源的开销):
+// pio test -e native_bench -f bench_adc_sampler -v
+
+#include <unity.h>
+
+#include <adc_sampler.hpp>
+#include <cstdio>
+
+void setUp() {}
+void tearDown() {}
+
+void bench_engine_throughput() {
+    for (size_t channels : {1, 4, 8}) {
+        SyntheticADCSource source([](size_t, double) { return 1000.0f; });
+        ADCSampler::Config config;
+        config.pins.resize(channels);
+        for (size_t ch = 0; ch < channels; ++ch) config.pins[ch] = static_cast<uint8_t>(ch + 1);
+        config.blockFrames = 256;
+
+        uint64_t checksum = 0;
+        ADCSampler sampler(source, config, [&](const ADCSampler::Block& block) { checksum += block.channel(0)[0]; });
+        TEST_ASSERT_TRUE(sampler.start(false));
+        auto t0 = std::chrono::steady_clock::now();
+        while (sampler.frames() < 2000000) {
+            sampler.pump();
+            sampler.poll();
+        }
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+        sampler.stop();
+        TEST_ASSERT_EQUAL_size_t(0, sampler.droppedBlocks());
+        std::printf("%zu ch: %6.1f M frames/s, %6.1f M samples/s (%llu)\n", channels, sampler.frames() / seconds / 1e6,
+                    sampler.frames() * channels / seconds / 1e6, static_cast<unsigned long long>(checksum));
+    }
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(bench_engine_throughput);
+    return UNITY_END();
+}
@@ -0,0 +1,83 @@
+/**
+ * @file bench_main.cpp
+ * @date 17.10.2026
+ * @author RMSHE
+ *
+ * < GasSensorOS >
+ * Copyright(C) 2026 RMSHE. All rights reserved.
+ *
+ * This program is free software : you can redistribute it and /or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.If not, see < https://www.gnu.org/licenses/>.
+ *
+ * Electronic Mail : asdfghjkl851@outlook.com
+ */
+
+// DataTable 加载 10k 行 CSV 的基准测试: pio test -e native_bench -f bench_csv_parser -v
+
+#include <unity.h>
+
+#include <chrono>
+#include <cstdio>
+#include <data_table.hpp>
+#include <sstream>
+
+void setUp() {}
+void tearDown() {}
+
+// 改用流式解析器之前的做法: 逐行 getline 再按逗号切分(只计解析, 不含文件读取)
+static size_t getlineParse(const std::string& text) {
+    std::vector<std::vector<std::string>> rows;
+    std::istringstream input(text);
+    std::string line;
+    while (std::getline(input, line)) {
+        std::istringstream line_stream(line);
+        std::vector<std::string> row;
+        std::string cell;
+        while (std::getline(line_stream, cell, ',')) row.push_back(cell);
+        rows.push_back(row);
+    }
+    return rows.size();
+}
+
+void bench_load_10k_rows() {
+    const size_t rows = 10000;
+    DataTable table(rows, 4, "");
+    for (size_t i = 0; i < rows; ++i)
+        table.replaceRow({std::to_string(1760000000 + i * 60), std::to_string(20 + i % 100 / 10.0), std::to_string(400 + i % 300), "sensor-" + std::to_string(i % 8)}, i);
+    table.saveTable("/big.csv");
+
+    FileManager file;
+    std::string text;
+    TEST_ASSERT_TRUE(file.readFileAsString("/big.csv", text));
+
+    const int rounds = 10;
+    auto t0 = std::chrono::steady_clock::now();
+    for (int k = 0; k < rounds; ++k) TEST_ASSERT_EQUAL_size_t(rows, getlineParse(text));
+    auto t1 = std::chrono::steady_clock::now();
+    for (int k = 0; k < rounds; ++k) {
+        DataTable loaded(1, 1, "");
+        loaded.loadTable("/big.csv");
+        TEST_ASSERT_EQUAL_size_t(rows, loaded.getRowSize());
+    }
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::printf("%zu rows (%zu B): getline parse only %.2f ms/load, loadTable incl. file I/O %.2f ms/load\n", rows, text.size(),
+                std::chrono::duration<double, std::milli>(t1 - t0).count() / rounds, std::chrono::duration<double, std::milli>(t2 - t1).count() / rounds);
+}
+
+int main() {
+    PosixFSBackend::setRoot(".pio/gsos_bench_fs");
+    UNITY_BEGIN();
+    RUN_TEST(bench_load_10k_rows);
+    return UNITY_END();
+}
@@ -0,0 +1,120 @@
+/**
+ * @file bench_main.cpp
+ * @date 17.10.2026
+ * @author RMSHE
+ *
+ * < GasSensorOS >
+ * Copyright(C) 2026 RMSHE. All rights reserved.
+ *
+ * This program is free software : you can redistribute it and /or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.If not, see < https://www.gnu.org/licenses/>.
+ *
+ * Electronic Mail : asdfghjkl851@outlook.com
+ */
+
+// DataTable 批量操作在 1k/100k/1M 行上的基准测试(结果与逐单元格的朴素实现对照):
+// pio test -e native_bench -f bench_data_table -v
+
+#include <unity.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <data_table.hpp>
+#include <random>
+
+void setUp() {}
+void tearDown() {}
+
+static double msSince(std::chrono::steady_clock::time_point since) { return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - since).count(); }
+
+// 逐单元格解析数值(非数值单元格返回 false)
+static bool parseCell(const std::string& cell, double& value) {
+    char* end = nullptr;
+    value = std::strtod(cell.c_str(), &end);
+    return !cell.empty() && *end == '\0';
+}
+
+static void benchRows(size_t rows) {
+    // 两列: 分组键(50 个不同值)与数值(约 1% 为非数值单元格)
+    DataTable table(0, 2);
+    std::mt19937 rng(1);
+    for (size_t i = 0; i < rows; ++i) {
+        std::string key = "g" + std::to_string(rng() % 50);
+        std::string value = (rng() % 97 == 0) ? "x" : std::to_string((rng() % 100000) / 10.0);
+        table.insertRow({key, value});
+    }
+
+    // 朴素实现: 每次 getCell 后解析
+    auto t0 = std::chrono::steady_clock::now();
+    size_t naive_count = 0;
+    double naive_sum = 0;
+    for (size_t i = 0; i < rows; ++i) {
+        double value;
+        if (!parseCell(table.getCell(i, 1), value)) continue;
+        if (value >= 100 && value <= 200) ++naive_count;
+        naive_sum += value;
+    }
+    double naive_ms = msSince(t0);
+
+    for (size_t threads : {static_cast<size_t>(1), static_cast<size_t>(0)}) {
+        table.setBulkThreads(threads);
+
+        t0 = std::chrono::steady_clock::now();
+        std::vector<size_t> filtered = table.filterRange(1, 100, 200);
+        double filter_ms = msSince(t0);
+
+        t0 = std::chrono::steady_clock::now();
+        std::vector<DataTable::GroupStats> groups = table.groupBy(0, 1);
+        double group_ms = msSince(t0);
+
+        t0 = std::chrono::steady_clock::now();
+        std::vector<size_t> top = table.topK(1, 10);
+        double top_ms = msSince(t0);
+
+        TEST_ASSERT_EQUAL_size_t(naive_count, filtered.size());
+        double group_sum = 0;
+        size_t group_rows = 0;
+        for (auto& group : groups) {
+            group_sum += group.sum;
+            group_rows += group.rows;
+        }
+        TEST_ASSERT_EQUAL_size_t(rows, group_rows);
+        TEST_ASSERT_TRUE(std::fabs(group_sum - naive_sum) <= 1e-6 * naive_sum);
+        std::vector<double> values = table.getNumericCol(1);
+        for (size_t i = 1; i < top.size(); ++i) TEST_ASSERT_TRUE(values[top[i - 1]] >= values[top[i]]);
+
+        std::printf("rows=%-8zu threads=%zu  naive scan %8.2f ms  filterRange %7.2f ms  groupBy %7.2f ms  topK %7.2f ms\n", rows, threads, naive_ms,
+                    filter_ms, group_ms, top_ms);
+    }
+
+    t0 = std::chrono::steady_clock::now();
+    table.sortRows(1, true, true);
+    double sort_ms = msSince(t0);
+    std::vector<double> values = table.getNumericCol(1);
+    for (size_t i = 1; i < rows; ++i) TEST_ASSERT_TRUE(std::isnan(values[i]) || values[i - 1] <= values[i]);
+    std::printf("rows=%-8zu sortRows(numeric) %.2f ms\n", rows, sort_ms);
+}
+
+void bench_bulk_1k() { benchRows(1000); }
+void bench_bulk_100k() { benchRows(100000); }
+void bench_bulk_1m() { benchRows(1000000); }
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(bench_bulk_1k);
+    RUN_TEST(bench_bulk_100k);
+    RUN_TEST(bench_bulk_1m);
+    return UNITY_END();
+}
@@ -0,0 +1,121 @@
+/**
+ * @file bench_main.cpp
+ * @date 17.10.2026
+ * @author RMSHE
+ *
+ * < GasSensorOS >
+ * Copyright(C) 2026 RMSHE. All rights reserved.
+ *
+ * This program is free software : you can redistribute it and /or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.If not, see < https://www.gnu.org/licenses/>.
+ *
+ * Electronic Mail : asdfghjkl851@outlook.com
+ */
+
+// 定长滤波器块处理吞吐量(Msamples/s), 以及取模环形索引 FIR 与复制排序中值的朴素实现对照:
+// pio test -e native_bench -f bench_digital_filter -v
+
+#include <unity.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <digital_filter.hpp>
+#include <random>
+#include <vector>
+
+void setUp() {}
+void tearDown() {}
+
+static const size_t samples = 1 << 20;
+static std::vector<float> input, output(samples);
+
+static double megaSamplesPerSecond(std::chrono::steady_clock::time_point t0) {
+    return samples / std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count() / 1e6;
+}
+
+template <typename Filter>
+static void run(const char* name, Filter& filter) {
+    auto t0 = std::chrono::steady_clock::now();
+    filter.process(input.data(), output.data(), samples);
+    std::printf("%-24s %7.1f Msamples/s (%g)\n", name, megaSamplesPerSecond(t0), static_cast<double>(output[12345]));
+}
+
+void bench_filters() {
+    std::array<float, 16> h16;
+    h16.fill(1.0f / 16);
+    FIRFilter<float, 16> fir16(h16);
+    run("FIRFilter<16>", fir16);
+
+    std::array<float, 64> h64;
+    h64.fill(1.0f / 64);
+    FIRFilter<float, 64> fir64(h64);
+    run("FIRFilter<64>", fir64);
+
+    const auto c = BiquadCoefficients<float>::lowPass(100, 10);
+    BiquadCascade<float, 4> biquad({c, c, c, c});
+    run("BiquadCascade<4>", biquad);
+
+    MovingAverage<float, 32> average;
+    run("MovingAverage<32>", average);
+
+    MovingMedian<float, 7> median;
+    run("MovingMedian<7>", median);
+
+    ExponentialSmoothing<float> smoothing(0.1f);
+    run("ExponentialSmoothing", smoothing);
+}
+
+// 运行期抽头数 + 每次取模的环形延迟线
+void bench_naive_fir() {
+    for (size_t taps : {16, 64}) {
+        std::vector<float> h(taps, 1.0f / taps), delay(taps, 0.0f);
+        size_t head = 0;
+        auto t0 = std::chrono::steady_clock::now();
+        for (size_t n = 0; n < samples; ++n) {
+            delay[head] = input[n];
+            float acc = 0;
+            for (size_t i = 0; i < taps; ++i) acc += h[i] * delay[(head + taps - i) % taps];
+            head = (head + 1) % taps;
+            output[n] = acc;
+        }
+        std::printf("naive FIR %-14zu %7.1f Msamples/s (%g)\n", taps, megaSamplesPerSecond(t0), static_cast<double>(output[12345]));
+    }
+}
+
+// 每个样本复制窗口并排序
+void bench_naive_median() {
+    std::vector<float> window;
+    auto t0 = std::chrono::steady_clock::now();
+    for (size_t n = 0; n < samples; ++n) {
+        window.push_back(input[n]);
+        if (window.size() > 7) window.erase(window.begin());
+        std::vector<float> sorted = window;
+        std::sort(sorted.begin(), sorted.end());
+        output[n] = sorted[(sorted.size() - 1) / 2];
+    }
+    std::printf("naive median 7           %7.1f Msamples/s (%g)\n", megaSamplesPerSecond(t0), static_cast<double>(output[12345]));
+}
+
+int main() {
+    std::mt19937 rng(1);
+    std::uniform_real_distribution<float> uniform(-1.0f, 1.0f);
+    input.resize(samples);
+    for (auto& value : input) value = uniform(rng);
+
+    UNITY_BEGIN();
+    RUN_TEST(bench_filters);
+    RUN_TEST(bench_naive_fir);
+    RUN_TEST(bench_naive_median);
+    return UNITY_END();
+}
@@ -0,0 +1,122 @@
+/**
+ * @file bench_main.cpp
+ * @date 17.10.2026
+ * @author RMSHE
+ *
+ * < GasSensorOS >
+ * Copyright(C) 2026 RMSHE. All rights reserved.
+ *
+ * This program is free software : you can redistribute it and /or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.If not, see < https://www.gnu.org/licenses/>.
+ *
+ * Electronic Mail : asdfghjkl851@outlook.com
+ */
+
+// 文件系统栈在 POSIX 后端上的基准测试: pio test -e native_bench -f bench_file_system -v
+
+#include <unity.h>
+
+#include <chrono>
+#include <cstdio>
+#include <file_explorer.h>
+
+static FileExplorer* fe = nullptr;
+
+static double elapsedMs(std::chrono::steady_clock::time_point since) { return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - since).count(); }
+
+void setUp() { fe->createDir("/b"); }
+void tearDown() { fe->deletePath("/b"); }
+
+// 建立 dirs x files 的目录结构
+static void populate(int dirs, int files) {
+    for (int d = 0; d < dirs; ++d) {
+        std::string dir = "/b/d" + std::to_string(d);
+        fe->createDir(dir);
+        for (int f = 0; f < files; ++f) fe->createFile(dir + "/f" + std::to_string(f) + ".txt");
+    }
+}
+
+// 创建文件、查找与模糊搜索
+void bench_create_find_search() {
+    auto t0 = std::chrono::steady_clock::now();
+    populate(50, 20);
+    double create_ms = elapsedMs(t0);
+
+    t0 = std::chrono::steady_clock::now();
+    size_t found = 0;
+    for (int i = 0; i < 20; ++i) found += fe->findPath("f7.txt", "/b").size();
+    double find_ms = elapsedMs(t0) / 20;
+
+    t0 = std::chrono::steady_clock::now();
+    size_t matched = fe->searchPath("f7.txt", "/b", 0.8f).size();
+    double search_ms = elapsedMs(t0);
+
+    TEST_ASSERT_EQUAL_size_t(20 * 50, found);
+    TEST_ASSERT_TRUE(matched >= 50);
+    std::printf("create 1000 files: %.1f ms, findPath: %.2f ms, searchPath: %.2f ms\n", create_ms, find_ms, search_ms);
+}
+
+// 原地重命名与复制+删除移动目录的对比
+void bench_move_native_vs_copy() {
+    populate(10, 20);
+    for (int d = 0; d < 10; ++d) fe->writeFileAsString("/b/d" + std::to_string(d) + "/f0.txt", std::string(4096, 'x'), "w");
+
+    auto t0 = std::chrono::steady_clock::now();
+    FileExplorer::MoveStats stats = fe->movePath("/b/d0", "/b/m0");
+    double rename_ms = elapsedMs(t0);
+    TEST_ASSERT_TRUE(stats.success && stats.native);
+
+    t0 = std::chrono::steady_clock::now();
+    fe->copyPath("/b/d1", "/b/m1");
+    fe->deletePath("/b/d1");
+    double copy_ms = elapsedMs(t0);
+    TEST_ASSERT_TRUE(fe->exists("/b/m1/f0.txt"));
+
+    std::printf("move 20-file dir: rename %.3f ms, copy+delete %.3f ms\n", rename_ms, copy_ms);
+}
+
+// 逐行追加: 直接写入与写回缓存的对比
+void bench_append_direct_vs_cached() {
+    const int N = 20000;
+    const std::string line = "1760000000,23.51,41.20,412,0.013\n";
+    WriteBehindCache& cache = FileExplorer::writeCache();
+
+    auto run = [&](const char* name) {
+        fe->deletePath("/b/s.csv");
+        fe->createFile("/b/s.csv");
+        size_t writeBacks = cache.stats().writeBacks;
+        auto t0 = std::chrono::steady_clock::now();
+        for (int i = 0; i < N; ++i) fe->writeFileAsString("/b/s.csv", line, "a");
+        cache.sync();
+        double ms = elapsedMs(t0);
+        TEST_ASSERT_EQUAL_size_t(N * line.size(), fe->readFileAsString("/b/s.csv").size());
+        std::printf("%s: %.0f appends/s, write-backs %zu\n", name, N / ms * 1000, cache.stats().writeBacks - writeBacks);
+    };
+
+    run("direct");
+    cache.setConfig({true, 4096, 16384, 2000});
+    run("cached");
+    cache.setConfig({false, 4096, 16384, 2000});
+}
+
+int main() {
+    PosixFSBackend::setRoot(".pio/gsos_bench_fs");
+    FileExplorer explorer;
+    fe = &explorer;
+
+    UNITY_BEGIN();
+    RUN_TEST(bench_create_find_search);
+    RUN_TEST(bench_move_native_vs_copy);
+    RUN_TEST(bench_append_direct_vs_cached);
+    return UNITY_END();
+}
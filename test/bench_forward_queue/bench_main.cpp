@@ -0,0 +1,132 @@
+/**
+ * @file bench_main.cpp
+ * @date 17.10.2026
+ * @author RMSHE
+ *
+ * < GasSensorOS >
+ * Copyright(C) 2026 RMSHE. All rights reserved.
+ *
+ * This program is free software : you can redistribute it and /or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.If not, see < https://www.gnu.org/licenses/>.
+ *
+ * Electronic Mail : asdfghjkl851@outlook.com
+ */
+
+// forward_queue(预分配环形存储)与原 std::deque 实现的堆分配与吞吐量对比:
+// pio test -e native_bench -f bench_forward_queue -v
+
+#include <unity.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <forward_queue.hpp>
+#include <new>
+#include <string>
+
+// 统计堆分配次数与字节数
+// 替换的 operator delete 不内联, 否则 GCC 会把内联后的 free() 与 new 表达式配对并给出 -Wmismatched-new-delete
+static size_t heap_allocs = 0, heap_bytes = 0;
+
+__attribute__((noinline)) void* operator new(size_t size) {
+    ++heap_allocs;
+    heap_bytes += size;
+    void* block = std::malloc(size);
+    if (block == nullptr) throw std::bad_alloc();
+    return block;
+}
+__attribute__((noinline)) void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, size_t) noexcept { operator delete(ptr); }
+
+// 改用环形存储之前的实现: 头部插入, 满时从尾部弹出
+struct DequeQueue {
+    explicit DequeQueue(size_t max_size) : max_size(max_size) {}
+    void push(const std::string& item) {
+        if (items.size() >= max_size) items.pop_back();
+        items.push_front(item);
+    }
+    void pop() {
+        if (!items.empty()) items.pop_back();
+    }
+    size_t max_size;
+    std::deque<std::string> items;
+};
+
+void setUp() {}
+void tearDown() {}
+
+// 与 std::deque 模型逐步对照(含 maxSize 为 0 的空队列)
+void bench_matches_deque_model() {
+    for (size_t capacity : {0, 1, 3, 5}) {
+        forward_queue<std::string> queue(capacity);
+        DequeQueue model(capacity);
+        for (int step = 0; step < 300; ++step) {
+            int op = (step * 31) % 7;
+            if (op < 4) {
+                queue.push(std::to_string(step));
+                if (capacity) model.push(std::to_string(step));
+            } else if (op < 6) {
+                queue.pop();
+                model.pop();
+            } else if (step % 3 == 0) {
+                queue.clear();
+                model.items.clear();
+            }
+            TEST_ASSERT_EQUAL_size_t(model.items.size(), queue.size());
+            auto items = queue.getItems();
+            TEST_ASSERT_TRUE(std::equal(items.begin(), items.end(), model.items.begin(), model.items.end()));
+        }
+    }
+}
+
+// 2M 次 push/pop 的堆分配与耗时
+void bench_push_pop_churn() {
+    const int operations = 2000000;
+    const size_t max_size = 64;
+
+    size_t allocs0 = heap_allocs, bytes0 = heap_bytes;
+    auto t0 = std::chrono::steady_clock::now();
+    {
+        DequeQueue queue(max_size);
+        for (int i = 0; i < operations; ++i) {
+            queue.push("k");
+            if (i % 3 == 0) queue.pop();
+        }
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    size_t allocs1 = heap_allocs, bytes1 = heap_bytes;
+    {
+        forward_queue<std::string> queue(max_size);
+        for (int i = 0; i < operations; ++i) {
+            queue.push("k");
+            if (i % 3 == 0) queue.pop();
+        }
+    }
+    auto t2 = std::chrono::steady_clock::now();
+    size_t allocs2 = heap_allocs, bytes2 = heap_bytes;
+
+    TEST_ASSERT_EQUAL_size_t(1, allocs2 - allocs1);  // 只在构造时分配一次
+    std::printf("std::deque:    %5.1f ns/op, %7zu allocs, %9zu B\n", std::chrono::duration<double, std::nano>(t1 - t0).count() / operations, allocs1 - allocs0,
+                bytes1 - bytes0);
+    std::printf("forward_queue: %5.1f ns/op, %7zu allocs, %9zu B\n", std::chrono::duration<double, std::nano>(t2 - t1).count() / operations, allocs2 - allocs1,
+                bytes2 - bytes1);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(bench_matches_deque_model);
+    RUN_TEST(bench_push_pop_churn);
+    return UNITY_END();
+}
@@ -0,0 +1,78 @@
+/**
+ * @file bench_main.cpp
+ * @date 17.10.2026
+ * @author RMSHE
+ *
+ * < GasSensorOS >
+ * Copyright(C) 2026 RMSHE. All rights reserved.
+ *
+ * This program is free software : you can redistribute it and /or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.If not, see < https://www.gnu.org/licenses/>.
+ *
+ * Electronic Mail : asdfghjkl851@outlook.com
+ */
+
+// FFT/DFT 吞吐量(每秒变换次数, N=64..4096), 当前内核与标量参考内核对比:
+// pio test -e native_bench -f bench_fourier_transform -v
+
+#include <unity.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fourier_transform.hpp>
+#include <random>
+
+void setUp() {}
+void tearDown() {}
+
+template <typename Function>
+static double transformsPerSecond(int rounds, Function&& function) {
+    auto t0 = std::chrono::steady_clock::now();
+    for (int r = 0; r < rounds; ++r) function();
+    return rounds / std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+}
+
+void bench_transforms_per_second() {
+    std::printf("kernel: %s\n", FastFourierTransform::kernelName());
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<float> uniform(-1.0f, 1.0f);
+    FastFourierTransform fft;
+    DiscreteFourierTransform dft;
+
+    for (size_t n = 64; n <= 4096; n *= 2) {
+        std::vector<std::complex<float>> x(n), y(n), out(n);
+        std::vector<float> real(n);
+        for (size_t i = 0; i < n; ++i) {
+            x[i] = {uniform(rng), uniform(rng)};
+            real[i] = uniform(rng);
+        }
+        y = x;
+        int rounds = static_cast<int>(2000000 / n);
+        int dft_rounds = std::max(1, static_cast<int>(200000000 / (n * n)));
+
+        double vector_rate = transformsPerSecond(rounds, [&] { fft.transform(y.data(), n); });
+        double scalar_rate = transformsPerSecond(rounds, [&] { fft.transformReference(y.data(), n); });
+        double real_rate = transformsPerSecond(rounds, [&] { fft.realFFT(real.data(), n, out.data()); });
+        double dft_rate = transformsPerSecond(dft_rounds, [&] { dft.transform(x.data(), out.data(), n); });
+
+        TEST_ASSERT_TRUE(vector_rate > 0 && scalar_rate > 0);
+        std::printf("N=%4zu  FFT %9.0f/s  scalar FFT %9.0f/s  realFFT %9.0f/s  DFT %8.1f/s\n", n, vector_rate, scalar_rate, real_rate, dft_rate);
+    }
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(bench_transforms_per_second);
+    return UNITY_END();
+}
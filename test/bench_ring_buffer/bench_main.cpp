@@ -0,0 +1,134 @@
+/**
+ * @file bench_main.cpp
+ * @date 17.10.2026
+ * @author RMSHE
+ *
+ * < GasSensorOS >
+ * Copyright(C) 2026 RMSHE. All rights reserved.
+ *
+ * This program is free software : you can redistribute it and /or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.If not, see < https://www.gnu.org/licenses/>.
+ *
+ * Electronic Mail : asdfghjkl851@outlook.com
+ */
+
+// SPSCRingBuffer 与互斥锁保护的 RingBuffer 的双线程吞吐量对比: pio test -e native_bench -f bench_ring_buffer -v
+
+#include <unity.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <ring_buffer.h>
+#include <thread>
+
+static const uint32_t total = 5000000;
+
+void setUp() {}
+void tearDown() {}
+
+static double millionPerSecond(std::chrono::steady_clock::time_point since) {
+    return total / std::chrono::duration<double>(std::chrono::steady_clock::now() - since).count() / 1e6;
+}
+
+void bench_spsc_batch() {
+    SPSCRingBuffer<uint32_t, 1024> buffer;
+    auto t0 = std::chrono::steady_clock::now();
+    std::thread producer([&] {
+        uint32_t batch[64];
+        for (uint32_t i = 0; i < total;) {
+            uint32_t count = std::min<uint32_t>(64, total - i);
+            for (uint32_t k = 0; k < count; ++k) batch[k] = i + k;
+            size_t written = buffer.pushN(batch, count);
+            if (written == 0) std::this_thread::yield();
+            i += written;
+        }
+    });
+    uint32_t output[64], received = 0;
+    uint64_t sum = 0;
+    while (received < total) {
+        size_t count = buffer.popN(output, 64);
+        if (count == 0) std::this_thread::yield();
+        for (size_t k = 0; k < count; ++k) sum += output[k];
+        received += count;
+    }
+    producer.join();
+    TEST_ASSERT_EQUAL_UINT64(static_cast<uint64_t>(total) * (total - 1) / 2, sum);
+    std::printf("SPSC pushN/popN:     %6.1f M items/s\n", millionPerSecond(t0));
+}
+
+void bench_spsc_single() {
+    SPSCRingBuffer<uint32_t, 1024> buffer;
+    auto t0 = std::chrono::steady_clock::now();
+    std::thread producer([&] {
+        for (uint32_t i = 0; i < total;) {
+            if (buffer.tryPush(i))
+                ++i;
+            else
+                std::this_thread::yield();
+        }
+    });
+    uint32_t value, received = 0;
+    while (received < total) {
+        if (buffer.tryPop(value))
+            ++received;
+        else
+            std::this_thread::yield();
+    }
+    producer.join();
+    std::printf("SPSC tryPush/tryPop: %6.1f M items/s\n", millionPerSecond(t0));
+}
+
+void bench_mutex_ring_buffer() {
+    RingBuffer<uint32_t, 1024> buffer;
+    std::mutex mutex;
+    auto t0 = std::chrono::steady_clock::now();
+    std::thread producer([&] {
+        for (uint32_t i = 0; i < total;) {
+            bool pushed;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                pushed = !buffer.full();
+                if (pushed) buffer.pushBack(i);
+            }
+            if (pushed)
+                ++i;
+            else
+                std::this_thread::yield();
+        }
+    });
+    uint32_t received = 0;
+    while (received < total) {
+        bool popped;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            popped = !buffer.empty();
+            if (popped) buffer.popFront();
+        }
+        if (popped)
+            ++received;
+        else
+            std::this_thread::yield();
+    }
+    producer.join();
+    std::printf("mutex RingBuffer:    %6.1f M items/s\n", millionPerSecond(t0));
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(bench_spsc_batch);
+    RUN_TEST(bench_spsc_single);
+    RUN_TEST(bench_mutex_ring_buffer);
+    return UNITY_END();
+}
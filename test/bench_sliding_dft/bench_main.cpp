@@ -0,0 +1,85 @@
+/**
+ * @file bench_main.cpp
+ * @date 17.10.2026
+ * @author RMSHE
+ *
+ * < GasSensorOS >
+ * Copyright(C) 2026 RMSHE. All rights reserved.
+ *
+ * This program is free software : you can redistribute it and /or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.If not, see < https://www.gnu.org/licenses/>.
+ *
+ * Electronic Mail : asdfghjkl851@outlook.com
+ */
+
+// 少数频点跟踪: SlidingDFT/GoertzelBank 每样本更新与每样本做一次完整 realFFT 的对比:
+// pio test -e native_bench -f bench_sliding_dft -v
+
+#include <unity.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <fourier_transform.hpp>
+#include <random>
+#include <sliding_dft.hpp>
+
+void setUp() {}
+void tearDown() {}
+
+static double nsPerItem(std::chrono::steady_clock::time_point t0, std::chrono::steady_clock::time_point t1, double items) {
+    return std::chrono::duration<double, std::nano>(t1 - t0).count() / items;
+}
+
+void bench_five_bins_vs_full_fft() {
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> uniform(-1.0f, 1.0f);
+    const std::vector<size_t> bins = {3, 7, 11, 13, 17};
+    const std::vector<float> frequencies = {3, 7, 11, 13, 17};
+
+    for (size_t n : {256, 1024}) {
+        std::vector<float> x(1 << 18);
+        for (auto& value : x) value = uniform(rng);
+
+        SlidingDFT sliding(n, bins);
+        auto t0 = std::chrono::steady_clock::now();
+        sliding.push(x.data(), x.size());
+        auto t1 = std::chrono::steady_clock::now();
+
+        GoertzelBank goertzel(static_cast<float>(n), n, frequencies);  // fs = n 时频率即为频点编号
+        auto t2 = std::chrono::steady_clock::now();
+        goertzel.push(x.data(), x.size());
+        auto t3 = std::chrono::steady_clock::now();
+
+        // 同样的更新率下每个样本做一次完整的实数 FFT
+        FastFourierTransform fft;
+        std::vector<std::complex<float>> spectrum(n / 2 + 1);
+        const size_t rounds = 20000;
+        auto t4 = std::chrono::steady_clock::now();
+        for (size_t r = 0; r < rounds; ++r) fft.realFFT(x.data() + r % 1000, n, spectrum.data());
+        auto t5 = std::chrono::steady_clock::now();
+
+        // 滑动 DFT 的结果与最后一个窗口的完整 FFT 一致
+        fft.realFFT(x.data() + x.size() - n, n, spectrum.data());
+        for (size_t i = 0; i < bins.size(); ++i) TEST_ASSERT_TRUE(std::abs(sliding.value(i) - spectrum[bins[i]]) < 1e-3f * n);
+
+        std::printf("N=%4zu, 5 bins: SlidingDFT %5.1f ns/sample, GoertzelBank %5.1f ns/sample, realFFT per sample %7.0f ns\n", n, nsPerItem(t0, t1, x.size()),
+                    nsPerItem(t2, t3, x.size()), nsPerItem(t4, t5, rounds));
+    }
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(bench_five_bins_vs_full_fft);
+    return UNITY_END();
+}
@@ -0,0 +1,84 @@
+/**
+ * @file bench_main.cpp
+ * @date 17.10.2026
+ * @author RMSHE
+ *
+ * < GasSensorOS >
+ * Copyright(C) 2026 RMSHE. All rights reserved.
+ *
+ * This program is free software : you can redistribute it and /or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.If not, see < https://www.gnu.org/licenses/>.
+ *
+ * Electronic Mail : asdfghjkl851@outlook.com
+ */
+
+// SpectralAnalyzer 每个样本的开销(分帧加窗 + realFFT + Welch 平均 + 频带积分), 与每帧只做一次 realFFT 的下限对比:
+// pio test -e native_bench -f bench_spectral_analyzer -v
+
+#include <unity.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <spectral_analyzer.hpp>
+
+void setUp() {}
+void tearDown() {}
+
+static double nsPerItem(std::chrono::steady_clock::time_point t0, std::chrono::steady_clock::time_point t1, double items) {
+    return std::chrono::duration<double, std::nano>(t1 - t0).count() / items;
+}
+
+void bench_cost_per_sample() {
+    std::mt19937 rng(21);
+    std::normal_distribution<float> noise(0.0f, 1.0f);
+    std::vector<float> x(1 << 20);
+    for (auto& value : x) value = noise(rng);
+
+    for (size_t n : {256, 1024}) {
+        for (size_t hop : {n / 2, n / 4}) {
+            SpectralAnalyzer::Config config;
+            config.sampleRate = 1000.0f;
+            config.frameSize = n;
+            config.hopSize = hop;
+            config.bands = {{0.5f, 4.0f}, {4.0f, 8.0f}, {8.0f, 13.0f}, {13.0f, 30.0f}, {30.0f, 100.0f}};
+            SpectralAnalyzer analyzer(config);
+
+            auto t0 = std::chrono::steady_clock::now();
+            size_t frames = analyzer.push(x.data(), x.size());
+            auto t1 = std::chrono::steady_clock::now();
+
+            // 下限: 同样的帧数只做 realFFT
+            FastFourierTransform fft;
+            std::vector<std::complex<float>> spectrum(n / 2 + 1);
+            auto t2 = std::chrono::steady_clock::now();
+            for (size_t start = 0; start + n <= x.size(); start += hop) fft.realFFT(x.data() + start, n, spectrum.data());
+            auto t3 = std::chrono::steady_clock::now();
+
+            // 白噪声的 Welch 全频带功率接近方差 1
+            float total = 0;
+            for (float value : analyzer.welchPsd()) total += value * analyzer.binWidth();
+            TEST_ASSERT_FLOAT_WITHIN(0.05f, 1.0f, total);
+
+            std::printf("N=%4zu hop=%4zu: %6zu frames, SpectralAnalyzer %5.1f ns/sample (%6.0f ns/frame), realFFT only %5.1f ns/sample\n", n, hop, frames,
+                        nsPerItem(t0, t1, x.size()), nsPerItem(t0, t1, frames), nsPerItem(t2, t3, x.size()));
+        }
+    }
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(bench_cost_per_sample);
+    return UNITY_END();
+}
@@ -0,0 +1,118 @@
+/**
+ * @file bench_main.cpp
+ * @date 17.10.2026
+ * @author RMSHE
+ *
+ * < GasSensorOS >
+ * Copyright(C) 2026 RMSHE. All rights reserved.
+ *
+ * This program is free software : you can redistribute it and /or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.If not, see < https://www.gnu.org/licenses/>.
+ *
+ * Electronic Mail : asdfghjkl851@outlook.com
+ */
+
+// 树的构建/销毁基准测试(比较各索引策略与节点内存池): pio test -e native_bench -f bench_tree -v
+
+#include <unity.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <malloc.h>
+#include <new>
+#include <string>
+#include <tree.hpp>
+
+// 统计堆分配次数与峰值占用(按 malloc_usable_size 计, 不在块前附加头部)
+// 替换的 operator delete 不内联, 否则 GCC 会把内联后的 free() 与 new 表达式配对并给出 -Wmismatched-new-delete
+static size_t heap_current = 0, heap_peak = 0, heap_allocs = 0;
+
+__attribute__((noinline)) void* operator new(size_t size) {
+    void* block = std::malloc(size);
+    if (block == nullptr) throw std::bad_alloc();
+    heap_current += malloc_usable_size(block);
+    heap_peak = std::max(heap_peak, heap_current);
+    ++heap_allocs;
+    return block;
+}
+__attribute__((noinline)) void operator delete(void* ptr) noexcept {
+    if (ptr == nullptr) return;
+    heap_current -= malloc_usable_size(ptr);
+    std::free(ptr);
+}
+void operator delete(void* ptr, size_t) noexcept { operator delete(ptr); }
+void* operator new[](size_t size) { return operator new(size); }
+void operator delete[](void* ptr) noexcept { operator delete(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { operator delete(ptr); }
+
+void setUp() {}
+void tearDown() {}
+
+// 构建 100 个目录 x 100 个文件的树再销毁, 取 5 次中的最好成绩
+template <typename Policy>
+static void benchPolicy(const char* name) {
+    double best_build = 1e9, best_teardown = 1e9;
+    size_t peak = 0, allocs = 0;
+    for (int round = 0; round < 5; ++round) {
+        heap_current = heap_peak = heap_allocs = 0;
+        auto t0 = std::chrono::steady_clock::now();
+        auto* tree = new Tree<std::string, Policy>("/");
+        for (int d = 0; d < 100; ++d) {
+            auto* dir = tree->root->addChild("dir" + std::to_string(d));
+            for (int f = 0; f < 100; ++f) dir->addChild("f" + std::to_string(f));
+        }
+        auto t1 = std::chrono::steady_clock::now();
+        peak = heap_peak;
+        allocs = heap_allocs;
+        delete tree;
+        auto t2 = std::chrono::steady_clock::now();
+
+        best_build = std::min(best_build, std::chrono::duration<double, std::micro>(t1 - t0).count());
+        best_teardown = std::min(best_teardown, std::chrono::duration<double, std::micro>(t2 - t1).count());
+    }
+    TEST_ASSERT_EQUAL_size_t(0, heap_current);  // 销毁后没有遗留的堆内存
+    std::printf("%-14s build %7.0f us  teardown %7.0f us  peak %8zu B  allocs %6zu\n", name, best_build, best_teardown, peak, allocs);
+}
+
+void bench_tree_policies() {
+    benchPolicy<TreeLinearPolicy>("linear");
+    benchPolicy<TreePoolPolicy>("pool");
+    benchPolicy<TreeIndexPolicy<false, true>>("global");
+    benchPolicy<TreeIndexPolicy<false, true, false, true>>("global+pool");
+    benchPolicy<TreeFullHashPolicy>("fullhash");
+}
+
+// deleteTree 按块一次性回收内存池
+void bench_pool_reset_on_delete_tree() {
+    Tree<std::string, TreePoolPolicy> tree("/");
+    for (int i = 0; i < 1000; ++i) tree.root->addChild("n" + std::to_string(i))->addChild("leaf");
+    TEST_ASSERT_EQUAL_size_t(2001, tree.nodePool().size());
+
+    size_t blocks = tree.nodePool().blockCount();
+    size_t pool_bytes = tree.nodePool().memoryUsage();
+    auto t0 = std::chrono::steady_clock::now();
+    tree.deleteTree();
+    double teardown_us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count();
+    TEST_ASSERT_EQUAL_size_t(0, tree.nodePool().size());
+    TEST_ASSERT_EQUAL_size_t(0, tree.nodePool().blockCount());
+    std::printf("deleteTree: %zu nodes in %.0f us, released %zu blocks (%zu B)\n", static_cast<size_t>(2001), teardown_us, blocks, pool_bytes);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(bench_tree_policies);
+    RUN_TEST(bench_pool_reset_on_delete_tree);
+    return UNITY_END();
+}
@@ -0,0 +1,125 @@
+/**
+ * @file test_main.cpp
+ * @date 17.10.2026
+ * @author RMSHE
+ *
+ * < GasSensorOS >
+ * Copyright(C) 2026 RMSHE. All rights reserved.
+ *
+ * This program is free software : you can redistribute it and /or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.If not, see < https://www.gnu.org/licenses/>.
+ *
+ * Electronic Mail : asdfghjkl851@outlook.com
+ */
+
+// ADCSampler 多缓冲采集引擎(合成采样源)的单元测试: pio test -e native -f test_adc_sampler
+
+#include <unity.h>
+
+#include <adc_sampler.hpp>
+#include <cmath>
+
+void setUp() {}
+void tearDown() {}
+
+static float waveform(size_t channel, double t) { return static_cast<float>(100 * channel + 1000 + 500 * std::sin(2 * M_PI * 5 * t)); }
+
+// 手动 pump/poll: 块按序交付, 各通道样本与信号函数的量化结果一致
+void test_manual_pump_delivers_exact_blocks() {
+    SyntheticADCSource source(waveform);
+    ADCSampler::Config config;
+    config.pins = {1, 2, 3};
+    config.sampleRate = 1000;
+    config.blockFrames = 100;
+
+    std::vector<size_t> indexes;
+    bool exact = true;
+    ADCSampler sampler(source, config, [&](const ADCSampler::Block& block) {
+        indexes.push_back(block.index);
+        for (size_t ch = 0; ch < block.channels; ++ch) {
+            RingSpan<const uint16_t> samples = block.channel(ch);
+            for (size_t f = 0; f < samples.size; ++f) {
+                const double t = static_cast<double>(block.index * config.blockFrames + f) / config.sampleRate;
+                if (samples[f] != std::round(waveform(ch, t) * 4095 / 3300)) exact = false;
+            }
+        }
+    });
+
+    TEST_ASSERT_TRUE(sampler.start(false));
+    size_t blocks = 0;
+    for (int i = 0; i < 100; ++i) {
+        blocks += sampler.pump();
+        sampler.poll();
+    }
+    sampler.stop();
+
+    TEST_ASSERT_TRUE(exact);
+    TEST_ASSERT_TRUE(blocks > 0);
+    TEST_ASSERT_EQUAL_size_t(blocks, indexes.size());
+    for (size_t i = 0; i < indexes.size(); ++i) TEST_ASSERT_EQUAL_size_t(i, indexes[i]);
+    TEST_ASSERT_EQUAL_UINT32(3300, sampler.toMillivolts(0, 4095));
+}
+
+// 消费端跟不上时丢弃刚写满的块, 块序号出现跳跃
+void test_slow_consumer_drops_blocks() {
+    SyntheticADCSource source(waveform);
+    ADCSampler::Config config;
+    config.pins = {1};
+    config.blockFrames = 64;
+    config.buffers = 3;
+
+    std::vector<size_t> indexes;
+    ADCSampler sampler(source, config, [&](const ADCSampler::Block& block) { indexes.push_back(block.index); });
+    TEST_ASSERT_TRUE(sampler.start(false));
+    for (int i = 0; i < 10; ++i) sampler.pump();  // 只有 2 个空闲缓冲区
+    sampler.poll();
+    TEST_ASSERT_EQUAL_size_t(2, indexes.size());
+    TEST_ASSERT_EQUAL_size_t(8, sampler.droppedBlocks());
+
+    for (int i = 0; i < 2; ++i) sampler.pump();
+    sampler.poll();
+    TEST_ASSERT_EQUAL_size_t(11, indexes.back());
+}
+
+// 后台采集线程按实时速率采样, 块序号连续且不丢块
+void test_background_real_time() {
+    SyntheticADCSource source(waveform, true);
+    ADCSampler::Config config;
+    config.pins = {1, 2, 3, 4};
+    config.sampleRate = 5000;
+    config.blockFrames = 250;
+
+    size_t delivered = 0;
+    bool sequential = true;
+    ADCSampler sampler(source, config, [&](const ADCSampler::Block& block) { sequential = sequential && block.index == delivered++; });
+    TEST_ASSERT_TRUE(sampler.start());
+    auto t0 = std::chrono::steady_clock::now();
+    while (std::chrono::steady_clock::now() - t0 < std::chrono::milliseconds(500)) {
+        sampler.poll();
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    sampler.stop();
+    sampler.poll();
+
+    TEST_ASSERT_TRUE(sequential);
+    TEST_ASSERT_EQUAL_size_t(0, sampler.droppedBlocks());
+    TEST_ASSERT_TRUE(sampler.frames() > 2000 && sampler.frames() < 3000);  // 500ms × 5kHz
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_manual_pump_delivers_exact_blocks);
+    RUN_TEST(test_slow_consumer_drops_blocks);
+    RUN_TEST(test_background_real_time);
+    return UNITY_END();
+}
@@ -0,0 +1,138 @@
+/**
+ * @file test_main.cpp
+ * @date 17.10.2026
+ * @author RMSHE
+ *
+ * < GasSensorOS >
+ * Copyright(C) 2026 RMSHE. All rights reserved.
+ *
+ * This program is free software : you can redistribute it and /or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.If not, see < https://www.gnu.org/licenses/>.
+ *
+ * Electronic Mail : asdfghjkl851@outlook.com
+ */
+
+// ColumnTable 二进制往返、损坏文件校验、字典整理与 DataTable 转换的单元测试: pio test -e native -f test_column_table
+
+#include <unity.h>
+
+#include <column_table.hpp>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+void setUp() {}
+void tearDown() {}
+
+static std::string hostPath(const std::string& path) { return PosixFSBackend::root() + path; }
+
+static std::string readHostFile(const std::string& path) {
+    std::ifstream in(hostPath(path), std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
+
+static void writeHostFile(const std::string& path, const std::string& bytes) {
+    std::ofstream out(hostPath(path), std::ios::binary | std::ios::trunc);
+    out.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+}
+
+static ColumnTable sampleTable() {
+    ColumnTable table({"time", "temp", "device"}, {ColumnType::Int32, ColumnType::Float, ColumnType::String});
+    table.appendRow({"1760000000", "23.5", "sensor-a"});
+    table.appendRow({"1760000060", "23.7", "sensor-b"});
+    table.appendRow({"1760000120", "-1.25", "sensor-a"});
+    return table;
+}
+
+void test_binary_round_trip() {
+    ColumnTable table = sampleTable();
+    TEST_ASSERT_TRUE(table.saveBinary("/ct.gct"));
+
+    ColumnTable loaded;
+    TEST_ASSERT_TRUE(loaded.loadBinary("/ct.gct"));
+    TEST_ASSERT_EQUAL_size_t(3, loaded.getRowSize());
+    TEST_ASSERT_EQUAL_size_t(3, loaded.getColSize());
+    for (size_t row = 0; row < 3; ++row)
+        for (size_t col = 0; col < 3; ++col) TEST_ASSERT_EQUAL_STRING(table.getCell(row, col).c_str(), loaded.getCell(row, col).c_str());
+    TEST_ASSERT_EQUAL_size_t(2, loaded.findEqual(2, std::string("sensor-a")).size());
+}
+
+// 文件头中的行数、列数与数据块长度超出文件大小时加载失败, 不按损坏的长度分配内存
+void test_corrupt_header_rejected() {
+    TEST_ASSERT_TRUE(sampleTable().saveBinary("/ct.gct"));
+    const std::string valid = readHostFile("/ct.gct");
+
+    auto patch32 = [&](size_t offset, uint32_t value) {
+        std::string bytes = valid;
+        std::memcpy(&bytes[offset], &value, sizeof(value));
+        writeHostFile("/bad.gct", bytes);
+        ColumnTable loaded;
+        bool success = loaded.loadBinary("/bad.gct");
+        TEST_ASSERT_EQUAL_size_t(0, loaded.getRowSize());
+        return success;
+    };
+
+    TEST_ASSERT_FALSE(patch32(8, 0x40000000u));   // 行数: rows * 4 在 32 位下溢出
+    TEST_ASSERT_FALSE(patch32(8, 0xFFFFFFFFu));
+    TEST_ASSERT_FALSE(patch32(12, 0x0AAAAAABu));  // 列数: cols * 24 在 32 位下溢出
+    TEST_ASSERT_FALSE(patch32(12, 1000));
+    TEST_ASSERT_FALSE(patch32(16 + 4, 0xFFFFFFF0u));       // 第 0 列列名长度
+    TEST_ASSERT_FALSE(patch32(16 + 8, 0xFFFFFFF0u));       // 第 0 列数据块偏移
+    TEST_ASSERT_FALSE(patch32(16 + 48 + 16, 0xFFFFFFFFu));  // 第 2 列字典条目数
+
+    writeHostFile("/bad.gct", valid.substr(0, valid.size() - 3));  // 截断
+    ColumnTable truncated;
+    TEST_ASSERT_FALSE(truncated.loadBinary("/bad.gct"));
+}
+
+// 反复覆写字符串单元格不会让字典无限增长, 整理后编码与查询仍然正确
+void test_set_string_compacts_dictionary() {
+    ColumnTable table = sampleTable();
+    for (int i = 0; i < 10000; ++i) table.setString("value-" + std::to_string(i), i % 3, 2);
+    TEST_ASSERT_TRUE(table.memoryUsage() < 4096);
+    TEST_ASSERT_EQUAL_STRING("value-9999", table.getString(0, 2).c_str());
+    TEST_ASSERT_EQUAL_STRING("value-9998", table.getString(2, 2).c_str());
+    TEST_ASSERT_EQUAL_size_t(1, table.findEqual(2, std::string("value-9997")).size());
+    TEST_ASSERT_EQUAL_size_t(0, table.findEqual(2, std::string("sensor-a")).size());
+
+    table.setString("shared", 0, 2);
+    table.setString("shared", 1, 2);
+    table.compact();
+    TEST_ASSERT_EQUAL_size_t(2, table.findEqual(2, std::string("shared")).size());
+    TEST_ASSERT_EQUAL_STRING("value-9998", table.getString(2, 2).c_str());
+}
+
+// 遇到无法解析的行时停止, 返回此前已转换的行
+void test_from_data_table_stops_at_bad_row() {
+    DataTable source(5, 2, "");
+    source.replaceRow({"ppm", "device"}, 0);
+    source.replaceRow({"412", "a"}, 1);
+    source.replaceRow({"498", "b"}, 2);
+    source.replaceRow({"oops", "c"}, 3);
+    source.replaceRow({"530", "d"}, 4);
+
+    ColumnTable table = ColumnTable::fromDataTable(source, {ColumnType::Int32, ColumnType::String});
+    TEST_ASSERT_EQUAL_size_t(2, table.getRowSize());
+    TEST_ASSERT_EQUAL_INT32(498, table.getInt(1, 0));
+    TEST_ASSERT_EQUAL_STRING("ppm", table.getColName(0).c_str());
+}
+
+int main() {
+    PosixFSBackend::setRoot(".pio/gsos_test_fs");
+    UNITY_BEGIN();
+    RUN_TEST(test_binary_round_trip);
+    RUN_TEST(test_corrupt_header_rejected);
+    RUN_TEST(test_set_string_compacts_dictionary);
+    RUN_TEST(test_from_data_table_stops_at_bad_row);
+    return UNITY_END();
+}
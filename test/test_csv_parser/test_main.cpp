@@ -0,0 +1,104 @@
+/**
+ * @file test_main.cpp
+ * @date 17.10.2026
+ * @author RMSHE
+ *
+ * < GasSensorOS >
+ * Copyright(C) 2026 RMSHE. All rights reserved.
+ *
+ * This program is free software : you can redistribute it and /or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.If not, see < https://www.gnu.org/licenses/>.
+ *
+ * Electronic Mail : asdfghjkl851@outlook.com
+ */
+
+// CSV 流式解析器与 DataTable 读写往返的单元测试: pio test -e native -f test_csv_parser
+
+#include <unity.h>
+
+#include <csv_parser.hpp>
+#include <data_table.hpp>
+#include <random>
+
+using Rows = std::vector<std::vector<std::string>>;
+
+// 以固定大小的块喂入解析器
+static Rows parseChunks(const std::string& text, size_t chunk) {
+    Rows rows;
+    CSVParser parser([&](CSVParser::Row& row) { rows.push_back(std::move(row)); });
+    for (size_t i = 0; i < text.size(); i += chunk) parser.feed(text.data() + i, std::min(chunk, text.size() - i));
+    parser.finish();
+    return rows;
+}
+
+void setUp() {}
+void tearDown() {}
+
+// RFC 4180 引号、转义、CRLF 与末尾空单元格
+void test_rfc4180_quoting() {
+    Rows rows = parseChunks("a,\"b,c\",\"d\"\"e\"\r\n\"multi\nline\",x,\n,,\nlast", 1);
+    TEST_ASSERT_EQUAL_size_t(4, rows.size());
+    TEST_ASSERT_TRUE((rows[0] == std::vector<std::string>{"a", "b,c", "d\"e"}));
+    TEST_ASSERT_TRUE((rows[1] == std::vector<std::string>{"multi\nline", "x", ""}));
+    TEST_ASSERT_TRUE((rows[2] == std::vector<std::string>{"", "", ""}));
+    TEST_ASSERT_TRUE((rows[3] == std::vector<std::string>{"last"}));
+}
+
+// 随机表格经 appendField 写出后以随机块大小解析, 结果与原表一致
+void test_random_round_trip() {
+    std::mt19937 gen(7);
+    const char alphabet[] = "ab,\"\n\r x";
+    for (int t = 0; t < 2000; ++t) {
+        Rows rows(1 + gen() % 5, std::vector<std::string>(1 + gen() % 4));
+        for (auto& row : rows) {
+            for (auto& cell : row) {
+                int length = gen() % 5;
+                for (int i = 0; i < length; ++i) cell.push_back(alphabet[gen() % 9]);
+            }
+        }
+
+        std::string text;
+        for (auto& row : rows) {
+            for (size_t i = 0; i < row.size(); ++i) {
+                CSVParser::appendField(text, row[i]);
+                if (i + 1 < row.size()) text += ',';
+            }
+            text += (gen() % 2) ? "\n" : "\r\n";
+        }
+        TEST_ASSERT_TRUE(parseChunks(text, 1 + gen() % 7) == rows);
+    }
+}
+
+// saveTable 为含逗号、引号、换行的单元格加引号, loadTable 读回后不变
+void test_data_table_save_load() {
+    DataTable table(3, 3, "");
+    table.replaceRow({"x,y", "say \"hi\"", "two\nlines"}, 0);
+    table.replaceRow({"a", "", ""}, 1);
+    table.saveTable("/rt.csv");
+
+    DataTable loaded(1, 1, "");
+    loaded.loadTable("/rt.csv");
+    TEST_ASSERT_EQUAL_size_t(3, loaded.getRowSize());
+    TEST_ASSERT_EQUAL_size_t(3, loaded.getColSize());
+    for (size_t i = 0; i < 3; ++i)
+        for (size_t j = 0; j < 3; ++j) TEST_ASSERT_EQUAL_STRING(table.getCell(i, j).c_str(), loaded.getCell(i, j).c_str());
+}
+
+int main() {
+    PosixFSBackend::setRoot(".pio/gsos_test_fs");
+    UNITY_BEGIN();
+    RUN_TEST(test_rfc4180_quoting);
+    RUN_TEST(test_random_round_trip);
+    RUN_TEST(test_data_table_save_load);
+    return UNITY_END();
+}
@@ -0,0 +1,385 @@
+/**
+ * @file test_main.cpp
+ * @date 17.10.2026
+ * @author RMSHE
+ *
+ * < GasSensorOS >
+ * Copyright(C) 2026 RMSHE. All rights reserved.
+ *
+ * This program is free software : you can redistribute it and /or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.If not, see < https://www.gnu.org/licenses/>.
+ *
+ * Electronic Mail : asdfghjkl851@outlook.com
+ */
+
+// DataTable 二级索引、增量保存(syncTable)与多线程批量操作的单元测试: pio test -e native -f test_data_table
+
+#include <unity.h>
+
+#include <algorithm>
+#include <cmath>
+#include <data_table.hpp>
+#include <random>
+#include <string>
+#include <vector>
+
+static FileExplorer* fe = nullptr;
+
+void setUp() { fe->createDir("/t"); }
+void tearDown() { fe->deletePath("/t"); }
+
+static std::mt19937 rng(11);
+
+// 单元格取值范围很小, 使每列都有大量重复值
+static std::string randomValue() {
+    static const char* values[] = {"", "a", "b", "ab", "abc", "b1", "10", "2", "x"};
+    return values[rng() % (sizeof(values) / sizeof(values[0]))];
+}
+
+static DataTable::Row randomRow(size_t cols) {
+    DataTable::Row row(cols);
+    for (auto& cell : row) cell = randomValue();
+    return row;
+}
+
+// 逐行扫描一列得到的参考结果
+static std::vector<size_t> scanRows(DataTable& table, size_t col, const std::function<bool(const std::string&)>& match) {
+    std::vector<size_t> rows;
+    for (size_t row = 0; row < table.getRowSize(); ++row)
+        if (match(table.getCell(row, col))) rows.push_back(row);
+    return rows;
+}
+
+// 每一列(无论是否建有索引)的 findRows/findRange/findPrefix 都与逐行扫描一致
+static bool indexesMatchScan(DataTable& table) {
+    static const char* probes[] = {"", "a", "b", "ab", "abc", "b1", "10", "2", "x", "missing"};
+    bool match = true;
+    for (size_t col = 0; col < table.getColSize(); ++col) {
+        for (const char* probe : probes) {
+            const std::string value = probe;
+            match = match && table.findRows(value, col) == scanRows(table, col, [&](const std::string& cell) { return cell == value; });
+            match = match && table.findPrefix(value, col) == scanRows(table, col, [&](const std::string& cell) { return cell.compare(0, value.size(), value) == 0; });
+        }
+        match = match && table.findRange("a", "b", col) == scanRows(table, col, [](const std::string& cell) { return cell >= "a" && cell <= "b"; });
+    }
+    return match;
+}
+
+// 列被删除或裁剪时索引随之消失: 保持至少两列建有索引, 新建的索引在哈希与有序之间轮换
+static void ensureIndexes(DataTable& table) {
+    static bool sorted = false;
+    size_t indexed = 0;
+    for (size_t col = 0; col < table.getColSize(); ++col) indexed += table.hasIndex(col);
+    for (size_t col = 0; col < table.getColSize() && indexed < 2; ++col) {
+        if (table.hasIndex(col)) continue;
+        table.createIndex(col, sorted ? DataTable::IndexType::Sorted : DataTable::IndexType::Hash);
+        sorted = !sorted;
+        ++indexed;
+    }
+}
+
+// 对同时建有哈希与有序索引的表格随机执行各种修改, 每一步后索引查找都与逐列扫描一致
+void test_indexes_follow_table_edits() {
+    DataTable table(0, 3);
+    for (int i = 0; i < 40; ++i) table.insertRow(randomRow(3));
+    table.createIndex(0, DataTable::IndexType::Hash);
+    table.createIndex(1, DataTable::IndexType::Sorted);
+    TEST_ASSERT_TRUE(indexesMatchScan(table));
+
+    for (int step = 0; step < 1200; ++step) {
+        const size_t rows = table.getRowSize(), cols = table.getColSize();
+        const size_t row = rows ? rng() % rows : 0, col = rng() % cols;
+        switch (step % 11) {
+            case 0:
+                table.insertRow(randomRow(cols), rows ? rng() % rows : 0);  // 中间插入
+                break;
+            case 1:
+                table.insertRow(randomRow(cols));  // 末尾追加
+                break;
+            case 2:
+                table.deleteRow(rng() % 2 ? row : rows - 1);  // 删除中间行或末行
+                break;
+            case 3:
+                table.replaceCell(randomValue(), row, col);
+                break;
+            case 4:
+                table.replaceRow(randomRow(cols), row);
+                break;
+            case 5:
+                table.swapRows(row, rows ? rng() % rows : 0);
+                break;
+            case 6:
+                table.swapCols(col, rng() % cols);
+                break;
+            case 7:
+                if (cols < 5) table.insertCol(randomRow(rows), rng() % (cols + 1));
+                break;
+            case 8:
+                if (cols > 2) table.deleteCol(col);
+                break;
+            case 9:
+                table.resize(20 + rng() % 40, 2 + rng() % 4);
+                break;
+            default:
+                table.sortRows(col, rng() % 2, rng() % 2);
+                break;
+        }
+        ensureIndexes(table);
+        TEST_ASSERT_TRUE(indexesMatchScan(table));
+    }
+}
+
+// 表格的完整 CSV 文本(测试数据不含需要加引号的字符)
+static std::string csvOf(DataTable& table) {
+    std::string text;
+    for (size_t row = 0; row < table.getRowSize(); ++row) {
+        for (size_t col = 0; col < table.getColSize(); ++col) text += (col ? "," : "") + table.getCell(row, col);
+        text += '\n';
+    }
+    return text;
+}
+
+// 篡改文件中已保存的第一行: 之后若文件被整表重写, 篡改会消失; 若只追加了新行, 篡改会保留
+static std::string tamperFirstRow(const std::string& path) {
+    std::string text = fe->readFileAsString(path);
+    text[0] = 'X';
+    fe->writeFileAsString(path, text, "w");
+    return text;
+}
+
+// 只在末尾追加了新行时, syncTable 只把新行追加到 saveTable/loadTable 得到的文件末尾
+void test_sync_appends_new_rows_only() {
+    const std::string path = "/t/append.csv";
+    DataTable table(0, 2);
+    table.insertRow({"r0", "0"});
+    table.insertRow({"r1", "1"});
+    table.saveTable(path);
+    TEST_ASSERT_EQUAL_STRING(csvOf(table).c_str(), fe->readFileAsString(path).c_str());
+    std::string expected = tamperFirstRow(path);
+
+    table.insertRow({"r2", "2"});
+    table.insertRow({"r3", "3"});
+    TEST_ASSERT_TRUE(table.syncTable(path));
+    expected += "r2,2\nr3,3\n";
+    TEST_ASSERT_EQUAL_STRING(expected.c_str(), fe->readFileAsString(path).c_str());
+    TEST_ASSERT_FALSE(fe->exists(path + ".tmp"));
+
+    // 没有修改时不写文件; 修改尚未保存的新行仍只需追加
+    TEST_ASSERT_TRUE(table.syncTable(path));
+    table.insertRow({"r4", "4"});
+    table.replaceCell("44", 4, 1);
+    TEST_ASSERT_TRUE(table.syncTable(path));
+    expected += "r4,44\n";
+    TEST_ASSERT_EQUAL_STRING(expected.c_str(), fe->readFileAsString(path).c_str());
+
+    // loadTable 之后同样可以增量追加
+    DataTable loaded(0, 0);
+    loaded.loadTable(path);
+    TEST_ASSERT_EQUAL_size_t(5, loaded.getRowSize());
+    loaded.insertRow({"r5", "5"});
+    TEST_ASSERT_TRUE(loaded.syncTable(path));
+    expected += "r5,5\n";
+    TEST_ASSERT_EQUAL_STRING(expected.c_str(), fe->readFileAsString(path).c_str());
+}
+
+// 已保存的行被修改或删除时, syncTable 经 .tmp 整表重写并替换原文件
+void test_sync_rewrites_after_saved_row_changes() {
+    const std::string path = "/t/rewrite.csv";
+    const std::vector<std::function<void(DataTable&)>> edits = {
+        [](DataTable& table) { table.replaceCell("edited", 1, 0); },
+        [](DataTable& table) { table.replaceRow({"row", "replaced"}, 0); },
+        [](DataTable& table) { table.deleteRow(2); },  // 删除已保存的末行
+        [](DataTable& table) { table.deleteRow(0); },
+        [](DataTable& table) { table.swapRows(0, 2); },
+        [](DataTable& table) { table.insertRow({"mid", "x"}, 1); },
+        [](DataTable& table) { table.sortRows(0, false); },
+    };
+    for (const auto& edit : edits) {
+        DataTable table(0, 2);
+        for (int i = 0; i < 3; ++i) table.insertRow({"r" + std::to_string(i), std::to_string(i)});
+        table.saveTable(path);
+        tamperFirstRow(path);
+
+        edit(table);
+        table.insertRow({"new", "n"});
+        TEST_ASSERT_TRUE(table.syncTable(path));
+        TEST_ASSERT_EQUAL_STRING(csvOf(table).c_str(), fe->readFileAsString(path).c_str());
+        TEST_ASSERT_FALSE(fe->exists(path + ".tmp"));
+
+        // 重写之后重新回到增量追加
+        std::string expected = tamperFirstRow(path);
+        table.insertRow({"after", "a"});
+        TEST_ASSERT_TRUE(table.syncTable(path));
+        TEST_ASSERT_EQUAL_STRING((expected + "after,a\n").c_str(), fe->readFileAsString(path).c_str());
+        fe->deletePath(path);
+    }
+}
+
+// 列结构变化影响所有已保存的行, syncTable 整表重写
+void test_sync_rewrites_after_column_changes() {
+    const std::string path = "/t/columns.csv";
+    const std::vector<std::function<void(DataTable&)>> edits = {
+        [](DataTable& table) { table.insertCol({"c0", "c1"}); },
+        [](DataTable& table) { table.insertCol({"c0", "c1"}, 0); },
+        [](DataTable& table) { table.deleteCol(1); },
+        [](DataTable& table) { table.swapCols(0, 1); },
+        [](DataTable& table) { table.resize(2, 3); },
+        [](DataTable& table) { table.replaceCol({"p", "q"}, 1); },
+    };
+    for (const auto& edit : edits) {
+        DataTable table(0, 2);
+        table.insertRow({"a", "1"});
+        table.insertRow({"b", "2"});
+        table.saveTable(path);
+        tamperFirstRow(path);
+
+        edit(table);
+        TEST_ASSERT_TRUE(table.syncTable(path));
+        TEST_ASSERT_EQUAL_STRING(csvOf(table).c_str(), fe->readFileAsString(path).c_str());
+        TEST_ASSERT_FALSE(fe->exists(path + ".tmp"));
+        fe->deletePath(path);
+    }
+}
+
+// 文件末尾没有换行符时不能直接追加(新行会接在最后一行后面), syncTable 整表重写
+void test_sync_rewrites_file_without_trailing_newline() {
+    const std::string path = "/t/no_newline.csv";
+    fe->createFile(path);
+    fe->writeFileAsString(path, "a,1\nb,2", "w");
+
+    DataTable table(0, 0);
+    table.loadTable(path);
+    TEST_ASSERT_EQUAL_size_t(2, table.getRowSize());
+    table.insertRow({"c", "3"});
+    TEST_ASSERT_TRUE(table.syncTable(path));
+    TEST_ASSERT_EQUAL_STRING("a,1\nb,2\nc,3\n", fe->readFileAsString(path).c_str());
+
+    // 重写后文件以换行结尾, 之后可以增量追加
+    table.insertRow({"d", "4"});
+    TEST_ASSERT_TRUE(table.syncTable(path));
+    TEST_ASSERT_EQUAL_STRING("a,1\nb,2\nc,3\nd,4\n", fe->readFileAsString(path).c_str());
+
+    // 同步到另一个文件时同样整表写入
+    TEST_ASSERT_TRUE(table.syncTable("/t/other.csv"));
+    TEST_ASSERT_EQUAL_STRING("a,1\nb,2\nc,3\nd,4\n", fe->readFileAsString("/t/other.csv").c_str());
+}
+
+// 与 DataTable 相同的完整解析规则: 整个单元格都是数值才有效, 否则为 NaN
+static double parseCell(const std::string& cell) {
+    char* end = nullptr;
+    double value = std::strtod(cell.c_str(), &end);
+    return !cell.empty() && *end == '\0' ? value : std::nan("");
+}
+
+static bool sameValues(const std::vector<double>& a, const std::vector<double>& b) {
+    if (a.size() != b.size()) return false;
+    for (size_t i = 0; i < a.size(); ++i)
+        if (!(a[i] == b[i] || (std::isnan(a[i]) && std::isnan(b[i])))) return false;
+    return true;
+}
+
+static bool sameGroups(const std::vector<DataTable::GroupStats>& a, const std::vector<DataTable::GroupStats>& b) {
+    if (a.size() != b.size()) return false;
+    for (size_t i = 0; i < a.size(); ++i) {
+        if (a[i].key != b[i].key || a[i].rows != b[i].rows || a[i].count != b[i].count) return false;
+        if (a[i].sum != b[i].sum || a[i].min != b[i].min || a[i].max != b[i].max || a[i].mean != b[i].mean) return false;
+    }
+    return true;
+}
+
+// setBulkThreads(4) 在足以分给 4 个线程的行数上与单线程结果逐项相同, 并与逐单元格的朴素实现一致.
+// 数值都是 0.5 的整数倍, 分段累加的顺序不影响 sum, 可以精确比较; 约 3% 的单元格为非数值/空/"nan".
+void test_bulk_threads_match_single_thread() {
+    const size_t rows = 70000;  // 70000 / kMinItemsPerThread(16384) >= 4
+    DataTable table(0, 3);
+    std::mt19937 data_rng(15);
+    for (size_t i = 0; i < rows; ++i) {
+        std::string value = std::to_string(static_cast<int>(data_rng() % 20001) - 10000);
+        if (data_rng() % 2) value += ".5";
+        switch (data_rng() % 100) {
+            case 0:
+                value = "x";
+                break;
+            case 1:
+                value = "";
+                break;
+            case 2:
+                value = "nan";
+                break;
+            default:
+                break;
+        }
+        table.insertRow({"g" + std::to_string(data_rng() % 37), value, std::to_string(i)});
+    }
+
+    table.setBulkThreads(1);
+    const std::vector<double> numeric = table.getNumericCol(1);
+    const std::vector<size_t> filtered = table.filterRange(1, -2500, 2500.5);
+    const std::vector<DataTable::GroupStats> groups = table.groupBy(0, 1);
+    const std::vector<size_t> largest = table.topK(1, 500, true), smallest = table.topK(1, 500, false);
+
+    table.setBulkThreads(4);
+    TEST_ASSERT_TRUE(sameValues(numeric, table.getNumericCol(1)));
+    TEST_ASSERT_TRUE(filtered == table.filterRange(1, -2500, 2500.5));
+    TEST_ASSERT_TRUE(sameGroups(groups, table.groupBy(0, 1)));
+    TEST_ASSERT_TRUE(largest == table.topK(1, 500, true));
+    TEST_ASSERT_TRUE(smallest == table.topK(1, 500, false));
+
+    // 朴素实现: 逐单元格解析
+    std::vector<double> naive(rows);
+    size_t nan_count = 0;
+    for (size_t row = 0; row < rows; ++row) nan_count += std::isnan(naive[row] = parseCell(table.getCell(row, 1)));
+    TEST_ASSERT_TRUE(nan_count > rows / 50);
+    TEST_ASSERT_TRUE(sameValues(naive, numeric));
+    TEST_ASSERT_TRUE(filtered == scanRows(table, 1, [](const std::string& cell) { return parseCell(cell) >= -2500 && parseCell(cell) <= 2500.5; }));
+    size_t grouped_rows = 0, grouped_count = 0;
+    for (const auto& group : groups) grouped_rows += group.rows, grouped_count += group.count;
+    TEST_ASSERT_EQUAL_size_t(rows, grouped_rows);
+    TEST_ASSERT_EQUAL_size_t(rows - nan_count, grouped_count);
+
+    // 数值降序/升序排序(非数值单元格总是排在最后, 相等时保持原顺序)与单线程结果及朴素稳定排序一致
+    for (int ascending = 0; ascending < 2; ++ascending) {
+        std::vector<size_t> order(rows);
+        for (size_t row = 0; row < rows; ++row) order[row] = row;
+        std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+            if (std::isnan(naive[a]) || std::isnan(naive[b])) return !std::isnan(naive[a]) && std::isnan(naive[b]);
+            return ascending ? naive[a] < naive[b] : naive[a] > naive[b];
+        });
+        std::vector<std::string> expected(rows);
+        for (size_t i = 0; i < rows; ++i) expected[i] = std::to_string(order[i]);
+
+        DataTable single = table, parallel = table;
+        single.setBulkThreads(1);
+        parallel.setBulkThreads(4);
+        single.sortRows(1, ascending, true);
+        parallel.sortRows(1, ascending, true);
+        TEST_ASSERT_TRUE(single.getCol(2) == expected);
+        TEST_ASSERT_TRUE(parallel.getCol(2) == expected);
+        TEST_ASSERT_TRUE(parallel.getCol(1) == single.getCol(1));
+    }
+}
+
+int main() {
+    PosixFSBackend::setRoot(".pio/gsos_test_fs");
+    FileExplorer explorer;
+    fe = &explorer;
+
+    UNITY_BEGIN();
+    RUN_TEST(test_indexes_follow_table_edits);
+    RUN_TEST(test_sync_appends_new_rows_only);
+    RUN_TEST(test_sync_rewrites_after_saved_row_changes);
+    RUN_TEST(test_sync_rewrites_after_column_changes);
+    RUN_TEST(test_sync_rewrites_file_without_trailing_newline);
+    RUN_TEST(test_bulk_threads_match_single_thread);
+    return UNITY_END();
+}
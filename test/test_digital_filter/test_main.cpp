@@ -0,0 +1,155 @@
+/**
+ * @file test_main.cpp
+ * @date 17.10.2026
+ * @author RMSHE
+ *
+ * < GasSensorOS >
+ * Copyright(C) 2026 RMSHE. All rights reserved.
+ *
+ * This program is free software : you can redistribute it and /or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.If not, see < https://www.gnu.org/licenses/>.
+ *
+ * Electronic Mail : asdfghjkl851@outlook.com
+ */
+
+// 定长滤波器与直接实现的参考结果对照, 以及逐样本/块/RingSpan 三种接口的一致性: pio test -e native -f test_digital_filter
+
+#include <unity.h>
+
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <digital_filter.hpp>
+#include <random>
+#include <vector>
+
+void setUp() {}
+void tearDown() {}
+
+static std::mt19937 rng(1);
+static std::uniform_real_distribution<double> uniform(-1.0, 1.0);
+
+// FIR 与直接卷积一致(前 TAPS-1 个样本按零初始状态计算)
+void test_fir_matches_direct_convolution() {
+    const std::array<double, 7> h = {0.1, -0.2, 0.3, 0.5, 0.3, -0.2, 0.1};
+    FIRFilter<double, 7> fir(h);
+    std::vector<double> xs;
+    for (int i = 0; i < 500; ++i) {
+        xs.push_back(uniform(rng));
+        double expected = 0;
+        for (size_t t = 0; t < h.size() && t < xs.size(); ++t) expected += h[t] * xs[xs.size() - 1 - t];
+        TEST_ASSERT_DOUBLE_WITHIN(1e-12, expected, fir.process(xs.back()));
+    }
+}
+
+// 双二阶级联与直接 I 型差分方程一致; 低通直流增益为 1, 陷波滤除目标频率
+void test_biquad_cascade() {
+    const auto lowPass = BiquadCoefficients<double>::lowPass(1000, 50);
+    const auto notch = BiquadCoefficients<double>::notch(1000, 100, 5);
+    BiquadCascade<double, 2> cascade({lowPass, notch});
+    double state[2][4] = {};  // x[n-1], x[n-2], y[n-1], y[n-2]
+    for (int i = 0; i < 2000; ++i) {
+        const double x = uniform(rng);
+        double v = x;
+        for (int k = 0; k < 2; ++k) {
+            const auto& c = k ? notch : lowPass;
+            const double y = c.b0 * v + c.b1 * state[k][0] + c.b2 * state[k][1] - c.a1 * state[k][2] - c.a2 * state[k][3];
+            state[k][1] = state[k][0];
+            state[k][0] = v;
+            state[k][3] = state[k][2];
+            state[k][2] = y;
+            v = y;
+        }
+        TEST_ASSERT_DOUBLE_WITHIN(1e-9, v, cascade.process(x));
+    }
+
+    BiquadCascade<double, 1> dc({lowPass});
+    double y = 0;
+    for (int i = 0; i < 5000; ++i) y = dc.process(1.0);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-9, 1.0, y);
+
+    BiquadCascade<double, 1> rejection({notch});
+    double peak = 0;
+    for (int i = 0; i < 20000; ++i) {
+        const double out = rejection.process(std::sin(2 * M_PI * 100 * i / 1000.0));
+        if (i > 15000) peak = std::max(peak, std::fabs(out));
+    }
+    TEST_ASSERT_TRUE(peak < 1e-3);
+}
+
+// 滑动平均/中值与窗口重新计算的结果一致(窗口未填满时按已有样本计算), 整数平均向零截断
+void test_moving_average_and_median() {
+    MovingAverage<float, 5> average;
+    MovingMedian<float, 5> median;
+    MovingAverage<int, 4> integerAverage;
+    std::deque<float> window;
+    std::deque<int> integerWindow;
+    for (int i = 0; i < 3000; ++i) {
+        float x = static_cast<float>(uniform(rng));
+        if (i % 50 == 0) x = 100;  // 脉冲干扰
+        window.push_back(x);
+        if (window.size() > 5) window.pop_front();
+        double sum = 0;
+        for (float v : window) sum += v;
+        TEST_ASSERT_FLOAT_WITHIN(1e-4f, static_cast<float>(sum / window.size()), average.process(x));
+
+        std::vector<float> sorted(window.begin(), window.end());
+        std::sort(sorted.begin(), sorted.end());
+        TEST_ASSERT_EQUAL_FLOAT(sorted[(sorted.size() - 1) / 2], median.process(x));
+
+        const int xi = static_cast<int>(x * 1000);
+        integerWindow.push_back(xi);
+        if (integerWindow.size() > 4) integerWindow.pop_front();
+        long integerSum = 0;
+        for (int v : integerWindow) integerSum += v;
+        TEST_ASSERT_EQUAL_INT(static_cast<int>(integerSum / static_cast<long>(integerWindow.size())), integerAverage.process(xi));
+    }
+
+    ExponentialSmoothing<float> smoothing(0.5f);
+    TEST_ASSERT_EQUAL_FLOAT(4.0f, smoothing.process(4));  // 第一个样本直接作为初值
+    TEST_ASSERT_EQUAL_FLOAT(2.0f, smoothing.process(0));
+}
+
+// 滤波链对 RingBuffer::segments() 两段视图、原地块处理与逐样本处理的结果一致
+void test_chain_span_block_and_sample_agree() {
+    using Chain = FilterChain<MovingMedian<float, 3>, BiquadCascade<float, 1>, ExponentialSmoothing<float>>;
+    const auto coefficients = BiquadCoefficients<float>::lowPass(100, 10);
+    const Chain prototype(MovingMedian<float, 3>(), BiquadCascade<float, 1>({coefficients}), ExponentialSmoothing<float>(0.3f));
+
+    RingBuffer<float, 64> buffer;
+    for (int i = 0; i < 100; ++i) buffer.pushBack(static_cast<float>(uniform(rng)));  // 回绕, 分成两段
+
+    Chain perSample = prototype, spans = prototype, block = prototype;
+    std::vector<float> expected(64), fromSpans(64), inPlace(buffer.begin(), buffer.end());
+    for (size_t i = 0; i < 64; ++i) expected[i] = perSample.process(buffer.at(i));
+
+    auto segments = buffer.segments();
+    size_t n = spans.process(segments.first, RingSpan<float>{fromSpans.data(), fromSpans.size()});
+    n += spans.process(segments.second, RingSpan<float>{fromSpans.data() + n, fromSpans.size() - n});
+    TEST_ASSERT_EQUAL_size_t(64, n);
+
+    block.process(inPlace.data(), inPlace.data(), inPlace.size());
+    for (size_t i = 0; i < 64; ++i) {
+        TEST_ASSERT_FLOAT_WITHIN(1e-6f, expected[i], fromSpans[i]);
+        TEST_ASSERT_FLOAT_WITHIN(1e-6f, expected[i], inPlace[i]);
+    }
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_fir_matches_direct_convolution);
+    RUN_TEST(test_biquad_cascade);
+    RUN_TEST(test_moving_average_and_median);
+    RUN_TEST(test_chain_span_block_and_sample_agree);
+    return UNITY_END();
+}
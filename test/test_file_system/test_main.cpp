@@ -0,0 +1,202 @@
+/**
+ * @file test_main.cpp
+ * @date 17.10.2026
+ * @author RMSHE
+ *
+ * < GasSensorOS >
+ * Copyright(C) 2026 RMSHE. All rights reserved.
+ *
+ * This program is free software : you can redistribute it and /or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.If not, see < https://www.gnu.org/licenses/>.
+ *
+ * Electronic Mail : asdfghjkl851@outlook.com
+ */
+
+// 文件系统栈在 POSIX 后端上的单元测试: pio test -e native -f test_file_system
+
+#include <unity.h>
+
+#include <algorithm>
+#include <file_explorer.h>
+
+static FileExplorer* fe = nullptr;
+
+// findPath/searchPath 返回的路径不带开头的 "/"
+static bool contains(const std::vector<std::string>& paths, const std::string& path) { return std::find(paths.begin(), paths.end(), path) != paths.end(); }
+
+void setUp() { fe->createDir("/t"); }
+void tearDown() { fe->deletePath("/t"); }
+
+// FSInterface 基本读写与路径操作
+void test_fs_interface_primitives() {
+    FSInterface fs;
+    TEST_ASSERT_TRUE(fs.mkdir("/t/d"));
+    TEST_ASSERT_TRUE(fs.open("/t/d/a.txt", "w"));
+    TEST_ASSERT_EQUAL_size_t(5, fs.write("hello", 5));
+    fs.close();
+    TEST_ASSERT_TRUE(fs.exists("/t/d/a.txt"));
+    TEST_ASSERT_TRUE(fs.isDirectory("/t/d"));
+
+    TEST_ASSERT_TRUE(fs.rename("/t/d/a.txt", "/t/d/b.txt"));
+    TEST_ASSERT_FALSE(fs.exists("/t/d/a.txt"));
+    TEST_ASSERT_TRUE(fs.exists("/t/d/b.txt"));
+
+    TEST_ASSERT_TRUE(fs.deletePath("/t/d"));
+    TEST_ASSERT_FALSE(fs.exists("/t/d"));
+}
+
+// FileExplorer 读写、复制、移动、重命名与删除
+void test_explorer_copy_move_delete() {
+    TEST_ASSERT_TRUE(fe->createDir("/t/a/b"));
+    TEST_ASSERT_TRUE(fe->createFile("/t/a/b/x.txt"));
+    TEST_ASSERT_TRUE(fe->writeFileAsString("/t/a/b/x.txt", "hello\n", "w"));
+
+    fe->copyPath("/t/a/b", "/t/c");
+    TEST_ASSERT_EQUAL_STRING("hello\n", fe->readFileAsString("/t/c/x.txt").c_str());
+
+    FileExplorer::MoveStats stats = fe->movePath("/t/c", "/t/e");
+    TEST_ASSERT_TRUE(stats.success);
+    TEST_ASSERT_TRUE(stats.native);  // 同一文件系统内原地重命名, 不复制数据
+    TEST_ASSERT_FALSE(fe->exists("/t/c"));
+
+    TEST_ASSERT_TRUE(fe->renamePath("/t/e/x.txt", "y.txt").success);
+    TEST_ASSERT_EQUAL_STRING("hello\n", fe->readFileAsString("/t/e/y.txt").c_str());
+
+    fe->deletePath("/t/e");
+    TEST_ASSERT_FALSE(fe->exists("/t/e/y.txt"));
+    TEST_ASSERT_TRUE(fe->exists("/t/a/b/x.txt"));
+}
+
+// 目录不能移动到自身之内
+void test_explorer_move_into_self_is_rejected() {
+    fe->createDir("/t/arch/x");
+    TEST_ASSERT_FALSE(fe->movePath("/t/arch", "/t/arch/x").success);
+    TEST_ASSERT_TRUE(fe->exists("/t/arch/x"));
+}
+
+// 流式分块读写
+void test_explorer_chunked_io() {
+    fe->createFile("/t/big.bin");
+    size_t produced = 0;
+    const size_t total = 10000;
+    TEST_ASSERT_TRUE(fe->writeFileChunks(
+        "/t/big.bin",
+        [&](uint8_t* buffer, size_t capacity) {
+            size_t n = std::min(capacity, total - produced);
+            for (size_t i = 0; i < n; ++i) buffer[i] = static_cast<uint8_t>((produced + i) & 0xFF);
+            produced += n;
+            return n;
+        },
+        "w"));
+
+    size_t consumed = 0;
+    bool ordered = true;
+    TEST_ASSERT_TRUE(fe->readFileChunks("/t/big.bin", [&](const uint8_t* data, size_t size) {
+        for (size_t i = 0; i < size; ++i) ordered = ordered && data[i] == static_cast<uint8_t>((consumed + i) & 0xFF);
+        consumed += size;
+        return true;
+    }));
+    TEST_ASSERT_EQUAL_size_t(total, consumed);
+    TEST_ASSERT_TRUE(ordered);
+}
+
+// 目录索引能看到绕过 FileExplorer 的修改, 且查找结果按先序稳定
+void test_index_tracks_direct_changes() {
+    fe->createDir("/t/p/q");
+    fe->createFile("/t/p/x.txt");
+    fe->createFile("/t/p/q/x.txt");
+    TEST_ASSERT_EQUAL_size_t(2, fe->findPath("x.txt", "/t").size());
+
+    FSInterface fs;
+    TEST_ASSERT_TRUE(fs.open("/t/p/direct.txt", "w"));
+    fs.close();
+    TEST_ASSERT_TRUE(contains(fe->findPath("direct.txt", "/t"), "t/p/direct.txt"));
+
+    fs.rename("/t/p/direct.txt", "/t/p/moved.txt");
+    TEST_ASSERT_TRUE(fe->findPath("direct.txt", "/t").empty());
+    TEST_ASSERT_TRUE(contains(fe->findPath("moved.txt", "/t"), "t/p/moved.txt"));
+
+    fs.deletePath("/t/p/q");
+    std::vector<std::string> remaining = fe->findPath("x.txt", "/t");
+    TEST_ASSERT_EQUAL_size_t(1, remaining.size());
+    TEST_ASSERT_TRUE(contains(remaining, "t/p/x.txt"));
+
+    fe->rebuildIndex();
+    TEST_ASSERT_TRUE(fe->findPath("x.txt", "/t") == fe->findPath("x.txt", "/t"));
+    TEST_ASSERT_TRUE(contains(fe->searchPath("moved.txt", "/t", 0.5f), "t/p/moved.txt"));
+}
+
+// 未启用持久化(路径为空)的索引同样随变更增量更新内存
+void test_index_without_persistence_tracks_changes() {
+    DirectoryIndex index("");
+    fe->createDir("/t/n");
+    index.ensureLoaded();
+    TEST_ASSERT_TRUE(index.isDirectory("/t/n"));
+
+    FSInterface fs;
+    TEST_ASSERT_TRUE(fs.open("/t/n/a.txt", "w"));
+    fs.close();
+    index.apply(FSInterface::Change::CreateFile, "/t/n/a.txt", "");
+    TEST_ASSERT_TRUE(index.exists("/t/n/a.txt"));
+    TEST_ASSERT_FALSE(index.isDirectory("/t/n/a.txt"));
+
+    TEST_ASSERT_TRUE(fs.rename("/t/n/a.txt", "/t/n/b.txt"));
+    index.apply(FSInterface::Change::Rename, "/t/n/a.txt", "/t/n/b.txt");
+    TEST_ASSERT_FALSE(index.exists("/t/n/a.txt"));
+    TEST_ASSERT_TRUE(index.exists("/t/n/b.txt"));
+
+    FileExplorer::FileTree tree("/");
+    TEST_ASSERT_TRUE(index.buildTree("/t/n", *tree.root));
+    TEST_ASSERT_EQUAL_size_t(1, tree.root->children.size());
+
+    TEST_ASSERT_TRUE(fs.deletePath("/t/n"));
+    index.apply(FSInterface::Change::Remove, "/t/n", "");
+    TEST_ASSERT_FALSE(index.exists("/t/n"));
+}
+
+// 追加写回缓存: 合并写入, 读取前写回, 删除时丢弃
+void test_write_cache_coalesces_appends() {
+    WriteBehindCache& cache = FileExplorer::writeCache();
+    cache.setConfig({true, 4096, 16384, 60000});
+
+    fe->createFile("/t/log.csv");
+    const std::string line = "1760000000,23.51,41.20\n";
+    size_t writeBacks = cache.stats().writeBacks;
+    for (int i = 0; i < 100; ++i) fe->writeFileAsString("/t/log.csv", line, "a");
+    TEST_ASSERT_TRUE(cache.pendingBytes() > 0);
+    TEST_ASSERT_EQUAL_size_t(100 * line.size(), fe->readFileAsString("/t/log.csv").size());  // 读取前写回
+    TEST_ASSERT_TRUE(cache.stats().writeBacks - writeBacks < 5);
+
+    fe->writeFileAsString("/t/log.csv", "tail", "a");
+    fe->deletePath("/t/log.csv");
+    TEST_ASSERT_EQUAL_size_t(0, cache.pendingBytes());
+    TEST_ASSERT_FALSE(fe->exists("/t/log.csv"));
+
+    cache.setConfig({false, 4096, 16384, 2000});
+}
+
+int main() {
+    PosixFSBackend::setRoot(".pio/gsos_test_fs");
+    FileExplorer explorer;
+    fe = &explorer;
+
+    UNITY_BEGIN();
+    RUN_TEST(test_fs_interface_primitives);
+    RUN_TEST(test_explorer_copy_move_delete);
+    RUN_TEST(test_explorer_move_into_self_is_rejected);
+    RUN_TEST(test_explorer_chunked_io);
+    RUN_TEST(test_index_tracks_direct_changes);
+    RUN_TEST(test_index_without_persistence_tracks_changes);
+    RUN_TEST(test_write_cache_coalesces_appends);
+    return UNITY_END();
+}
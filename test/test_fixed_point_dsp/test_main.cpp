@@ -0,0 +1,297 @@
+/**
+ * @file test_main.cpp
+ * @date 17.10.2026
+ * @author RMSHE
+ *
+ * < GasSensorOS >
+ * Copyright(C) 2026 RMSHE. All rights reserved.
+ *
+ * This program is free software : you can redistribute it and /or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.If not, see < https://www.gnu.org/licenses/>.
+ *
+ * Electronic Mail : asdfghjkl851@outlook.com
+ */
+
+// 定点 FFT/FIR/biquad 与浮点/双精度参考的量化误差界对照、逐位黄金向量与满量程不溢出测试: pio test -e native -f test_fixed_point_dsp
+
+#include <unity.h>
+
+#include <cmath>
+#include <digital_filter.hpp>
+#include <fixed_point_dsp.hpp>
+#include <fourier_transform.hpp>
+#include <random>
+#include <vector>
+
+using namespace fixed_point;
+using ComplexD = std::complex<double>;
+
+void setUp() {}
+void tearDown() {}
+
+static std::mt19937 rng(7);
+
+// 定点结果按块指数还原为实数
+template <typename T>
+static ComplexD toComplex(const Complex<T>& value, int exponent) {
+    return {std::ldexp(static_cast<double>(value.re), exponent - Traits<T>::kFracBits), std::ldexp(static_cast<double>(value.im), exponent - Traits<T>::kFracBits)};
+}
+
+// 量化误差界: 每级蝶形的舍入误差不超过 1 LSB, log2(n) 级累积后按 √(n·log2 n) 增长;
+// 另加浮点参考实现自身的相对误差
+static double fftBound(size_t n, int exponent, int frac_bits, double peak) {
+    const double stages = std::max(1.0, std::log2(static_cast<double>(n)));
+    return (2.0 * std::sqrt(n * stages) + 1.0) * std::ldexp(1.0, exponent - frac_bits) + 1e-5 * std::max(1.0, peak);
+}
+
+// 复数正变换、反变换往返与实数 FFT 都与 FastFourierTransform 一致(按块指数还原后落在量化误差界内)
+template <typename T>
+static void checkFFT(double amplitude) {
+    std::uniform_real_distribution<double> uniform(-amplitude, amplitude);
+    FixedPointFFT<T> fft;
+    FastFourierTransform reference;
+    for (size_t n = 2; n <= 1024; n *= 2) {
+        std::vector<Complex<T>> x(n);
+        std::vector<std::complex<float>> expected(n);
+        for (size_t i = 0; i < n; ++i) {
+            x[i] = {fromFloat<T>(uniform(rng)), fromFloat<T>(uniform(rng))};
+            expected[i] = {toFloat(x[i].re), toFloat(x[i].im)};
+        }
+        const std::vector<Complex<T>> input = x;
+        TEST_ASSERT_TRUE(fft.transform(x));
+        TEST_ASSERT_TRUE(reference.transform(expected));
+
+        // 块指数: 不超过 log2(n), 且足以容纳结果的峰值
+        const int exponent = fft.exponent();
+        double peak = 0, error = 0;
+        for (size_t i = 0; i < n; ++i) peak = std::max(peak, static_cast<double>(std::abs(expected[i])));
+        for (size_t i = 0; i < n; ++i) error = std::max(error, std::abs(toComplex(x[i], exponent) - ComplexD(expected[i])));
+        TEST_ASSERT_TRUE(exponent >= 0 && exponent <= std::log2(n));
+        TEST_ASSERT_TRUE(std::ldexp(1.0, exponent) >= peak / std::sqrt(2.0));
+        TEST_ASSERT_TRUE(error <= fftBound(n, exponent, Traits<T>::kFracBits, peak));
+
+        // 反变换的 1/n 计入块指数, 往返后还原输入(误差为反变换自身的舍入加上正变换误差经反变换后的部分)
+        TEST_ASSERT_TRUE(fft.transform(x, true));
+        const int total = exponent + fft.exponent();
+        error = 0;
+        for (size_t i = 0; i < n; ++i) error = std::max(error, std::abs(toComplex(x[i], total) - toComplex(input[i], 0)));
+        TEST_ASSERT_TRUE(error <= fftBound(n, total, Traits<T>::kFracBits, 1) + fftBound(n, exponent, Traits<T>::kFracBits, peak) / std::sqrt(n));
+
+        std::vector<T> real(n);
+        std::vector<float> real_float(n);
+        for (size_t i = 0; i < n; ++i) real_float[i] = toFloat(real[i] = fromFloat<T>(uniform(rng)));
+        std::vector<Complex<T>> spectrum;
+        std::vector<std::complex<float>> expected_spectrum;
+        TEST_ASSERT_TRUE(fft.realFFT(real, spectrum));
+        TEST_ASSERT_TRUE(reference.realFFT(real_float, expected_spectrum));
+        TEST_ASSERT_EQUAL_size_t(n / 2 + 1, spectrum.size());
+        peak = error = 0;
+        for (size_t k = 0; k <= n / 2; ++k) peak = std::max(peak, static_cast<double>(std::abs(expected_spectrum[k])));
+        for (size_t k = 0; k <= n / 2; ++k) error = std::max(error, std::abs(toComplex(spectrum[k], fft.exponent()) - ComplexD(expected_spectrum[k])));
+        TEST_ASSERT_TRUE(error <= 2 * fftBound(n, fft.exponent(), Traits<T>::kFracBits, peak));
+    }
+
+    std::vector<Complex<T>> odd(12);
+    TEST_ASSERT_FALSE(fft.transform(odd));
+}
+
+void test_fft_matches_float_reference() {
+    checkFFT<q15>(0.5);
+    checkFFT<q15>(0.002);  // 幅值很小时不需要右移, 块指数为 0
+    checkFFT<q31>(0.5);
+}
+
+// 小幅值输入没有溢出风险, 块指数必须为 0 以免白白损失精度
+void test_fft_exponent_only_grows_when_needed() {
+    FixedPointFFT<q15> fft;
+    std::vector<Complex<q15>> x(64, Complex<q15>{fromFloat<q15>(0.25), 0});
+    TEST_ASSERT_TRUE(fft.transform(x));
+    TEST_ASSERT_TRUE(fft.exponent() >= 4 && fft.exponent() <= 6);  // X[0] = 64 × 0.25 = 16
+    TEST_ASSERT_DOUBLE_WITHIN(1e-3, 16.0, toComplex(x[0], fft.exponent()).real());
+
+    std::vector<Complex<q15>> quiet(64, Complex<q15>{100, 0});
+    TEST_ASSERT_TRUE(fft.transform(quiet));
+    TEST_ASSERT_EQUAL_INT(0, fft.exponent());
+    TEST_ASSERT_EQUAL_INT(6400, quiet[0].re);
+    for (size_t i = 1; i < quiet.size(); ++i) TEST_ASSERT_TRUE(quiet[i].re == 0 && quiet[i].im == 0);
+}
+
+// FIR 与双精度卷积(使用量化后的系数)相差不超过 1 LSB
+template <typename T>
+static void checkFIR() {
+    std::uniform_real_distribution<double> uniform(-0.9, 0.9);
+    std::vector<float> taps = {0.05f, -0.12f, 0.2f, 0.35f, 0.2f, -0.12f, 0.05f, 0.01f, -0.3f};
+    FixedPointFIR<T> fir = FixedPointFIR<T>::fromFloat(taps);
+    std::vector<double> h(taps.size());
+    for (size_t t = 0; t < taps.size(); ++t) h[t] = std::ldexp(static_cast<double>(fromFloat<T>(taps[t])), -Traits<T>::kFracBits);
+
+    std::vector<T> xs;
+    for (int i = 0; i < 2000; ++i) {
+        xs.push_back(fromFloat<T>(uniform(rng)));
+        double expected = 0;
+        for (size_t t = 0; t < h.size() && t < xs.size(); ++t) expected += h[t] * xs[xs.size() - 1 - t];
+        TEST_ASSERT_DOUBLE_WITHIN(1.0, expected, static_cast<double>(fir.process(xs.back())));
+    }
+
+    // 块处理与逐样本处理一致, reset 清空延迟线
+    fir.reset();
+    std::vector<T> block(xs.size());
+    fir.process(xs.data(), block.data(), xs.size());
+    FixedPointFIR<T> single = FixedPointFIR<T>::fromFloat(taps);
+    for (size_t i = 0; i < xs.size(); ++i) TEST_ASSERT_TRUE(block[i] == single.process(xs[i]));
+}
+
+// biquad 每一步与双精度差分方程(量化系数、相同的状态)相差不超过 1 LSB;
+// 独立运行的双精度滤波器(原始系数)与定点输出的差别保持在量化噪声量级
+template <typename T>
+static void checkBiquad() {
+    std::uniform_real_distribution<double> uniform(-0.5, 0.5);
+    const auto design = BiquadCoefficients<double>::lowPass(1000, 60);
+    FixedPointBiquad<T> biquad(design.b0, design.b1, design.b2, design.a1, design.a2);
+
+    const int coeff_bits = Traits<T>::kFracBits - 1;
+    auto quantize = [&](double c) { return std::ldexp(std::nearbyint(static_cast<double>(static_cast<float>(c)) * std::ldexp(1.0, coeff_bits)), -coeff_bits); };
+    const double b0 = quantize(design.b0), b1 = quantize(design.b1), b2 = quantize(design.b2), a1 = -quantize(-design.a1), a2 = -quantize(-design.a2);
+
+    double x1 = 0, x2 = 0, y1 = 0, y2 = 0;         // 定点滤波器的状态(整数刻度)
+    double fx1 = 0, fx2 = 0, fy1 = 0, fy2 = 0;     // 独立的双精度滤波器
+    double max_drift = 0;
+    for (int i = 0; i < 4000; ++i) {
+        const T x = fromFloat<T>(uniform(rng));
+        const double expected = b0 * x + b1 * x1 + b2 * x2 - a1 * y1 - a2 * y2;
+        const T y = biquad.process(x);
+        TEST_ASSERT_DOUBLE_WITHIN(1.0, expected, static_cast<double>(y));
+        x2 = x1, x1 = x, y2 = y1, y1 = y;
+
+        const double fy = design.b0 * x + design.b1 * fx1 + design.b2 * fx2 - design.a1 * fy1 - design.a2 * fy2;
+        fx2 = fx1, fx1 = x, fy2 = fy1, fy1 = fy;
+        max_drift = std::max(max_drift, std::abs(fy - y));
+    }
+    // 低通极点靠近单位圆, 舍入噪声被放大约 1/(1-|p|)^2 倍, 系数量化也会带来少量增益误差
+    TEST_ASSERT_TRUE(max_drift < std::ldexp(1.0, Traits<T>::kFracBits) * 2e-3);
+}
+
+void test_fir_and_biquad_match_double_reference() {
+    checkFIR<q15>();
+    checkFIR<q31>();
+    checkBiquad<q15>();
+    checkBiquad<q31>();
+}
+
+// 逐位黄金向量: 全部为整数运算, 主机与 ESP32 上的结果必须逐位相同
+void test_golden_vectors_are_bit_exact() {
+    const q15 x[16] = {0, 12000, -8000, 30000, -32768, 32767, 100, -100, 5000, -5000, 20000, 1, 2, -3, 16384, -16384};
+
+    FixedPointFFT<q15> fft;
+    Complex<q15> spectrum[9];
+    TEST_ASSERT_TRUE(fft.realFFT(x, 16, spectrum));
+    const Complex<q15> golden_spectrum[9] = {{6750, 0}, {-1709, -830}, {-1664, -1270}, {766, -1023}, {-7031, -3281}, {56, -659}, {11106, -2392}, {-1611, -16852}, {-6570, 0}};
+    TEST_ASSERT_EQUAL_INT(3, fft.exponent());
+    for (int k = 0; k < 9; ++k) {
+        TEST_ASSERT_EQUAL_INT(golden_spectrum[k].re, spectrum[k].re);
+        TEST_ASSERT_EQUAL_INT(golden_spectrum[k].im, spectrum[k].im);
+    }
+
+    // h = {0.25, -0.5, 0.125, 2^-15}
+    FixedPointFIR<q15> fir({8192, -16384, 4096, 1});
+    const q15 golden_fir[16] = {0, 3000, -8000, 13000, -24192, 28326, -20454, 4020, 1313, -3762, 8125, -10625, 2500, -1, 4098, -12288};
+    for (int i = 0; i < 16; ++i) TEST_ASSERT_EQUAL_INT(golden_fir[i], fir.process(x[i]));
+
+    FixedPointBiquad<q15> biquad(0.2f, 0.4f, 0.2f, -0.6f, 0.2f);
+    const q15 golden_biquad[16] = {0, 2400, 4640, 7504, 7421, 2398, 6528, 10011, 5681, 2386, 3295, 8500, 8442, 3365, 3607, 4767};
+    for (int i = 0; i < 16; ++i) TEST_ASSERT_EQUAL_INT(golden_biquad[i], biquad.process(x[i]));
+}
+
+// 满量程输入: FFT 靠块指数避免溢出, FIR/biquad 饱和而不回绕
+template <typename T>
+static void checkFullScale() {
+    const size_t n = 256;
+    const T max = static_cast<T>(Traits<T>::kMax), min = static_cast<T>(Traits<T>::kMin);
+    const double full = std::ldexp(static_cast<double>(Traits<T>::kMax), -Traits<T>::kFracBits);
+    FixedPointFFT<T> fft;
+
+    // 直流与奈奎斯特: 能量集中在一个频点上, 其余频点为 0
+    for (int nyquist = 0; nyquist < 2; ++nyquist) {
+        std::vector<Complex<T>> x(n);
+        for (size_t i = 0; i < n; ++i) x[i].re = x[i].im = (nyquist && (i & 1)) ? min : max;
+        TEST_ASSERT_TRUE(fft.transform(x));
+        const size_t bin = nyquist ? n / 2 : 0;
+        const double bound = fftBound(n, fft.exponent(), Traits<T>::kFracBits, n);
+        const ComplexD peak = toComplex(x[bin], fft.exponent());
+        TEST_ASSERT_DOUBLE_WITHIN(bound, n * full, peak.real());
+        TEST_ASSERT_DOUBLE_WITHIN(bound, n * full, peak.imag());
+        for (size_t i = 0; i < n; ++i)
+            if (i != bin) TEST_ASSERT_TRUE(std::abs(toComplex(x[i], fft.exponent())) <= bound);
+    }
+
+    // 实数满量程方波: 奇次谐波幅值 2n/(πk), 与浮点参考一致
+    std::vector<T> square(n);
+    std::vector<float> square_float(n);
+    for (size_t i = 0; i < n; ++i) square_float[i] = toFloat(square[i] = (i / 16) % 2 ? min : max);
+    std::vector<Complex<T>> spectrum;
+    std::vector<std::complex<float>> expected;
+    TEST_ASSERT_TRUE(fft.realFFT(square, spectrum));
+    FastFourierTransform().realFFT(square_float, expected);
+    for (size_t k = 0; k <= n / 2; ++k)
+        TEST_ASSERT_TRUE(std::abs(toComplex(spectrum[k], fft.exponent()) - ComplexD(expected[k])) <= 2 * fftBound(n, fft.exponent(), Traits<T>::kFracBits, n));
+
+    // 系数和大于 1 的 FIR 在满量程输入下饱和到极值, 不会回绕成相反符号
+    FixedPointFIR<T> fir({max, max, max});
+    for (int i = 0; i < 8; ++i) TEST_ASSERT_TRUE(fir.process(max) == (i == 0 ? max - 1 : max));
+    TEST_ASSERT_TRUE(fir.process(min) > 0);  // 窗口内仍有两个满量程正样本
+    for (int i = 0; i < 8; ++i) TEST_ASSERT_TRUE(fir.process(min) == min);
+
+    // 直流增益为 1 的低通在满量程阶跃下输出不越界、不翻转符号
+    const auto design = BiquadCoefficients<double>::lowPass(1000, 100);
+    FixedPointBiquad<T> biquad(design.b0, design.b1, design.b2, design.a1, design.a2);
+    T y = 0;
+    for (int i = 0; i < 500; ++i) {
+        y = biquad.process(max);
+        TEST_ASSERT_TRUE(y >= 0);
+    }
+    TEST_ASSERT_TRUE(y > max - max / 100);
+    for (int i = 0; i < 500; ++i) {
+        y = biquad.process(min);
+        TEST_ASSERT_TRUE(y <= max);
+    }
+    TEST_ASSERT_TRUE(y < min - min / 100);
+
+    // 系数接近 ±2 时 5 个乘积同号相加, 累加器也不能溢出: 每一步与双精度差分方程(饱和后)一致
+    FixedPointBiquad<T> wide(1.9f, -1.9f, 1.9f, -1.8f, 0.81f);
+    const int coeff_bits = Traits<T>::kFracBits - 1;
+    double c[5] = {1.9f, -1.9f, 1.9f, 1.8f, -0.81f};
+    for (double& value : c) value = std::ldexp(std::nearbyint(value * std::ldexp(1.0, coeff_bits)), -coeff_bits);
+    double x1 = 0, x2 = 0, y1 = 0, y2 = 0;
+    for (int i = 0; i < 64; ++i) {
+        const T x = (i & 1) ? min : max;
+        const double expected = std::min<double>(std::max<double>(c[0] * x + c[1] * x1 + c[2] * x2 + c[3] * y1 + c[4] * y2, min), max);
+        const T out = wide.process(x);
+        TEST_ASSERT_DOUBLE_WITHIN(1.0, expected, static_cast<double>(out));
+        x2 = x1, x1 = x, y2 = y1, y1 = out;
+    }
+}
+
+void test_full_scale_does_not_overflow() {
+    checkFullScale<q15>();
+    checkFullScale<q31>();
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_fft_matches_float_reference);
+    RUN_TEST(test_fft_exponent_only_grows_when_needed);
+    RUN_TEST(test_fir_and_biquad_match_double_reference);
+    RUN_TEST(test_golden_vectors_are_bit_exact);
+    RUN_TEST(test_full_scale_does_not_overflow);
+    return UNITY_END();
+}
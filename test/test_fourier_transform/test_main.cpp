@@ -0,0 +1,128 @@
+/**
+ * @file test_main.cpp
+ * @date 17.10.2026
+ * @author RMSHE
+ *
+ * < GasSensorOS >
+ * Copyright(C) 2026 RMSHE. All rights reserved.
+ *
+ * This program is free software : you can redistribute it and /or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.If not, see < https://www.gnu.org/licenses/>.
+ *
+ * Electronic Mail : asdfghjkl851@outlook.com
+ */
+
+// FFT/DFT 向量化内核与标量参考实现、双精度直接 DFT 的对照测试: pio test -e native -f test_fourier_transform
+
+#include <unity.h>
+
+#include <algorithm>
+#include <cmath>
+#include <fourier_transform.hpp>
+#include <random>
+
+using ComplexD = std::complex<double>;
+
+static std::mt19937 rng(5);
+static std::uniform_real_distribution<float> uniform(-1.0f, 1.0f);
+
+// 双精度直接 DFT(逆变换时除以 n)
+static std::vector<ComplexD> referenceDFT(const std::vector<ComplexD>& x, bool inverse = false) {
+    size_t n = x.size();
+    std::vector<ComplexD> y(n);
+    for (size_t k = 0; k < n; ++k) {
+        for (size_t j = 0; j < n; ++j) y[k] += x[j] * std::polar(1.0, (inverse ? 2 : -2) * M_PI * double(k * j % n) / n);
+        if (inverse) y[k] /= double(n);
+    }
+    return y;
+}
+
+static std::vector<std::complex<float>> randomSignal(size_t n) {
+    std::vector<std::complex<float>> x(n);
+    for (auto& value : x) value = {uniform(rng), uniform(rng)};
+    return x;
+}
+
+void setUp() {}
+void tearDown() {}
+
+// 当前内核(AVX/SSE2/标量)与标量参考内核在 N=1..4096 上结果一致
+void test_fft_kernel_matches_scalar_reference() {
+    TEST_MESSAGE(FastFourierTransform::kernelName());
+    FastFourierTransform fft;
+    for (size_t n = 1; n <= 4096; n *= 2) {
+        for (int inverse = 0; inverse < 2; ++inverse) {
+            std::vector<std::complex<float>> vector_result = randomSignal(n), scalar_result = vector_result;
+            TEST_ASSERT_TRUE(fft.transform(vector_result.data(), n, inverse));
+            TEST_ASSERT_TRUE(fft.transformReference(scalar_result.data(), n, inverse));
+            double error = 0;
+            for (size_t i = 0; i < n; ++i) error = std::max(error, static_cast<double>(std::abs(vector_result[i] - scalar_result[i])));
+            TEST_ASSERT_TRUE(error < 1e-4 * std::sqrt(static_cast<double>(n)));
+        }
+    }
+}
+
+// FFT 与双精度直接 DFT 一致, 正反变换往返还原输入, 实数 FFT 与复数结果一致
+void test_fft_matches_direct_dft() {
+    FastFourierTransform fft;
+    for (size_t n = 2; n <= 1024; n *= 2) {
+        std::vector<std::complex<float>> x = randomSignal(n), y = x;
+        std::vector<ComplexD> xd(x.begin(), x.end());
+        TEST_ASSERT_TRUE(fft.transform(y));
+        std::vector<ComplexD> reference = referenceDFT(xd);
+        double error = 0, magnitude = 1;
+        for (size_t i = 0; i < n; ++i) {
+            error = std::max(error, std::abs(ComplexD(y[i]) - reference[i]));
+            magnitude = std::max(magnitude, std::abs(reference[i]));
+        }
+        TEST_ASSERT_TRUE(error / magnitude < 1e-5);
+
+        fft.transform(y, true);
+        for (size_t i = 0; i < n; ++i) TEST_ASSERT_TRUE(std::abs(y[i] - x[i]) < 1e-5);
+
+        std::vector<float> real(n);
+        std::vector<ComplexD> real_d(n);
+        for (size_t i = 0; i < n; ++i) real_d[i] = real[i] = uniform(rng);
+        std::vector<std::complex<float>> spectrum;
+        TEST_ASSERT_TRUE(fft.realFFT(real, spectrum));
+        std::vector<ComplexD> real_reference = referenceDFT(real_d);
+        for (size_t k = 0; k <= n / 2; ++k) TEST_ASSERT_TRUE(std::abs(ComplexD(spectrum[k]) - real_reference[k]) < 1e-3);
+    }
+}
+
+// 任意长度的 DFT(包括非 2 的幂)与双精度直接 DFT 一致
+void test_dft_matches_direct_dft() {
+    DiscreteFourierTransform dft;
+    for (size_t n : {1, 2, 3, 5, 7, 12, 31, 64, 100, 257, 1000}) {
+        for (int inverse = 0; inverse < 2; ++inverse) {
+            std::vector<std::complex<float>> x = randomSignal(n), y(n);
+            std::vector<ComplexD> xd(x.begin(), x.end());
+            dft.transform(x.data(), y.data(), n, inverse);
+            std::vector<ComplexD> reference = referenceDFT(xd, inverse);
+            double error = 0, magnitude = 1e-9;
+            for (size_t i = 0; i < n; ++i) {
+                error = std::max(error, std::abs(ComplexD(y[i]) - reference[i]));
+                magnitude = std::max(magnitude, std::abs(reference[i]));
+            }
+            TEST_ASSERT_TRUE(error / magnitude < 2e-5);
+        }
+    }
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_fft_kernel_matches_scalar_reference);
+    RUN_TEST(test_fft_matches_direct_dft);
+    RUN_TEST(test_dft_matches_direct_dft);
+    return UNITY_END();
+}
@@ -0,0 +1,173 @@
+/**
+ * @file test_main.cpp
+ * @date 17.10.2026
+ * @author RMSHE
+ *
+ * < GasSensorOS >
+ * Copyright(C) 2026 RMSHE. All rights reserved.
+ *
+ * This program is free software : you can redistribute it and /or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.If not, see < https://www.gnu.org/licenses/>.
+ *
+ * Electronic Mail : asdfghjkl851@outlook.com
+ */
+
+// RingBuffer 回绕时的分段视图/复制/线性化/迭代器, 以及 SPSCRingBuffer 单线程语义与双线程压力测试: pio test -e native -f test_ring_buffer
+
+#include <unity.h>
+
+#include <cstdint>
+#include <deque>
+#include <ring_buffer.h>
+#include <thread>
+#include <vector>
+
+void setUp() {}
+void tearDown() {}
+
+template <typename Span>
+static void appendSpan(std::vector<int>& out, const Span& span) {
+    for (std::size_t i = 0; i < span.size; ++i) out.push_back(span[i]);
+}
+
+// 在各种起始位置与填充量(含回绕、满后覆盖)下, 分段视图、复制、迭代器与线性化都与按时间顺序的参考队列一致
+void test_ring_buffer_wrap_around_views() {
+    const std::size_t capacity = 8;
+    for (int pops = 0; pops < 8; ++pops) {
+        for (int pushes = 0; pushes < 20; ++pushes) {
+            RingBuffer<int, capacity> buffer;
+            std::deque<int> reference;
+            int next = 0;
+            auto push = [&] {
+                buffer.pushBack(next);
+                reference.push_back(next++);
+                if (reference.size() > capacity) reference.pop_front();  // 满时覆盖最旧元素
+            };
+            for (int i = 0; i < 5; ++i) push();
+            for (int i = 0; i < pops && !reference.empty(); ++i) {
+                TEST_ASSERT_TRUE(buffer.popFront());
+                reference.pop_front();
+            }
+            for (int i = 0; i < pushes; ++i) push();
+
+            const std::vector<int> expected(reference.begin(), reference.end());
+            TEST_ASSERT_EQUAL_size_t(expected.size(), buffer.size());
+
+            auto segments = buffer.segments();
+            TEST_ASSERT_TRUE(segments.second.empty() || !segments.first.empty());
+            std::vector<int> joined;
+            appendSpan(joined, segments.first);
+            appendSpan(joined, segments.second);
+            TEST_ASSERT_TRUE(joined == expected);
+
+            TEST_ASSERT_TRUE(std::vector<int>(buffer.begin(), buffer.end()) == expected);
+            const RingBuffer<int, capacity>& constBuffer = buffer;
+            TEST_ASSERT_TRUE(std::vector<int>(constBuffer.cbegin(), constBuffer.cend()) == expected);
+            std::vector<int> reversed;
+            for (auto it = buffer.end(); it != buffer.begin();) reversed.push_back(*--it);
+            TEST_ASSERT_TRUE(std::vector<int>(reversed.rbegin(), reversed.rend()) == expected);
+            if (!expected.empty()) TEST_ASSERT_EQUAL_INT(expected.back(), buffer.begin()[expected.size() - 1]);
+
+            for (std::size_t n = 0; n <= capacity + 2; ++n) {
+                const std::size_t taken = std::min(n, expected.size());
+                const std::vector<int> oldest(expected.begin(), expected.begin() + taken);
+                const std::vector<int> latest(expected.end() - taken, expected.end());
+
+                std::vector<int> latestJoined;
+                auto latestSegments = constBuffer.latestSegments(n);
+                appendSpan(latestJoined, latestSegments.first);
+                appendSpan(latestJoined, latestSegments.second);
+                TEST_ASSERT_TRUE(latestJoined == latest);
+
+                std::vector<int> copied(capacity + 2, -1);
+                TEST_ASSERT_EQUAL_size_t(taken, buffer.copyTo(copied.data(), n));
+                TEST_ASSERT_TRUE(std::vector<int>(copied.begin(), copied.begin() + taken) == oldest);
+                TEST_ASSERT_EQUAL_INT(-1, copied[taken]);  // 不越过 n 写入
+                TEST_ASSERT_EQUAL_size_t(taken, buffer.copyLatest(copied.data(), n));
+                TEST_ASSERT_TRUE(std::vector<int>(copied.begin(), copied.begin() + taken) == latest);
+            }
+
+            // 线性化后内容与顺序不变, 视图连续; 之后继续写入仍按环形语义工作
+            RingBuffer<int, capacity> window = buffer;
+            RingSpan<int> latestWindow = window.latestWindow(3);
+            const std::size_t windowSize = std::min<std::size_t>(3, expected.size());
+            TEST_ASSERT_EQUAL_size_t(windowSize, latestWindow.size);
+            TEST_ASSERT_TRUE(std::vector<int>(latestWindow.begin(), latestWindow.end()) == std::vector<int>(expected.end() - windowSize, expected.end()));
+
+            RingSpan<int> all = buffer.linearize();
+            TEST_ASSERT_TRUE(std::vector<int>(all.begin(), all.end()) == expected);
+            TEST_ASSERT_TRUE(buffer.segments().second.empty());
+            for (int i = 0; i < 11; ++i) push();
+            TEST_ASSERT_TRUE(std::vector<int>(buffer.begin(), buffer.end()) == std::vector<int>(reference.begin(), reference.end()));
+        }
+    }
+}
+
+// 满时拒绝写入而不是覆盖, 批量读写最多跨越两段
+void test_spsc_single_thread_semantics() {
+    SPSCRingBuffer<int, 4> buffer;
+    int value;
+    TEST_ASSERT_FALSE(buffer.tryPop(value));
+    for (int i = 0; i < 4; ++i) TEST_ASSERT_TRUE(buffer.tryPush(i));
+    TEST_ASSERT_FALSE(buffer.tryPush(9));
+    TEST_ASSERT_TRUE(buffer.full());
+
+    TEST_ASSERT_TRUE(buffer.tryPop(value));
+    TEST_ASSERT_EQUAL_INT(0, value);
+    int input[3] = {10, 11, 12};
+    TEST_ASSERT_EQUAL_size_t(1, buffer.pushN(input, 3));
+
+    int output[8];
+    TEST_ASSERT_EQUAL_size_t(4, buffer.popN(output, 8));
+    TEST_ASSERT_EQUAL_INT(1, output[0]);
+    TEST_ASSERT_EQUAL_INT(10, output[3]);
+    TEST_ASSERT_TRUE(buffer.empty());
+}
+
+// 生产者与消费者线程以不同的批量大小交替读写, 消费端必须按顺序收到每一个元素
+void test_spsc_two_thread_stress() {
+    const uint32_t total = 2000000;
+    SPSCRingBuffer<uint32_t, 1024> buffer;
+
+    std::thread producer([&] {
+        uint32_t batch[64];
+        for (uint32_t i = 0; i < total;) {
+            uint32_t count = std::min<uint32_t>(1 + i % 37, total - i);
+            for (uint32_t k = 0; k < count; ++k) batch[k] = i + k;
+            size_t written = (i & 1) ? buffer.pushN(batch, count) : (buffer.tryPush(batch[0]) ? 1 : 0);
+            if (written == 0) std::this_thread::yield();
+            i += written;
+        }
+    });
+
+    uint32_t expected = 0, output[64];
+    bool ordered = true;
+    while (expected < total) {
+        size_t count = (expected & 1) ? buffer.popN(output, 1 + expected % 50) : (buffer.tryPop(output[0]) ? 1 : 0);
+        if (count == 0) std::this_thread::yield();
+        for (size_t k = 0; k < count; ++k) ordered = ordered && output[k] == expected + k;
+        expected += count;
+    }
+    producer.join();
+
+    TEST_ASSERT_TRUE(ordered);
+    TEST_ASSERT_TRUE(buffer.empty());
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_ring_buffer_wrap_around_views);
+    RUN_TEST(test_spsc_single_thread_semantics);
+    RUN_TEST(test_spsc_two_thread_stress);
+    return UNITY_END();
+}
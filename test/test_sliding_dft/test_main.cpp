@@ -0,0 +1,166 @@
+/**
+ * @file test_main.cpp
+ * @date 17.10.2026
+ * @author RMSHE
+ *
+ * < GasSensorOS >
+ * Copyright(C) 2026 RMSHE. All rights reserved.
+ *
+ * This program is free software : you can redistribute it and /or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.If not, see < https://www.gnu.org/licenses/>.
+ *
+ * Electronic Mail : asdfghjkl851@outlook.com
+ */
+
+// SlidingDFT(含长时间运行后的影子值重新锚定)与 GoertzelBank 相对完整 DFT/FFT 的精度测试: pio test -e native -f test_sliding_dft
+
+#include <unity.h>
+
+#include <cmath>
+#include <deque>
+#include <fourier_transform.hpp>
+#include <random>
+#include <sliding_dft.hpp>
+
+using ComplexD = std::complex<double>;
+
+void setUp() {}
+void tearDown() {}
+
+static const double kPi = 3.14159265358979323846;
+static std::mt19937 rng(22);
+static std::uniform_real_distribution<float> uniform(-1.0f, 1.0f);
+
+// 窗口(最旧的样本相位为 0)在频点 k 上的双精度 DFT
+static ComplexD referenceBin(const std::deque<float>& window, size_t k) {
+    const size_t n = window.size();
+    ComplexD sum;
+    for (size_t m = 0; m < n; ++m) sum += static_cast<double>(window[m]) * std::polar(1.0, -2 * kPi * static_cast<double>(k * m % n) / n);
+    return sum;
+}
+
+// 每个样本后都与最近 N 个样本的直接 DFT 一致(未满一个窗口时, 之前的样本视为 0)
+void test_sliding_dft_matches_direct_dft() {
+    for (size_t n : {1, 5, 64, 100}) {
+        std::vector<size_t> bins = {0, 1, n / 2, n - 1, 3 * n + 2};  // 超出 N 的频点按 k mod N 处理
+        SlidingDFT sliding(n, bins);
+        TEST_ASSERT_EQUAL_size_t((3 * n + 2) % n, sliding.bin(4));
+        std::deque<float> window(n, 0.0f);
+        for (size_t t = 0; t < 4 * n + 3; ++t) {
+            const float x = uniform(rng);
+            sliding.push(x);
+            window.pop_front();
+            window.push_back(x);
+            TEST_ASSERT_TRUE(sliding.ready() == (t + 1 >= n));
+            for (size_t i = 0; i < sliding.bins(); ++i) TEST_ASSERT_TRUE(std::abs(ComplexD(sliding.value(i)) - referenceBin(window, sliding.bin(i))) < 1e-5 * n);
+        }
+
+        sliding.reset();
+        TEST_ASSERT_FALSE(sliding.ready());
+        for (size_t i = 0; i < sliding.bins(); ++i) TEST_ASSERT_TRUE(sliding.value(i) == SlidingDFT::Complex());
+    }
+}
+
+// 运行 100 万个样本后误差仍停留在单个窗口的舍入水平: 锚定前后的每个位置都与直接 DFT 一致;
+// 同样输入下不做重新锚定的纯递推误差持续累积, 超出同一误差界
+void test_sliding_dft_reanchoring_bounds_drift() {
+    for (size_t n : {100, 256}) {
+        const std::vector<size_t> bins = {0, 1, 7, n / 2, n - 1};
+        SlidingDFT sliding(n, bins);
+        std::vector<std::complex<float>> plain(bins.size()), rotation(bins.size());
+        for (size_t i = 0; i < bins.size(); ++i) rotation[i] = std::polar(1.0f, static_cast<float>(2 * kPi * bins[i] / n));
+        std::deque<float> window(n, 0.0f);
+
+        const double bound = 5e-6 * n;
+        double sliding_error = 0, plain_error = 0;
+        const size_t total = 1000000;
+        for (size_t t = 0; t < total; ++t) {
+            const float x = uniform(rng) + 0.5f;  // 带直流分量, 递推误差累积得更快
+            const float delta = x - window.front();
+            sliding.push(x);
+            window.pop_front();
+            window.push_back(x);
+            for (size_t i = 0; i < bins.size(); ++i) plain[i] = rotation[i] * (plain[i] + delta);
+
+            // 最后两个窗口内逐样本检查, 覆盖锚定前后的所有相位
+            if (t + 2 * n < total) continue;
+            for (size_t i = 0; i < bins.size(); ++i) {
+                const ComplexD reference = referenceBin(window, bins[i]);
+                sliding_error = std::max(sliding_error, std::abs(ComplexD(sliding.value(i)) - reference));
+                plain_error = std::max(plain_error, std::abs(ComplexD(plain[i]) - reference));
+            }
+        }
+        TEST_ASSERT_TRUE(sliding_error < bound);
+        TEST_ASSERT_TRUE(plain_error > bound);
+    }
+}
+
+// 频点中心的正弦分量: amplitude() 还原幅值, 直流与奈奎斯特频点不乘 2
+void test_sliding_dft_amplitude() {
+    const size_t n = 128;
+    SlidingDFT sliding(n, {0, 10, n / 2});
+    for (size_t t = 0; t < 5 * n + 17; ++t)
+        sliding.push(static_cast<float>(0.25 + 0.7 * std::cos(2 * kPi * 10 * t / n + 0.3) + 0.1 * ((t & 1) ? -1 : 1)));
+    TEST_ASSERT_FLOAT_WITHIN(1e-4f, 0.25f, sliding.amplitude(0));
+    TEST_ASSERT_FLOAT_WITHIN(1e-4f, 0.7f, sliding.amplitude(1));
+    TEST_ASSERT_FLOAT_WITHIN(1e-4f, 0.1f, sliding.amplitude(2));
+}
+
+// 整数频点上每一块的结果与该块的 realFFT 频点一致(相位以块首样本为参考);
+// 非整数频率与双精度 DTFT 一致. 谐振器把每步的 float 舍入误差放大约 N 倍, 误差界按 N²·ε 取
+void test_goertzel_matches_fft_bins() {
+    for (size_t n : {64, 256, 1024}) {
+        const std::vector<float> frequencies = {0, 1, 13, static_cast<float>(n / 4), static_cast<float>(n / 2 - 1), 13.37f};
+        std::vector<float> block(n);
+        std::vector<std::complex<float>> spectrum(n / 2 + 1);
+        FastFourierTransform fft;
+        size_t checked = 0;
+        const double bound = 1e-7 * n * n;
+
+        // fs = n 时频率即为频点编号
+        GoertzelBank bank(static_cast<float>(n), n, frequencies, [&](const GoertzelBank& done) {
+            TEST_ASSERT_TRUE(fft.realFFT(block.data(), n, spectrum.data()));
+            for (size_t i = 0; i + 1 < done.channels(); ++i) {
+                const size_t k = static_cast<size_t>(done.frequency(i));
+                TEST_ASSERT_TRUE(std::abs(ComplexD(done.value(i)) - ComplexD(spectrum[k])) < bound);
+            }
+            ComplexD dtft;
+            const double omega = 2 * kPi * frequencies.back() / n;
+            for (size_t m = 0; m < n; ++m) dtft += static_cast<double>(block[m]) * std::polar(1.0, -omega * m);
+            TEST_ASSERT_TRUE(std::abs(ComplexD(done.value(done.channels() - 1)) - dtft) < bound);
+            ++checked;
+        });
+
+        for (size_t b = 0; b < 5; ++b) {
+            for (size_t m = 0; m < n; ++m) block[m] = uniform(rng) + static_cast<float>(0.5 * std::sin(2 * kPi * 13 * m / n));
+            TEST_ASSERT_EQUAL_size_t(1, bank.push(block.data(), n));
+        }
+        TEST_ASSERT_EQUAL_size_t(5, checked);
+        TEST_ASSERT_EQUAL_size_t(5, bank.blocks());
+    }
+
+    // 纯音的幅值
+    GoertzelBank bank(1000.0f, 500, {50.0f, 120.0f});
+    for (size_t t = 0; t < 500; ++t) bank.push(static_cast<float>(0.6 * std::sin(2 * kPi * 50 * t / 1000.0)));
+    TEST_ASSERT_FLOAT_WITHIN(1e-4f, 0.6f, bank.amplitude(0));
+    TEST_ASSERT_FLOAT_WITHIN(1e-4f, 0.0f, bank.amplitude(1));
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_sliding_dft_matches_direct_dft);
+    RUN_TEST(test_sliding_dft_reanchoring_bounds_drift);
+    RUN_TEST(test_sliding_dft_amplitude);
+    RUN_TEST(test_goertzel_matches_fft_bins);
+    return UNITY_END();
+}
@@ -0,0 +1,140 @@
+/**
+ * @file test_main.cpp
+ * @date 17.10.2026
+ * @author RMSHE
+ *
+ * < GasSensorOS >
+ * Copyright(C) 2026 RMSHE. All rights reserved.
+ *
+ * This program is free software : you can redistribute it and /or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.If not, see < https://www.gnu.org/licenses/>.
+ *
+ * Electronic Mail : asdfghjkl851@outlook.com
+ */
+
+// 流式频谱分析: 纯音的 Welch PSD 峰值频点、频带功率与 Parseval 定理的对照: pio test -e native -f test_spectral_analyzer
+
+#include <unity.h>
+
+#include <cmath>
+#include <random>
+#include <spectral_analyzer.hpp>
+
+void setUp() {}
+void tearDown() {}
+
+static const double kPi = 3.14159265358979323846;
+
+// 位于频点中心的纯音(叠加直流): Hann 窗的泄漏只落在相邻的一个频点内, 各频带功率等于对应分量的均方值,
+// 全频带积分等于信号的均方值(Parseval)
+void test_pure_tone_peak_and_band_powers() {
+    SpectralAnalyzer::Config config;
+    config.sampleRate = 1000.0f;
+    config.frameSize = 256;
+    config.hopSize = 128;
+    config.bands = {{0.0f, 20.0f}, {80.0f, 120.0f}, {200.0f, 500.0f}, {0.0f, 501.0f}};
+    SpectralAnalyzer analyzer(config);
+
+    const size_t bin = 25;
+    const double frequency = bin * analyzer.binWidth();  // 97.65625 Hz
+    const double amplitude = 0.8, offset = 0.3;
+    const double power = amplitude * amplitude / 2 + offset * offset;
+    for (size_t i = 0; i < 256 * 16; ++i) analyzer.push(static_cast<float>(offset + amplitude * std::sin(2 * kPi * frequency * i / config.sampleRate)));
+    TEST_ASSERT_EQUAL_size_t((256 * 16 - 256) / 128 + 1, analyzer.frames());
+
+    // Welch PSD 的峰值位于纯音所在的频点(直流除外)
+    const std::vector<float>& psd = analyzer.welchPsd();
+    TEST_ASSERT_EQUAL_size_t(129, psd.size());
+    size_t peak = 1;
+    for (size_t k = 1; k < psd.size(); ++k)
+        if (psd[k] > psd[peak]) peak = k;
+    TEST_ASSERT_EQUAL_size_t(bin, peak);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-3, frequency, analyzer.binFrequency(peak));
+
+    // 频带功率: 直流、纯音、空频带与全频带(Parseval), 本帧与 Welch 平均结果一致
+    for (const std::vector<float>* powers : {&analyzer.bandPowers(), &analyzer.welchBandPowers()}) {
+        TEST_ASSERT_DOUBLE_WITHIN(1e-4, offset * offset, (*powers)[0]);
+        TEST_ASSERT_DOUBLE_WITHIN(1e-4, amplitude * amplitude / 2, (*powers)[1]);
+        TEST_ASSERT_DOUBLE_WITHIN(1e-5, 0.0, (*powers)[2]);
+        TEST_ASSERT_DOUBLE_WITHIN(1e-4, power, (*powers)[3]);
+    }
+
+    // 全部频点的积分(直接对 PSD 求和)同样满足 Parseval
+    double total = 0;
+    for (float value : psd) total += value * analyzer.binWidth();
+    TEST_ASSERT_DOUBLE_WITHIN(1e-4, power, total);
+}
+
+// 白噪声: 各窗函数下 Welch 平均的全频带功率等于样本方差(Parseval), PSD 大致平坦(σ²/(fs/2))
+void test_welch_noise_satisfies_parseval() {
+    for (auto window : {SpectralAnalyzer::Window::Rectangular, SpectralAnalyzer::Window::Hann, SpectralAnalyzer::Window::Hamming, SpectralAnalyzer::Window::Blackman}) {
+        SpectralAnalyzer::Config config;
+        config.sampleRate = 200.0f;
+        config.frameSize = 200;  // 向上取整为 256
+        config.hopSize = 64;
+        config.window = window;
+        config.bands = {{0.0f, 101.0f}, {0.0f, 50.0f}, {50.0f, 101.0f}};
+        size_t callbacks = 0;
+        SpectralAnalyzer analyzer(config, [&](const SpectralAnalyzer::Frame& frame) { TEST_ASSERT_EQUAL_size_t(callbacks++, frame.index); });
+        TEST_ASSERT_EQUAL_size_t(256, analyzer.config().frameSize);
+
+        std::mt19937 rng(21);
+        std::normal_distribution<float> noise(0.0f, 0.5f);
+        std::vector<float> x(256 * 400);
+        double variance = 0;
+        for (float& value : x) {
+            value = noise(rng);
+            variance += value * value;
+        }
+        variance /= x.size();
+        TEST_ASSERT_EQUAL_size_t((x.size() - 256) / 64 + 1, analyzer.push(x.data(), x.size()));
+        TEST_ASSERT_EQUAL_size_t(analyzer.frames(), callbacks);
+
+        const std::vector<float>& powers = analyzer.welchBandPowers();
+        TEST_ASSERT_DOUBLE_WITHIN(0.03 * variance, variance, powers[0]);
+        TEST_ASSERT_DOUBLE_WITHIN(0.05 * variance, variance / 2, powers[1]);
+        TEST_ASSERT_DOUBLE_WITHIN(0.05 * variance, variance / 2, powers[2]);
+        const double level = variance / (config.sampleRate / 2);
+        for (size_t k = 1; k + 1 < analyzer.bins(); ++k) TEST_ASSERT_DOUBLE_WITHIN(0.5 * level, level, analyzer.welchPsd()[k]);
+
+        analyzer.reset();
+        TEST_ASSERT_EQUAL_size_t(0, analyzer.frames());
+        TEST_ASSERT_EQUAL_size_t(0, analyzer.push(x.data(), 255));
+    }
+}
+
+// 指数平均跟踪幅值变化: 纯音幅值减半后 Welch 频带功率收敛到新的值
+void test_exponential_smoothing_tracks_changes() {
+    SpectralAnalyzer::Config config;
+    config.sampleRate = 1000.0f;
+    config.frameSize = 128;
+    config.hopSize = 128;
+    config.smoothing = 0.5f;
+    config.bands = {{0.0f, 501.0f}};
+    SpectralAnalyzer analyzer(config);
+
+    const double frequency = 10 * analyzer.binWidth();
+    size_t i = 0;
+    for (; i < 128 * 20; ++i) analyzer.push(static_cast<float>(std::sin(2 * kPi * frequency * i / config.sampleRate)));
+    TEST_ASSERT_DOUBLE_WITHIN(1e-3, 0.5, analyzer.welchBandPowers()[0]);
+    for (; i < 128 * 40; ++i) analyzer.push(static_cast<float>(0.5 * std::sin(2 * kPi * frequency * i / config.sampleRate)));
+    TEST_ASSERT_DOUBLE_WITHIN(1e-3, 0.125, analyzer.welchBandPowers()[0]);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_pure_tone_peak_and_band_powers);
+    RUN_TEST(test_welch_noise_satisfies_parseval);
+    RUN_TEST(test_exponential_smoothing_tracks_changes);
+    return UNITY_END();
+}
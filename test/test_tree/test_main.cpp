@@ -0,0 +1,222 @@
+/**
+ * @file test_main.cpp
+ * @date 17.10.2026
+ * @author RMSHE
+ *
+ * < GasSensorOS >
+ * Copyright(C) 2026 RMSHE. All rights reserved.
+ *
+ * This program is free software : you can redistribute it and /or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.If not, see < https://www.gnu.org/licenses/>.
+ *
+ * Electronic Mail : asdfghjkl851@outlook.com
+ */
+
+// 树的遍历顺序、深树(无递归)遍历与销毁, 以及子树统计缓存的单元测试: pio test -e native -f test_tree
+
+#include <unity.h>
+
+#include <random>
+#include <tree.hpp>
+#include <vector>
+
+void setUp() {}
+void tearDown() {}
+
+template <typename Range>
+static std::vector<int> values(Range&& range) {
+    std::vector<int> result;
+    for (auto& node : range) result.push_back(node.node_data);
+    return result;
+}
+
+// 样例树: 0 的子节点为 1, 2, 3; 1 的子节点为 4, 5; 5 的子节点为 7; 3 的子节点为 6
+template <typename Policy>
+static void buildSample(Tree<int, Policy>& tree, TreeNode<int, Policy>*& one) {
+    one = tree.root->addChild(1);
+    tree.root->addChild(2);
+    auto* three = tree.root->addChild(3);
+    one->addChild(4);
+    one->addChild(5)->addChild(7);
+    three->addChild(6);
+}
+
+// 前序/后序/层序区间、forEach* 与 traversalDFS/BFS 的访问顺序, 以及从子树起点开始的遍历
+template <typename Policy>
+static void checkTraversalOrder() {
+    Tree<int, Policy> tree(0);
+    TreeNode<int, Policy>* one = nullptr;
+    buildSample(tree, one);
+
+    const std::vector<int> pre = {0, 1, 4, 5, 7, 2, 3, 6};
+    const std::vector<int> post = {4, 7, 5, 1, 2, 6, 3, 0};
+    const std::vector<int> level = {0, 1, 2, 3, 4, 5, 6, 7};
+    TEST_ASSERT_TRUE(values(tree.preOrder()) == pre);
+    TEST_ASSERT_TRUE(values(tree.postOrder()) == post);
+    TEST_ASSERT_TRUE(values(tree.levelOrder()) == level);
+
+    std::vector<int> visited;
+    tree.forEachPreOrder([&](TreeNode<int, Policy>& node) { visited.push_back(node.node_data); });
+    TEST_ASSERT_TRUE(visited == pre);
+    visited.clear();
+    tree.forEachPostOrder([&](TreeNode<int, Policy>& node) { visited.push_back(node.node_data); });
+    TEST_ASSERT_TRUE(visited == post);
+    visited.clear();
+    tree.forEachLevelOrder([&](TreeNode<int, Policy>& node) { visited.push_back(node.node_data); });
+    TEST_ASSERT_TRUE(visited == level);
+
+    visited.clear();
+    for (auto& item : tree.traversalDFS()) visited.push_back(item.first);
+    TEST_ASSERT_TRUE(visited == pre);
+    visited.clear();
+    for (auto& item : tree.traversalBFS()) visited.push_back(item.first);
+    TEST_ASSERT_TRUE(visited == level);
+
+    TEST_ASSERT_TRUE(values(tree.preOrder(one)) == std::vector<int>({1, 4, 5, 7}));
+    TEST_ASSERT_TRUE(values(tree.postOrder(one)) == std::vector<int>({4, 7, 5, 1}));
+    TEST_ASSERT_TRUE(values(tree.levelOrder(one)) == std::vector<int>({1, 4, 5, 7}));
+    TEST_ASSERT_TRUE(values(tree.preOrder(one->children[0].get())) == std::vector<int>({4}));
+}
+
+void test_traversal_order() {
+    checkTraversalOrder<TreeLinearPolicy>();
+    checkTraversalOrder<TreeFullHashPolicy>();
+    checkTraversalOrder<TreeStatsPolicy>();
+    checkTraversalOrder<TreePoolPolicy>();
+}
+
+// 10 万层的链状树: 遍历、统计与销毁都不能递归, 否则会耗尽栈.
+// SubtreeStats 策略每次插入都要向上更新全部祖先, 在链状树上建树是 O(N^2), 故不参与该项测试.
+template <typename Policy>
+static void checkDeepTree() {
+    const int depth = 100000;
+    auto* tree = new Tree<int, Policy>(0);
+    TreeNode<int, Policy>* node = tree->root.get();
+    for (int i = 1; i < depth; ++i) node = node->addChild(i);
+    TreeNode<int, Policy>* deepest = node;
+
+    int expected = 0;
+    bool ordered = true;
+    for (auto& visited : tree->preOrder()) ordered = ordered && visited.node_data == expected++;
+    TEST_ASSERT_TRUE(ordered);
+    TEST_ASSERT_EQUAL_INT(depth, expected);
+
+    expected = depth - 1;
+    for (auto& visited : tree->postOrder()) ordered = ordered && visited.node_data == expected--;
+    TEST_ASSERT_TRUE(ordered);
+
+    size_t count = 0;
+    tree->forEachLevelOrder([&](TreeNode<int, Policy>&) { ++count; });
+    TEST_ASSERT_EQUAL_size_t(depth, count);
+
+    TreeStats stats = tree->getStats();
+    TEST_ASSERT_EQUAL_UINT32(depth, stats.size);
+    TEST_ASSERT_EQUAL_UINT32(depth, stats.depth);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.breadth);
+    TEST_ASSERT_EQUAL_UINT32(depth, tree->getDepth());
+    TEST_ASSERT_EQUAL_UINT32(depth, tree->getSize());
+    TEST_ASSERT_EQUAL_INT(depth - 1, tree->getLevel(deepest));
+
+    // 删除中间的节点会释放其下近 5 万层的后裔
+    TreeNode<int, Policy>* middle = tree->findNode(depth / 2).front();
+    TEST_ASSERT_TRUE(tree->deleteNode(middle));
+    TEST_ASSERT_EQUAL_UINT32(depth / 2, tree->getSize());
+    TEST_ASSERT_EQUAL_UINT32(depth / 2, tree->getDepth());
+
+    node = tree->findNode(depth / 2 - 1).front();
+    for (int i = 0; i < depth; ++i) node = node->addChild(i);
+    delete tree;
+}
+
+void test_deep_tree_without_recursion() {
+    checkDeepTree<TreeLinearPolicy>();
+    checkDeepTree<TreeFullHashPolicy>();
+    checkDeepTree<TreePoolPolicy>();
+}
+
+// 每个节点缓存的子树节点数/高度/叶子数必须与 getStats 重新遍历得到的结果一致
+template <typename Policy>
+static bool statsMatch(Tree<int, Policy>& tree) {
+    bool match = true;
+    for (auto& node : tree.preOrder()) {
+        TreeStats stats = tree.getStats(&node);
+        match = match && node.subtree.size == stats.size && node.subtree.height == stats.depth && node.subtree.leaves == stats.breadth;
+    }
+    return match;
+}
+
+// 随机执行 addChild/addNode/deleteChild/deleteNode, 每一步后与 getStats 的结果比对
+template <typename Policy>
+static void checkSubtreeStats() {
+    Tree<int, Policy> tree(0);
+    std::mt19937 rng(20261017);
+    int next_value = 1;
+
+    for (int step = 0; step < 2000; ++step) {
+        std::vector<TreeNode<int, Policy>*> nodes;
+        for (auto& node : tree.preOrder()) nodes.push_back(&node);
+        TreeNode<int, Policy>* node = nodes[rng() % nodes.size()];
+
+        switch (rng() % 16) {
+            case 0:
+            case 1:
+            case 2:
+            case 3:
+            case 4:
+                node->addChild(next_value++);
+                break;
+            case 5:
+            case 6:
+            case 7:
+            case 8:
+            case 9:
+                tree.addNode(node, next_value++);
+                break;
+            case 10:
+            case 11:
+            case 12:
+            case 13:
+            case 14: {
+                // 叶子可以删除, 有子节点的节点必须被 deleteChild 拒绝且统计不变
+                if (node->parent == nullptr) break;
+                bool leaf = !node->hasChildren();
+                TEST_ASSERT_TRUE(node->parent->deleteChild(node->node_data) == leaf);
+                break;
+            }
+            default: {
+                // 删除根节点只清空子节点并返回 false
+                bool is_root = node->parent == nullptr;
+                TEST_ASSERT_TRUE(tree.deleteNode(node) == !is_root);
+                break;
+            }
+        }
+
+        TEST_ASSERT_TRUE(statsMatch(tree));
+        TEST_ASSERT_EQUAL_UINT32(tree.getStats().size, tree.getSize());
+        TEST_ASSERT_EQUAL_UINT32(tree.getStats().depth, tree.getDepth());
+        TEST_ASSERT_EQUAL_UINT32(tree.getStats().breadth, tree.getBreadth());
+    }
+}
+
+void test_subtree_stats_follow_random_edits() {
+    checkSubtreeStats<TreeStatsPolicy>();
+    checkSubtreeStats<TreeIndexPolicy<true, true, true, true>>();
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_traversal_order);
+    RUN_TEST(test_deep_tree_without_recursion);
+    RUN_TEST(test_subtree_stats_follow_random_edits);
+    return UNITY_END();
+}